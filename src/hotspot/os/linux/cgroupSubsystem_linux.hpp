@@ -26,6 +26,7 @@
 #define CGROUP_SUBSYSTEM_LINUX_HPP
 
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "logging/log.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -207,18 +208,21 @@ class CachedMetric : public CHeapObj<mtInternal>{
       _metric = -1;
       _next_check_counter = min_jlong;
     }
+    // The cache is read without locking. The acquire here pairs with the
+    // release in set_value(), so a reader that sees a fresh check counter
+    // also sees the metric stored with it.
     bool should_check_metric() {
-      return os::elapsed_counter() > _next_check_counter;
+      return os::elapsed_counter() > Atomic::load_acquire(&_next_check_counter);
     }
-    jlong value() { return _metric; }
+    jlong value() { return Atomic::load(&_metric); }
     void set_value(jlong value, jlong timeout) {
-      _metric = value;
+      Atomic::store(&_metric, value);
       // Metric is unlikely to change, but we want to remain
       // responsive to configuration changes. A very short grace time
       // between re-read avoids excessive overhead during startup without
       // significantly reducing the VMs ability to promptly react to changed
       // metric config
-      _next_check_counter = os::elapsed_counter() + timeout;
+      Atomic::release_store(&_next_check_counter, os::elapsed_counter() + timeout);
     }
 };
 
@@ -252,6 +256,7 @@ class CgroupSubsystem: public CHeapObj<mtInternal> {
     virtual jlong memory_and_swap_limit_in_bytes() = 0;
     virtual jlong memory_soft_limit_in_bytes() = 0;
     virtual jlong memory_max_usage_in_bytes() = 0;
+    virtual double memory_pressure() = 0;
     virtual char * cpu_cpuset_cpus() = 0;
     virtual char * cpu_cpuset_memory_nodes() = 0;
     virtual jlong read_memory_limit_in_bytes() = 0;
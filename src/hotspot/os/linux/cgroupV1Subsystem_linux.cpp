@@ -189,6 +189,18 @@ jlong CgroupV1Subsystem::memory_max_usage_in_bytes() {
   return memmaxusage;
 }
 
+/* memory_pressure
+ *
+ * Pressure stall information is only available for cgroups v2.
+ *
+ * return:
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV1Subsystem::memory_pressure() {
+  log_trace(os, container)("Memory Pressure is not supported.");
+  return OSCONTAINER_ERROR;
+}
+
 char * CgroupV1Subsystem::cpu_cpuset_cpus() {
   GET_CONTAINER_INFO_CPTR(cptr, _cpuset, "/cpuset.cpus",
                      "cpuset.cpus is: %s", "%1023s", cpus, 1024);
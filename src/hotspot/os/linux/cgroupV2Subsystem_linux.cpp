@@ -148,6 +148,22 @@ jlong CgroupV2Subsystem::memory_max_usage_in_bytes() {
   return OSCONTAINER_ERROR; // not supported
 }
 
+/* memory_pressure
+ *
+ * Return the share of time in percent in which at least some tasks in the
+ * cgroup were stalled on memory over the last 10 seconds, i.e. the
+ * "some avg10" value of memory.pressure.
+ *
+ * return:
+ *    memory pressure in percent or
+ *    OSCONTAINER_ERROR for not supported
+ */
+double CgroupV2Subsystem::memory_pressure() {
+  GET_CONTAINER_INFO_LINE(double, _unified, "/memory.pressure", "some",
+                          "Memory Pressure is: %1.2f", "%s avg10=%lf", pressure);
+  return pressure;
+}
+
 char* CgroupV2Subsystem::mem_soft_limit_val() {
   GET_CONTAINER_INFO_CPTR(cptr, _unified, "/memory.low",
                          "Memory Soft Limit is: %s", "%s", mem_soft_limit_str, 1024);
@@ -68,6 +68,11 @@
           " on the value of quotas (if set), when true. Otherwise, use" \
           " the CPU shares value, provided it is less than quota.")     \
                                                                         \
+  product(uintx, ContainerMetricsCacheTimeout, 20, DIAGNOSTIC,          \
+          "Milliseconds to reuse the container memory limit and CPU"    \
+          " count before re-reading them from the cgroup filesystem")   \
+          range(0, max_jint)                                            \
+                                                                        \
   product(bool, AdjustStackSizeForTLS, false,                           \
           "Increase the thread stack size to include space for glibc "  \
           "static thread-local storage (TLS) if true")                  \
@@ -28,11 +28,13 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "memory/allStatic.hpp"
+#include "runtime/globals.hpp"
 
 #define OSCONTAINER_ERROR (-2)
 
-// 20ms timeout between re-reads of memory limit and _active_processor_count.
-#define OSCONTAINER_CACHE_TIMEOUT (NANOSECS_PER_SEC/50)
+// Timeout between re-reads of memory limit and _active_processor_count,
+// in os::elapsed_counter() ticks (nanoseconds on Linux).
+#define OSCONTAINER_CACHE_TIMEOUT ((jlong)ContainerMetricsCacheTimeout * NANOSECS_PER_MILLISEC)
 
 class OSContainer: AllStatic {
 
@@ -51,6 +53,7 @@ class OSContainer: AllStatic {
   static jlong memory_soft_limit_in_bytes();
   static jlong memory_usage_in_bytes();
   static jlong memory_max_usage_in_bytes();
+  static double memory_pressure();
 
   static int active_processor_count();
 
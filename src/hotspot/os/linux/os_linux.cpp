@@ -181,6 +181,11 @@ static int clock_tics_per_sec = 100;
 // avoid this
 static bool suppress_primordial_thread_resolution = false;
 
+// Thread creation latency, from pthread_create() until the child has
+// finished its OS-level initialization and is ready to be started.
+static volatile uint64_t thread_create_count = 0;
+static volatile uint64_t thread_create_time_ns = 0;
+
 // utility functions
 
 julong os::available_memory() {
@@ -853,6 +858,7 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
     pthread_t tid;
     int ret = 0;
     int limit = 3;
+    const jlong create_start = os::javaTimeNanos();
     do {
       ret = pthread_create(&tid, &attr, (void* (*)(void*)) thread_native_entry, thread);
     } while (ret == EAGAIN && limit-- > 0);
@@ -893,6 +899,16 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
         sync_with_child->wait_without_safepoint_check();
       }
     }
+
+    const uint64_t elapsed = (uint64_t)(os::javaTimeNanos() - create_start);
+    const uint64_t count = Atomic::add(&thread_create_count, (uint64_t)1);
+    const uint64_t total = Atomic::add(&thread_create_time_ns, elapsed);
+    // The name of a JavaThread is not known yet, so identify the thread by
+    // its address and pthread id, as logged when it was started.
+    log_debug(os, thread)("Thread " PTR_FORMAT " (pthread id: " UINTX_FORMAT ") created in " UINT64_FORMAT " us "
+                          "(" UINT64_FORMAT " threads created, average " UINT64_FORMAT " us)",
+                          p2i(thread), (uintx) tid, elapsed / (NANOUNITS / MICROUNITS),
+                          count, total / count / (NANOUNITS / MICROUNITS));
   }
 
   // The thread is returned suspended (in state INITIALIZED),
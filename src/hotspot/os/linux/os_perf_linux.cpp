@@ -225,6 +225,9 @@ struct CPUPerfCounters {
 };
 
 static double get_cpu_load(int which_logical_cpu, CPUPerfCounters* counters, double* pkernelLoad, CpuLoadTarget target);
+static double get_cpu_load_from_ticks(const os::Linux::CPUPerfTicks* prev,
+                                      const os::Linux::CPUPerfTicks* pticks,
+                                      double* pkernelLoad);
 
 /** reads /proc/<pid>/stat data, with some checks and some skips.
  *  Ensure that 'fmt' does _NOT_ contain the first two "%d %s"
@@ -308,9 +311,10 @@ static int read_ticks(const char* procfile, uint64_t* userTicks, uint64_t* syste
 
 /**
  * Return the number of ticks spent in any of the processes belonging
- * to the JVM on any CPU.
+ * to the JVM on any CPU. If psystemTicks is not NULL, it also receives
+ * the accumulated ticks of all cpus read along the way.
  */
-static OSReturn get_jvm_ticks(os::Linux::CPUPerfTicks* pticks) {
+static OSReturn get_jvm_ticks(os::Linux::CPUPerfTicks* pticks, os::Linux::CPUPerfTicks* psystemTicks = NULL) {
   uint64_t userTicks;
   uint64_t systemTicks;
 
@@ -327,6 +331,10 @@ static OSReturn get_jvm_ticks(os::Linux::CPUPerfTicks* pticks) {
     return OS_ERR;
   }
 
+  if (psystemTicks != NULL) {
+    *psystemTicks = *pticks;
+  }
+
   pticks->used       = userTicks;
   pticks->usedKernel = systemTicks;
 
@@ -341,10 +349,8 @@ static OSReturn get_jvm_ticks(os::Linux::CPUPerfTicks* pticks) {
  * Returns a negative value if there is a problem in determining the CPU load.
  */
 static double get_cpu_load(int which_logical_cpu, CPUPerfCounters* counters, double* pkernelLoad, CpuLoadTarget target) {
-  uint64_t udiff, kdiff, tdiff;
   os::Linux::CPUPerfTicks* pticks;
   os::Linux::CPUPerfTicks  tmp;
-  double user_load;
 
   *pkernelLoad = 0.0;
 
@@ -366,15 +372,29 @@ static double get_cpu_load(int which_logical_cpu, CPUPerfCounters* counters, dou
     return -1.0;
   }
 
+  return get_cpu_load_from_ticks(&tmp, pticks, pkernelLoad);
+}
+
+/**
+ * Return the load between two tick samples, see get_cpu_load.
+ */
+static double get_cpu_load_from_ticks(const os::Linux::CPUPerfTicks* prev,
+                                      const os::Linux::CPUPerfTicks* pticks,
+                                      double* pkernelLoad) {
+  uint64_t udiff, kdiff, tdiff;
+  double user_load;
+
+  *pkernelLoad = 0.0;
+
   // seems like we sometimes end up with less kernel ticks when
   // reading /proc/self/stat a second time, timing issue between cpus?
-  if (pticks->usedKernel < tmp.usedKernel) {
+  if (pticks->usedKernel < prev->usedKernel) {
     kdiff = 0;
   } else {
-    kdiff = pticks->usedKernel - tmp.usedKernel;
+    kdiff = pticks->usedKernel - prev->usedKernel;
   }
-  tdiff = pticks->total - tmp.total;
-  udiff = pticks->used - tmp.used;
+  tdiff = pticks->total - prev->total;
+  udiff = pticks->used - prev->used;
 
   if (tdiff == 0) {
     return 0.0;
@@ -570,21 +590,29 @@ int CPUPerformanceInterface::CPUPerformance::cpu_load_total_process(double* cpu_
 }
 
 int CPUPerformanceInterface::CPUPerformance::cpu_loads_process(double* pjvmUserLoad, double* pjvmKernelLoad, double* psystemTotalLoad) {
-  double u, s, t;
+  double u, s, t, su, ss;
 
   assert(pjvmUserLoad != NULL, "pjvmUserLoad not inited");
   assert(pjvmKernelLoad != NULL, "pjvmKernelLoad not inited");
   assert(psystemTotalLoad != NULL, "psystemTotalLoad not inited");
 
-  u = get_cpu_load(-1, &_counters, &s, CPU_LOAD_VM_ONLY);
-  if (u < 0) {
+  os::Linux::CPUPerfTicks* jvm_ticks = &_counters.jvmTicks;
+  os::Linux::CPUPerfTicks* system_ticks = &_counters.cpus[_counters.nProcs];
+  os::Linux::CPUPerfTicks prev_jvm_ticks = *jvm_ticks;
+  os::Linux::CPUPerfTicks prev_system_ticks = *system_ticks;
+
+  // A single read of /proc/stat serves both the JVM and the system-wide load.
+  if (get_jvm_ticks(jvm_ticks, system_ticks) != OS_OK) {
     *pjvmUserLoad = 0.0;
     *pjvmKernelLoad = 0.0;
     *psystemTotalLoad = 0.0;
     return OS_ERR;
   }
 
-  cpu_load(-1, &t);
+  u = get_cpu_load_from_ticks(&prev_jvm_ticks, jvm_ticks, &s);
+  su = get_cpu_load_from_ticks(&prev_system_ticks, system_ticks, &ss);
+  // Cap total systemload to 1.0
+  t = MIN2<double>((su + ss), 1.0);
   // clamp at user+system and 1.0
   if (u + s > t) {
     t = MIN2<double>(u + s, 1.0);
@@ -263,6 +263,9 @@ void Compilation::emit_lir() {
   {
     PhaseTraceTime timeit(_t_linearScan);
 
+    size_t arena_before = arena()->size_in_bytes();
+    size_t resource_before = Thread::current()->resource_area()->size_in_bytes();
+
     LinearScan* allocator = new LinearScan(hir(), &gen, frame_map());
     set_allocator(allocator);
     // Assign physical registers to LIR operands using a linear scan algorithm.
@@ -270,6 +273,13 @@ void Compilation::emit_lir() {
     CHECK_BAILOUT();
 
     _max_spills = allocator->max_spills();
+
+    if (log() != NULL) {
+      log()->elem("linear_scan intervals='%d' spills='%d' arena='" SIZE_FORMAT "' resource='" SIZE_FORMAT "'",
+                  allocator->num_intervals(), _max_spills,
+                  arena()->size_in_bytes() - arena_before,
+                  Thread::current()->resource_area()->size_in_bytes() - resource_before);
+    }
   }
 
   if (BailoutAfterLIR) {
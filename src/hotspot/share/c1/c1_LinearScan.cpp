@@ -287,7 +287,8 @@ void LinearScan::append_interval(Interval* it) {
   _intervals.append(it);
   IntervalList* new_intervals = _new_intervals_from_allocation;
   if (new_intervals == NULL) {
-    new_intervals = _new_intervals_from_allocation = new IntervalList();
+    // sized like the headroom reserved for split children in build_intervals
+    new_intervals = _new_intervals_from_allocation = new IntervalList(32);
   }
   new_intervals->append(it);
 }
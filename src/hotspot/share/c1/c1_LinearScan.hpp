@@ -393,6 +393,7 @@ class LinearScan : public CompilationResourceObj {
   // accessors used by Compilation
   int         max_spills()  const { return _max_spills; }
   int         num_calls() const   { assert(_num_calls >= 0, "not set"); return _num_calls; }
+  int         num_intervals() const { return interval_count(); }
 
 #ifndef PRODUCT
   // entry functions for printing
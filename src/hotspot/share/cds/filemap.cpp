@@ -40,6 +40,8 @@
 #include "classfile/systemDictionaryShared.hpp"
 #include "classfile/vmClasses.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "logging/logMessage.hpp"
@@ -54,6 +56,7 @@
 #include "oops/oop.inline.hpp"
 #include "prims/jvmtiExport.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -1889,10 +1892,40 @@ char* FileMapInfo::map_bitmap_region() {
   return bitmap_base;
 }
 
+// Patches the relocation bitmap in chunks claimed by the GC worker
+// threads. Each marked pointer is patched exactly once, so the shared
+// SharedDataRelocator needs no synchronization.
+class SharedDataRelocationTask : public WorkerTask {
+  BitMapView* _ptrmap;
+  SharedDataRelocator* _patcher;
+  volatile BitMap::idx_t _next_chunk;
+
+  static const BitMap::idx_t ChunkBits = 64 * K;
+
+ public:
+  SharedDataRelocationTask(BitMapView* ptrmap, SharedDataRelocator* patcher) :
+    WorkerTask("CDS Archive Relocation"),
+    _ptrmap(ptrmap),
+    _patcher(patcher),
+    _next_chunk(0) {}
+
+  void work(uint worker_id) {
+    const BitMap::idx_t size = _ptrmap->size();
+    while (true) {
+      BitMap::idx_t beg = Atomic::fetch_and_add(&_next_chunk, ChunkBits);
+      if (beg >= size) {
+        break;
+      }
+      _ptrmap->iterate(_patcher, beg, MIN2(beg + ChunkBits, size));
+    }
+  }
+};
+
 // This is called when we cannot map the archive at the requested[ base address (usually 0x800000000).
 // We relocate all pointers in the 2 core regions (ro, rw).
 bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
   log_debug(cds, reloc)("runtime archive relocation start");
+  const jlong start_time = os::javaTimeNanos();
   char* bitmap_base = map_bitmap_region();
 
   if (bitmap_base == NULL) {
@@ -1921,11 +1954,22 @@ bool FileMapInfo::relocate_pointers_in_core_regions(intx addr_delta) {
 
     SharedDataRelocator patcher((address*)patch_base, (address*)patch_end, valid_old_base, valid_old_end,
                                 valid_new_base, valid_new_end, addr_delta);
-    ptrmap.iterate(&patcher);
+    WorkerThreads* workers = UseParallelArchiveRelocation ? Universe::heap()->safepoint_workers() : NULL;
+    // With UseDynamicNumberOfGCThreads only one worker is active this early,
+    // so ask for all of them explicitly.
+    const uint num_workers = workers != NULL ? workers->max_workers() : 1;
+    if (workers != NULL) {
+      SharedDataRelocationTask task(&ptrmap, &patcher);
+      workers->run_task(&task, num_workers);
+    } else {
+      ptrmap.iterate(&patcher);
+    }
 
     // The MetaspaceShared::bm region will be unmapped in MetaspaceShared::initialize_shared_spaces().
 
-    log_debug(cds, reloc)("runtime archive relocation done");
+    log_debug(cds, reloc)("runtime archive relocation done in " JLONG_FORMAT " us using %u thread(s)",
+                          (os::javaTimeNanos() - start_time) / (NANOUNITS / MICROUNITS),
+                          num_workers);
     return true;
   }
 }
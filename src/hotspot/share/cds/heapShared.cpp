@@ -60,6 +60,7 @@
 #include "runtime/init.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
+#include "runtime/os.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/copy.hpp"
@@ -1885,6 +1886,7 @@ bool HeapShared::load_regions(FileMapInfo* mapinfo, LoadedArchiveHeapRegion* loa
 }
 
 bool HeapShared::load_heap_regions(FileMapInfo* mapinfo) {
+  const jlong start_time = os::javaTimeNanos();
   init_narrow_oop_decoding(mapinfo->narrow_oop_base(), mapinfo->narrow_oop_shift());
 
   LoadedArchiveHeapRegion loaded_regions[MetaspaceShared::max_num_heap_regions];
@@ -1904,6 +1906,10 @@ bool HeapShared::load_heap_regions(FileMapInfo* mapinfo) {
   init_loaded_heap_relocation(loaded_regions, num_loaded_regions);
   _is_loaded = true;
 
+  log_info(cds)("Loaded %d heap regions (" SIZE_FORMAT " bytes) into the %s heap in " JLONG_FORMAT " us",
+                num_loaded_regions, archive_space.byte_size(), Universe::heap()->name(),
+                (os::javaTimeNanos() - start_time) / (NANOUNITS / MICROUNITS));
+
   return true;
 }
 
@@ -504,10 +504,11 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
         // The call site count is 0 with known morphism (only 1 or 2 receivers)
         // or < 0 in the case of a type check failure for checkcast, aastore, instanceof.
         // The call site count is > 0 in the case of a polymorphic virtual call.
+        // Beyond a single receiver, the morphism is only known if no call
+        // was counted without recording its receiver in a profile row.
         if (morphism > 0 && morphism == result._limit) {
            // The morphism <= MorphismLimit.
-           if ((morphism <  ciCallProfile::MorphismLimit) ||
-               (morphism == ciCallProfile::MorphismLimit && count == 0)) {
+           if (morphism == 1 || count == 0) {
 #ifdef ASSERT
              if (count > 0) {
                this->print_short_name(tty);
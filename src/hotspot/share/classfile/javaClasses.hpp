@@ -1130,6 +1130,7 @@ class jdk_internal_vm_Continuation: AllStatic {
   macro(jdk_internal_vm_StackChunk, flags,   byte_signature, false)          \
   macro(jdk_internal_vm_StackChunk, pc,      intptr_signature, false)        \
   macro(jdk_internal_vm_StackChunk, maxSize, int_signature, false)           \
+  macro(jdk_internal_vm_StackChunk, lockedMonitors, int_signature, false)    \
 
 class jdk_internal_vm_StackChunk: AllStatic {
   friend class JavaClasses;
@@ -1141,6 +1142,7 @@ class jdk_internal_vm_StackChunk: AllStatic {
   static int _argsize_offset;
   static int _flags_offset;
   static int _maxSize_offset;
+  static int _lockedMonitors_offset;
   static int _cont_offset;
 
 
@@ -1150,6 +1152,7 @@ class jdk_internal_vm_StackChunk: AllStatic {
 
   static inline int parent_offset() { return _parent_offset; }
   static inline int cont_offset()   { return _cont_offset; }
+  static inline int sp_offset()     { return _sp_offset; }
 
   // Accessors
   static inline oop parent(oop chunk);
@@ -1175,6 +1178,9 @@ class jdk_internal_vm_StackChunk: AllStatic {
   static inline int maxSize(oop chunk);
   static inline void set_maxSize(oop chunk, int value);
 
+  static inline int lockedMonitors(oop chunk);
+  static inline void set_lockedMonitors(oop chunk, int value);
+
  // cont oop's processing is essential for the chunk's GC protocol
   static inline oop cont(oop chunk);
   static inline void set_cont(oop chunk, oop value);
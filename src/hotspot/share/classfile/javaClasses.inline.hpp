@@ -362,6 +362,14 @@ inline void jdk_internal_vm_StackChunk::set_maxSize(oop chunk, int value) {
   chunk->int_field_put(_maxSize_offset, value);
 }
 
+inline int jdk_internal_vm_StackChunk::lockedMonitors(oop chunk) {
+  return chunk->int_field(_lockedMonitors_offset);
+}
+
+inline void jdk_internal_vm_StackChunk::set_lockedMonitors(oop chunk, int value) {
+  chunk->int_field_put(_lockedMonitors_offset, value);
+}
+
 inline void java_lang_invoke_CallSite::set_target_volatile(oop site, oop target) {
   site->obj_field_put_volatile(_target_offset, target);
 }
@@ -254,6 +254,19 @@ void StringTable::trigger_concurrent_work() {
   Service_lock->notify_all();
 }
 
+// Called after an insert, so that a burst of interning grows the table
+// right away instead of only at the next gc_notification().
+void StringTable::check_concurrent_work() {
+  if (has_work()) {
+    return;
+  }
+  double load_factor = get_load_factor();
+  if (load_factor > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached()) {
+    log_debug(stringtable)("Concurrent work triggered by insert, load factor: %g", load_factor);
+    trigger_concurrent_work();
+  }
+}
+
 // Probing
 oop StringTable::lookup(Symbol* symbol) {
   ResourceMark rm;
@@ -381,6 +394,7 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
     if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      check_concurrent_work();
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
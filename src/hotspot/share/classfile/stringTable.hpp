@@ -64,6 +64,7 @@ class StringTable : public CHeapObj<mtSymbol>{
   // Callback for GC to notify of changes that might require cleaning or resize.
   static void gc_notification(size_t num_dead);
   static void trigger_concurrent_work();
+  static void check_concurrent_work();
 
   static size_t item_added();
   static void item_removed();
@@ -500,6 +500,10 @@ Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, boo
   if (clean_hint) {
     mark_has_items_to_clean();
     check_concurrent_work();
+  } else if (get_load_factor() > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached()) {
+    // Grow right away during bursts of new symbols rather than waiting
+    // for the next cleaning hint.
+    check_concurrent_work();
   }
 
   assert((sym == NULL) || sym->refcount() != 0, "found dead symbol");
@@ -68,10 +68,12 @@
 #include "prims/jvmtiExport.hpp"
 #include "prims/methodHandles.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "services/classLoadingService.hpp"
@@ -444,6 +446,37 @@ InstanceKlass* SystemDictionary::resolve_super_or_fail(Symbol* class_name,
   return superk;
 }
 
+// Measures how long class loading threads wait for SystemDictionary_lock,
+// or for placeholders owned by other threads, with -Xlog:class+load+lock.
+static volatile uint64_t _lock_wait_count = 0;
+static volatile uint64_t _lock_wait_nanos = 0;
+
+class SystemDictionaryLockWaitTimer : public StackObj {
+  const char* _what;
+  jlong _start;
+ public:
+  SystemDictionaryLockWaitTimer(const char* what) :
+    _what(what),
+    _start(log_is_enabled(Debug, class, load, lock) ? os::javaTimeNanos() : 0) {}
+
+  // Called once the lock has been acquired or the wait has returned.
+  void done() {
+    if (_start == 0) {
+      return;
+    }
+    const uint64_t waited = (uint64_t)(os::javaTimeNanos() - _start);
+    const uint64_t count = Atomic::add(&_lock_wait_count, (uint64_t)1);
+    const uint64_t total = Atomic::add(&_lock_wait_nanos, waited);
+    if (waited >= (uint64_t)NANOSECS_PER_MILLISEC) {
+      log_debug(class, load, lock)("%s: waited %.3f ms (total %.3f ms in " UINT64_FORMAT " waits)",
+                                   _what, (double)waited / NANOSECS_PER_MILLISEC,
+                                   (double)total / NANOSECS_PER_MILLISEC, count);
+    } else {
+      log_trace(class, load, lock)("%s: waited " UINT64_FORMAT " ns", _what, waited);
+    }
+  }
+};
+
 // We only get here if this thread finds that another thread
 // has already claimed the placeholder token for the current operation,
 // but that other thread either never owned or gave up the
@@ -547,11 +580,13 @@ InstanceKlass* SystemDictionary::handle_parallel_loading(JavaThread* current,
         // which we will find below in the systemDictionary.
         oldprobe = NULL;  // Other thread could delete this placeholder entry
 
+        SystemDictionaryLockWaitTimer timer("placeholder wait");
         if (lockObject.is_null()) {
           SystemDictionary_lock->wait();
         } else {
           double_lock_wait(current, lockObject);
         }
+        timer.done();
 
         // Check if classloading completed while we were waiting
         InstanceKlass* check = loader_data->dictionary()->find_class(name_hash, name);
@@ -633,7 +668,9 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
 
   // Check again (after locking) if the class already exists in SystemDictionary
   {
+    SystemDictionaryLockWaitTimer timer("SystemDictionary_lock for lookup");
     MutexLocker mu(THREAD, SystemDictionary_lock);
+    timer.done();
     InstanceKlass* check = dictionary->find_class(name_hash, name);
     if (check != NULL) {
       // InstanceKlass is already loaded, but we still need to check protection domain below.
@@ -679,7 +716,9 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
     //    For these classloaders, we ensure that the first requestor
     //    completes the load and other requestors wait for completion.
     {
+      SystemDictionaryLockWaitTimer timer("SystemDictionary_lock for placeholder");
       MutexLocker mu(THREAD, SystemDictionary_lock);
+      timer.done();
       if (should_wait_for_loading(class_loader)) {
         loaded_class = handle_parallel_loading(THREAD,
                                                name_hash,
@@ -727,7 +766,9 @@ InstanceKlass* SystemDictionary::resolve_instance_class_or_null(Symbol* name,
       // clean up placeholder entries for LOAD_INSTANCE success or error
       // This brackets the SystemDictionary updates for both defining
       // and initiating loaders
+      SystemDictionaryLockWaitTimer timer("SystemDictionary_lock for placeholder removal");
       MutexLocker mu(THREAD, SystemDictionary_lock);
+      timer.done();
       placeholders()->find_and_remove(name_hash, name, loader_data, PlaceholderTable::LOAD_INSTANCE, THREAD);
       SystemDictionary_lock->notify_all();
     }
@@ -192,6 +192,7 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
   char* exception_message = NULL;
 
   log_info(class, init)("Start class verification for: %s", klass->external_name());
+  const jlong start_time = os::javaTimeNanos();
   if (klass->major_version() >= STACKMAP_ATTRIBUTE_MAJOR_VERSION) {
     ClassVerifier split_verifier(jt, klass);
     // We don't use CHECK here, or on inference_verify below, so that we can log any exception.
@@ -226,6 +227,10 @@ bool Verifier::verify(InstanceKlass* klass, bool should_verify_class, TRAPS) {
         klass, message_buffer, message_buffer_len, THREAD);
   }
 
+  log_debug(verification)("Verification of %s (%d methods) took " JLONG_FORMAT " us",
+                          klass->external_name(), klass->methods()->length(),
+                          (os::javaTimeNanos() - start_time) / (NANOUNITS / MICROUNITS));
+
   LogTarget(Info, class, init) lt1;
   if (lt1.is_enabled()) {
     LogStream ls(lt1);
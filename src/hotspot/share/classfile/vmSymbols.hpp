@@ -420,6 +420,7 @@
   template(numOops_name,                              "numOops")                                  \
   template(stack_name,                                "stack")                                    \
   template(maxSize_name,                              "maxSize")                                  \
+  template(lockedMonitors_name,                       "lockedMonitors")                           \
   template(reset_name,                                "reset")                                    \
   template(done_name,                                 "done")                                     \
   template(mounted_name,                              "mounted")                                  \
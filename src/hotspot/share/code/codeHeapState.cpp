@@ -24,11 +24,13 @@
  */
 
 #include "precompiled.hpp"
+#include "code/codeCache.hpp"
 #include "code/codeHeapState.hpp"
 #include "compiler/compileBroker.hpp"
 #include "oops/klass.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/sweeper.hpp"
+#include "utilities/align.hpp"
 #include "utilities/powerOfTwo.hpp"
 
 // -------------------------
@@ -706,6 +708,17 @@ void CodeHeapState::aggregate(outputStream* out, CodeHeap* heap, size_t granular
     minTemp       = (int)(res_size > M ? (res_size/M)*2 : 1);
     maxTemp       = -minTemp;
 
+    // Spread of the hot methods over the pages backing this heap. Hot code
+    // scattered over many pages costs i-TLB entries.
+    const int    hot_threshold  = NMethodSweeper::hotness_counter_reset_val()/2;
+    const size_t hot_page_size  = CodeCache::page_size();
+    // The heap need not start on a page boundary, count pages from the one it starts in.
+    char* const  hot_page_base  = align_down(low_bound, hot_page_size);
+    unsigned int n_hot_methods  = 0;
+    size_t       hot_space      = 0;
+    size_t       hot_pages      = 0;
+    size_t       last_hot_page  = 0;
+
     for (HeapBlock *h = heap->first_block(); h != NULL && !insane; h = heap->next_block(h)) {
       unsigned int hb_len     = (unsigned int)h->length();  // despite being size_t, length can never overflow an unsigned int.
       size_t       hb_bytelen = ((size_t)hb_len)<<log2_seg_size;
@@ -789,6 +802,19 @@ void CodeHeapState::aggregate(outputStream* out, CodeHeap* heap, size_t granular
                 n_methods++;
                 maxTemp = (temperature > maxTemp) ? temperature : maxTemp;
                 minTemp = (temperature < minTemp) ? temperature : minTemp;
+                if (temperature > hot_threshold) {
+                  // Blocks are visited in address order, so a page is only
+                  // shared with the previous hot method, if at all.
+                  size_t first_page = ((char*)h - hot_page_base)/hot_page_size;
+                  size_t last_page  = ((char*)h - hot_page_base + hb_bytelen - 1)/hot_page_size;
+                  hot_pages += last_page - first_page + 1;
+                  if (n_hot_methods > 0 && first_page == last_hot_page) {
+                    hot_pages--;
+                  }
+                  last_hot_page = last_page;
+                  n_hot_methods++;
+                  hot_space += hb_bytelen;
+                }
                 break;
               }
               case nMethod_notused:
@@ -1162,6 +1188,12 @@ void CodeHeapState::aggregate(outputStream* out, CodeHeap* heap, size_t granular
         ast->print_cr("min. hotness = %6d", minTemp);
         ast->print_cr("avg. hotness = %6d", avgTemp);
         ast->print_cr("max. hotness = %6d", maxTemp);
+        if (n_hot_methods > 0) {
+          ast->print_cr("hot methods  = %6d (hotness > %d), " SIZE_FORMAT "k spread over " SIZE_FORMAT " pages of " SIZE_FORMAT "k, "
+                        "%.3f%% page utilization",
+                        n_hot_methods, hot_threshold, hot_space/K, hot_pages, hot_page_size/K,
+                        (100.0*hot_space)/(hot_pages*hot_page_size));
+        }
       } else {
         avgTemp = 0;
         ast->print_cr("No hotness data available");
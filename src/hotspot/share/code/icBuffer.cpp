@@ -31,6 +31,7 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/linkResolver.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
@@ -140,7 +141,7 @@ void ICStub::print() {
 
 void InlineCacheBuffer::initialize() {
   if (_buffer != NULL) return; // already initialized
-  _buffer = new StubQueue(new ICStubInterface, 10*K, InlineCacheBuffer_lock, "InlineCacheBuffer");
+  _buffer = new StubQueue(new ICStubInterface, checked_cast<int>(InlineCacheBufferSize), InlineCacheBuffer_lock, "InlineCacheBuffer");
   assert (_buffer != NULL, "cannot allocate InlineCacheBuffer");
 }
 
@@ -157,6 +158,8 @@ void InlineCacheBuffer::refill_ic_stubs() {
 #endif
   // we ran out of inline cache buffer space; must enter safepoint.
   // We do this by forcing a safepoint
+  log_debug(safepoint)("Inline cache buffer full with %d stubs, requesting safepoint",
+                       buffer()->number_of_stubs());
   VM_ICBufferFull ibf;
   VMThread::execute(&ibf);
 }
@@ -23,10 +23,12 @@
  */
 
 #include "precompiled.hpp"
+#include "code/codeCache.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/methodData.hpp"
 #include "oops/method.inline.hpp"
@@ -38,6 +40,7 @@
 #include "runtime/frame.inline.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 
@@ -57,6 +60,9 @@ jlong CompilationPolicy::_start_time = 0;
 int CompilationPolicy::_c1_count = 0;
 int CompilationPolicy::_c2_count = 0;
 double CompilationPolicy::_increase_threshold_at_ratio = 0;
+jlong CompilationPolicy::_load_sample_time = 0;
+double CompilationPolicy::_load_factor = 1.0;
+int CompilationPolicy::_idle_processors = 0;
 
 void compilationPolicy_init() {
   CompilationPolicy::initialize();
@@ -320,6 +326,11 @@ double CompilationPolicy::threshold_scale(CompLevel level, int feedback_k) {
         k *= exp(current_reverse_free_ratio - _increase_threshold_at_ratio);
       }
     }
+    if (UseLoadAwareCompilation) {
+      // Delay compilations when the host already uses all processors, and
+      // start them earlier when it is idle.
+      k *= _load_factor;
+    }
     return k;
   }
   return 1;
@@ -570,6 +581,37 @@ CompLevel CompilationPolicy::highest_compile_level() {
   return level;
 }
 
+void CompilationPolicy::dump_hot_methods(const char* filename) {
+  fileStream fs(filename, "w");
+  if (!fs.is_open()) {
+    log_warning(jit, compilation)("Failed to create %s for hot methods", filename);
+    return;
+  }
+  int count = 0;
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  NMethodIterator iter(NMethodIterator::only_alive_and_not_unloading);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    if (!nm->is_in_use() || nm->is_osr_method() || nm->comp_level() != CompLevel_full_optimization) {
+      continue;
+    }
+    // The file is read back by CompilerOracle, so use its
+    // <option>,<class>::<method><signature>,<value> syntax. The names of
+    // hidden classes, such as those of lambda forms, have a suffix that is
+    // not stable across runs and that the oracle cannot parse.
+    Method* m = nm->method();
+    if (m->method_holder()->is_hidden()) {
+      continue;
+    }
+    ResourceMark rm;
+    fs.print_cr("CompileThresholdScaling,%s::%s%s,%f",
+                m->klass_name()->as_C_string(), m->name()->as_C_string(),
+                m->signature()->as_C_string(), HotMethodsThresholdScaling);
+    count++;
+  }
+  log_info(jit, compilation)("Wrote %d hot methods to %s", count, filename);
+}
+
 CompLevel CompilationPolicy::limit_level(CompLevel level) {
   level = MIN2(level, highest_compile_level());
   assert(verify_level(level), "Invalid compilation level: %d", level);
@@ -609,13 +651,41 @@ void CompilationPolicy::handle_counter_overflow(Method* method) {
   }
 }
 
+// Called with MethodCompileQueue_lock held. Sampling the load average is
+// a system call, so do it at most every 100ms. The load average covers the
+// whole host, so compare it with the processors of the host rather than
+// with the active processor count, which honours container CPU quotas.
+// A busy host delays compilations, an idle one speeds up warmup by at
+// most halving the thresholds.
+void CompilationPolicy::update_load(jlong t) {
+  if (_load_sample_time != 0 && t - _load_sample_time < 100) {
+    return;
+  }
+  _load_sample_time = t;
+  double load;
+  if (os::loadavg(&load, 1) != 1) {
+    return;
+  }
+  int cpus = os::processor_count();
+  _load_factor = MAX2(0.5, load / cpus);
+  _idle_processors = MAX2(1, cpus - (int)load);
+}
+
 // Called with the queue locked and with at least one element
 CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
   CompileTask *max_blocking_task = NULL;
   CompileTask *max_task = NULL;
+  CompileTask *oldest_task = NULL;
   Method* max_method = NULL;
 
   jlong t = nanos_to_millis(os::javaTimeNanos());
+  if (UseLoadAwareCompilation) {
+    update_load(t);
+  }
+  jlong aged_before = 0;
+  if (TieredCompileTaskMaxWait > 0) {
+    aged_before = os::elapsed_counter() - (jlong)(TieredCompileTaskMaxWait * (os::elapsed_frequency() / 1000));
+  }
   // Iterate through the queue and find a method with a maximum rate.
   for (CompileTask* task = compile_queue->first(); task != NULL;) {
     CompileTask* next_task = task->next();
@@ -646,9 +716,21 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue) {
       }
     }
 
+    if (task->time_queued() < aged_before &&
+        (oldest_task == NULL || task->time_queued() < oldest_task->time_queued())) {
+      oldest_task = task;
+    }
+
     task = next_task;
   }
 
+  if (oldest_task != NULL && max_blocking_task == NULL) {
+    // Don't let a task with a low event rate wait indefinitely behind
+    // a stream of hotter ones.
+    max_task = oldest_task;
+    max_method = max_task->method();
+  }
+
   if (max_blocking_task != NULL) {
     // In blocking compilation mode, the CompileBroker will make
     // compilations submitted by a JVMCI compiler thread non-blocking. These
@@ -167,6 +167,12 @@ class CompilationPolicy : AllStatic {
   static jlong _start_time;
   static int _c1_count, _c2_count;
   static double _increase_threshold_at_ratio;
+  // Sampled system load, see UseLoadAwareCompilation.
+  static jlong _load_sample_time;
+  static double _load_factor;
+  static int _idle_processors;
+
+  static void update_load(jlong t);
 
   // Set carry flags in the counters (in Method* and MDO).
   inline static void handle_counter_overflow(Method* method);
@@ -240,6 +246,8 @@ public:
   static int min_invocations() { return Tier4MinInvocationThreshold; }
   static int c1_count() { return _c1_count; }
   static int c2_count() { return _c2_count; }
+  // Processors not busy with other work at the last load sample
+  static int idle_processors() { return _idle_processors; }
   static int compiler_count(CompLevel comp_level);
 
   // If m must_be_compiled then request a compilation from the CompileBroker.
@@ -270,6 +278,8 @@ public:
   static CompLevel initial_compile_level(const methodHandle& method);
   // Return highest level possible
   static CompLevel highest_compile_level();
+  // Write the methods that reached tier 4 as CompileThresholdScaling commands
+  static void dump_hot_methods(const char* filename);
 };
 
 #endif // SHARE_COMPILER_COMPILATIONPOLICY_HPP
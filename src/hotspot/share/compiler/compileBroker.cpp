@@ -581,9 +581,29 @@ void CompileQueue::print(outputStream* st) {
       task = task->next();
     }
   }
+  jlong count = Atomic::load(&_installed_count);
+  if (count > 0) {
+    st->print_cr("Installed: " JLONG_FORMAT ", enqueue to install latency avg: %.3f ms, max: %.3f ms",
+                 count,
+                 TimeHelper::counter_to_millis(Atomic::load(&_total_latency)) / count,
+                 TimeHelper::counter_to_millis(Atomic::load(&_max_latency)));
+  }
   st->cr();
 }
 
+void CompileQueue::record_install_latency(jlong ticks) {
+  Atomic::inc(&_installed_count);
+  Atomic::add(&_total_latency, ticks);
+  jlong max = Atomic::load(&_max_latency);
+  while (ticks > max) {
+    jlong prev = Atomic::cmpxchg(&_max_latency, max, ticks);
+    if (prev == max) {
+      break;
+    }
+    max = prev;
+  }
+}
+
 void CompileQueue::print_tty() {
   ResourceMark rm;
   stringStream ss;
@@ -1058,6 +1078,9 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    if (UseLoadAwareCompilation && CompilationPolicy::idle_processors() > 0) {
+      new_c2_count = MIN2(new_c2_count, CompilationPolicy::idle_processors());
+    }
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1112,6 +1135,9 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    if (UseLoadAwareCompilation && CompilationPolicy::idle_processors() > 0) {
+      new_c1_count = MIN2(new_c1_count, CompilationPolicy::idle_processors());
+    }
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2134,6 +2160,10 @@ void CompileBroker::post_compile(CompilerThread* thread, CompileTask* task, bool
 
 static void post_compilation_event(EventCompilation& event, CompileTask* task) {
   assert(task != NULL, "invariant");
+  jlong queue_time = 0;
+  if (task->time_started() != 0) {
+    queue_time = (jlong)TimeHelper::counter_to_millis(task->time_started() - task->time_queued());
+  }
   CompilerEvent::CompilationEvent::post(event,
                                         task->compile_id(),
                                         task->compiler()->type(),
@@ -2142,7 +2172,8 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->is_success(),
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         (task->code() == NULL) ? 0 : task->code()->total_size(),
-                                        task->num_inlined_bytecodes());
+                                        task->num_inlined_bytecodes(),
+                                        queue_time);
 }
 
 int DirectivesStack::_depth = 0;
@@ -2343,6 +2374,10 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
 
   collect_statistics(thread, time, task);
 
+  if (task->is_success()) {
+    compile_queue(task_level)->record_install_latency(os::elapsed_counter() - task->time_queued());
+  }
+
   nmethod* nm = task->code();
   if (nm != NULL) {
     nm->maybe_print_nmethod(directive);
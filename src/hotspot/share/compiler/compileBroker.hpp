@@ -90,6 +90,11 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   int _size;
 
+  // Enqueue-to-install latency of the tasks taken from this queue, in ticks.
+  volatile jlong _installed_count;
+  volatile jlong _total_latency;
+  volatile jlong _max_latency;
+
   void purge_stale_tasks();
  public:
   CompileQueue(const char* name) {
@@ -98,6 +103,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _last = NULL;
     _size = 0;
     _first_stale = NULL;
+    _installed_count = 0;
+    _total_latency = 0;
+    _max_latency = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -113,6 +121,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
 
+  void         record_install_latency(jlong ticks);
 
   // Redefine Classes support
   void mark_on_stack();
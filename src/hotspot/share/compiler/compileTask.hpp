@@ -163,6 +163,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
   void         mark_complete()                   { _is_complete = true; }
   void         mark_success()                    { _is_success = true; }
   void         mark_started(jlong time)          { _time_started = time; }
+  jlong        time_queued() const               { return _time_queued; }
+  jlong        time_started() const              { return _time_started; }
 
   int          comp_level()                      { return _comp_level;}
   void         set_comp_level(int comp_level)    { _comp_level = comp_level;}
@@ -114,7 +114,7 @@ int CompilerEvent::PhaseEvent::get_phase_id(const char* phase_name, bool may_exi
   return index;
 }
 
-void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_id, CompilerType compiler_type, Method* method, int compile_level, bool success, bool is_osr, int code_size, int inlined_bytecodes) {
+void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_id, CompilerType compiler_type, Method* method, int compile_level, bool success, bool is_osr, int code_size, int inlined_bytecodes, jlong queue_time) {
   event.set_compileId(compile_id);
   event.set_compiler(compiler_type);
   event.set_method(method);
@@ -123,6 +123,7 @@ void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_
   event.set_isOsr(is_osr);
   event.set_codeSize(code_size);
   event.set_inlinedBytes(inlined_bytecodes);
+  event.set_queueTime(queue_time);
   event.commit();
 }
 
@@ -138,6 +138,17 @@
           "and the value of the per-method flag.")                          \
           range(0.0, DBL_MAX)                                               \
                                                                             \
+  product(ccstr, DumpHotMethodsAtExit, NULL, DIAGNOSTIC,                    \
+          "Write a CompileCommand file to this path at exit that scales "   \
+          "the compile thresholds of methods with a tier 4 nmethod by "     \
+          "HotMethodsThresholdScaling. Pass it as CompileCommandFile "      \
+          "on the next run to reach peak performance sooner")               \
+                                                                            \
+  product(double, HotMethodsThresholdScaling, 0.1, DIAGNOSTIC,              \
+          "Per-method CompileThresholdScaling written by "                  \
+          "DumpHotMethodsAtExit")                                           \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   product(intx, Tier0InvokeNotifyFreqLog, 7,                                \
           "Interpreter (tier 0) invocation notification frequency")         \
           range(0, 30)                                                      \
@@ -242,6 +253,12 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(intx, TieredCompileTaskMaxWait, 0, DIAGNOSTIC,                    \
+          "Select the oldest queued compile task once it has waited this "  \
+          "many milliseconds, regardless of its event rate. "               \
+          "0 disables aging")                                               \
+          range(0, max_intx)                                                \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
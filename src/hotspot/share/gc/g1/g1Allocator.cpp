@@ -44,16 +44,21 @@ G1Allocator::G1Allocator(G1CollectedHeap* heap) :
   _num_alloc_regions(_numa->num_active_nodes()),
   _mutator_alloc_regions(NULL),
   _survivor_gc_alloc_regions(NULL),
-  _old_gc_alloc_region(heap->alloc_buffer_stats(G1HeapRegionAttr::Old)),
-  _retained_old_gc_alloc_region(NULL) {
+  _old_gc_alloc_regions(NULL),
+  _retained_old_gc_alloc_regions(NULL) {
 
   _mutator_alloc_regions = NEW_C_HEAP_ARRAY(MutatorAllocRegion, _num_alloc_regions, mtGC);
   _survivor_gc_alloc_regions = NEW_C_HEAP_ARRAY(SurvivorGCAllocRegion, _num_alloc_regions, mtGC);
+  _old_gc_alloc_regions = NEW_C_HEAP_ARRAY(OldGCAllocRegion, _num_alloc_regions, mtGC);
+  _retained_old_gc_alloc_regions = NEW_C_HEAP_ARRAY(HeapRegion*, _num_alloc_regions, mtGC);
   G1EvacStats* stat = heap->alloc_buffer_stats(G1HeapRegionAttr::Young);
+  G1EvacStats* old_stat = heap->alloc_buffer_stats(G1HeapRegionAttr::Old);
 
   for (uint i = 0; i < _num_alloc_regions; i++) {
     ::new(_mutator_alloc_regions + i) MutatorAllocRegion(i);
     ::new(_survivor_gc_alloc_regions + i) SurvivorGCAllocRegion(stat, i);
+    ::new(_old_gc_alloc_regions + i) OldGCAllocRegion(old_stat, i);
+    _retained_old_gc_alloc_regions[i] = NULL;
   }
 }
 
@@ -61,9 +66,12 @@ G1Allocator::~G1Allocator() {
   for (uint i = 0; i < _num_alloc_regions; i++) {
     _mutator_alloc_regions[i].~MutatorAllocRegion();
     _survivor_gc_alloc_regions[i].~SurvivorGCAllocRegion();
+    _old_gc_alloc_regions[i].~OldGCAllocRegion();
   }
   FREE_C_HEAP_ARRAY(MutatorAllocRegion, _mutator_alloc_regions);
   FREE_C_HEAP_ARRAY(SurvivorGCAllocRegion, _survivor_gc_alloc_regions);
+  FREE_C_HEAP_ARRAY(OldGCAllocRegion, _old_gc_alloc_regions);
+  FREE_C_HEAP_ARRAY(HeapRegion*, _retained_old_gc_alloc_regions);
 }
 
 #ifdef ASSERT
@@ -88,7 +96,12 @@ void G1Allocator::release_mutator_alloc_regions() {
 }
 
 bool G1Allocator::is_retained_old_region(HeapRegion* hr) {
-  return _retained_old_gc_alloc_region == hr;
+  for (uint i = 0; i < _num_alloc_regions; i++) {
+    if (_retained_old_gc_alloc_regions[i] == hr) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void G1Allocator::reuse_retained_old_region(G1EvacInfo* evacuation_info,
@@ -120,7 +133,8 @@ void G1Allocator::reuse_retained_old_region(G1EvacInfo* evacuation_info,
     _g1h->old_set_remove(retained_region);
     old->set(retained_region);
     _g1h->hr_printer()->reuse(retained_region);
-    evacuation_info->set_alloc_regions_used_before(retained_region->used());
+    evacuation_info->set_alloc_regions_used_before(evacuation_info->alloc_regions_used_before() +
+                                                   retained_region->used());
   }
 }
 
@@ -134,35 +148,37 @@ void G1Allocator::init_gc_alloc_regions(G1EvacInfo* evacuation_info) {
     survivor_gc_alloc_region(i)->init();
   }
 
-  _old_gc_alloc_region.init();
-  reuse_retained_old_region(evacuation_info,
-                            &_old_gc_alloc_region,
-                            &_retained_old_gc_alloc_region);
+  for (uint i = 0; i < _num_alloc_regions; i++) {
+    old_gc_alloc_region(i)->init();
+    reuse_retained_old_region(evacuation_info,
+                              old_gc_alloc_region(i),
+                              &_retained_old_gc_alloc_regions[i]);
+  }
 }
 
 void G1Allocator::release_gc_alloc_regions(G1EvacInfo* evacuation_info) {
-  uint survivor_region_count = 0;
+  uint alloc_region_count = 0;
   for (uint node_index = 0; node_index < _num_alloc_regions; node_index++) {
-    survivor_region_count += survivor_gc_alloc_region(node_index)->count();
+    alloc_region_count += survivor_gc_alloc_region(node_index)->count();
     survivor_gc_alloc_region(node_index)->release();
   }
-  evacuation_info->set_allocation_regions(survivor_region_count +
-                                          old_gc_alloc_region()->count());
-
-  // If we have an old GC alloc region to release, we'll save it in
-  // _retained_old_gc_alloc_region. If we don't
-  // _retained_old_gc_alloc_region will become NULL. This is what we
-  // want either way so no reason to check explicitly for either
-  // condition.
-  _retained_old_gc_alloc_region = old_gc_alloc_region()->release();
+  for (uint node_index = 0; node_index < _num_alloc_regions; node_index++) {
+    alloc_region_count += old_gc_alloc_region(node_index)->count();
+    // If we have an old GC alloc region to release, we'll save it in
+    // _retained_old_gc_alloc_regions. If we don't the entry will
+    // become NULL. This is what we want either way so no reason to
+    // check explicitly for either condition.
+    _retained_old_gc_alloc_regions[node_index] = old_gc_alloc_region(node_index)->release();
+  }
+  evacuation_info->set_allocation_regions(alloc_region_count);
 }
 
 void G1Allocator::abandon_gc_alloc_regions() {
   for (uint i = 0; i < _num_alloc_regions; i++) {
     assert(survivor_gc_alloc_region(i)->get() == NULL, "pre-condition");
+    assert(old_gc_alloc_region(i)->get() == NULL, "pre-condition");
+    _retained_old_gc_alloc_regions[i] = NULL;
   }
-  assert(old_gc_alloc_region()->get() == NULL, "pre-condition");
-  _retained_old_gc_alloc_region = NULL;
 }
 
 bool G1Allocator::survivor_is_full() const {
@@ -229,7 +245,7 @@ HeapWord* G1Allocator::par_allocate_during_gc(G1HeapRegionAttr dest,
     case G1HeapRegionAttr::Young:
       return survivor_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     case G1HeapRegionAttr::Old:
-      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size);
+      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     default:
       ShouldNotReachHere();
       return NULL; // Keep some compilers happy
@@ -268,22 +284,23 @@ HeapWord* G1Allocator::survivor_attempt_allocation(size_t min_word_size,
 
 HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
                                               size_t desired_word_size,
-                                              size_t* actual_word_size) {
+                                              size_t* actual_word_size,
+                                              uint node_index) {
   assert(!_g1h->is_humongous(desired_word_size),
          "we should not be seeing humongous-size allocations in this path");
 
-  HeapWord* result = old_gc_alloc_region()->attempt_allocation(min_word_size,
-                                                               desired_word_size,
-                                                               actual_word_size);
+  HeapWord* result = old_gc_alloc_region(node_index)->attempt_allocation(min_word_size,
+                                                                         desired_word_size,
+                                                                         actual_word_size);
   if (result == NULL && !old_is_full()) {
     MutexLocker x(FreeList_lock, Mutex::_no_safepoint_check_flag);
     // Multiple threads may have queued at the FreeList_lock above after checking whether there
     // actually is still memory available. Redo the check under the lock to avoid unnecessary work;
     // the memory may have been used up as the threads waited to acquire the lock.
     if (!old_is_full()) {
-      result = old_gc_alloc_region()->attempt_allocation_locked(min_word_size,
-                                                                desired_word_size,
-                                                                actual_word_size);
+      result = old_gc_alloc_region(node_index)->attempt_allocation_locked(min_word_size,
+                                                                          desired_word_size,
+                                                                          actual_word_size);
       if (result == NULL) {
         set_old_full();
       }
@@ -294,7 +311,8 @@ HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
 
 G1PLABAllocator::G1PLABAllocator(G1Allocator* allocator) :
   _g1h(G1CollectedHeap::heap()),
-  _allocator(allocator) {
+  _allocator(allocator),
+  _off_node_allocated(0) {
   for (region_type_t state = 0; state < G1HeapRegionAttr::Num; state++) {
     _direct_allocated[state] = 0;
     uint length = alloc_buffers_length(state);
@@ -347,6 +365,7 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
            required_in_plab, plab_word_size, actual_plab_size, p2i(buf));
 
     if (buf != NULL) {
+      update_off_node_allocated(buf, actual_plab_size, node_index);
       alloc_buf->set_buf(buf, actual_plab_size);
 
       HeapWord* const obj = alloc_buf->allocate(word_sz);
@@ -362,10 +381,20 @@ HeapWord* G1PLABAllocator::allocate_direct_or_new_plab(G1HeapRegionAttr dest,
   HeapWord* result = _allocator->par_allocate_during_gc(dest, word_sz, node_index);
   if (result != NULL) {
     _direct_allocated[dest.type()] += word_sz;
+    update_off_node_allocated(result, word_sz, node_index);
   }
   return result;
 }
 
+void G1PLABAllocator::update_off_node_allocated(HeapWord* addr, size_t word_sz, uint node_index) {
+  // The allocator falls back to regions on other nodes if there are no free
+  // regions on the requested node.
+  if (_allocator->num_nodes() > 1 &&
+      _g1h->heap_region_containing(addr)->node_index() != node_index) {
+    _off_node_allocated += word_sz;
+  }
+}
+
 void G1PLABAllocator::undo_allocation(G1HeapRegionAttr dest, HeapWord* obj, size_t word_sz, uint node_index) {
   alloc_buffer(dest, node_index)->undo_allocation(obj, word_sz);
 }
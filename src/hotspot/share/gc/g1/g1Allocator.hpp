@@ -56,11 +56,12 @@ private:
   // survivor objects.
   SurvivorGCAllocRegion* _survivor_gc_alloc_regions;
 
-  // Alloc region used to satisfy allocation requests by the GC for
-  // old objects.
-  OldGCAllocRegion _old_gc_alloc_region;
+  // Alloc regions used to satisfy allocation requests by the GC for
+  // old objects, one per memory node.
+  OldGCAllocRegion* _old_gc_alloc_regions;
 
-  HeapRegion* _retained_old_gc_alloc_region;
+  // The old GC alloc regions retained from the last GC, one per memory node.
+  HeapRegion** _retained_old_gc_alloc_regions;
 
   bool survivor_is_full() const;
   bool old_is_full() const;
@@ -75,7 +76,7 @@ private:
   // Accessors to the allocation regions.
   inline MutatorAllocRegion* mutator_alloc_region(uint node_index);
   inline SurvivorGCAllocRegion* survivor_gc_alloc_region(uint node_index);
-  inline OldGCAllocRegion* old_gc_alloc_region();
+  inline OldGCAllocRegion* old_gc_alloc_region(uint node_index);
 
   // Allocation attempt during GC for a survivor object / PLAB.
   HeapWord* survivor_attempt_allocation(size_t min_word_size,
@@ -86,7 +87,8 @@ private:
   // Allocation attempt during GC for an old object / PLAB.
   HeapWord* old_attempt_allocation(size_t min_word_size,
                                    size_t desired_word_size,
-                                   size_t* actual_word_size);
+                                   size_t* actual_word_size,
+                                   uint node_index);
 
   // Node index of current thread.
   inline uint current_node_index() const;
@@ -161,13 +163,18 @@ private:
   // Number of words allocated directly (not counting PLAB allocation).
   size_t _direct_allocated[G1HeapRegionAttr::Num];
 
+  // Number of words allocated (as PLABs or directly) in regions on another
+  // memory node than the one requested.
+  size_t _off_node_allocated;
+
+  void update_off_node_allocated(HeapWord* addr, size_t word_sz, uint node_index);
+
   void flush_and_retire_stats();
   inline PLAB* alloc_buffer(G1HeapRegionAttr dest, uint node_index) const;
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
 
-  // Returns the number of allocation buffers for the given dest.
-  // There is only 1 buffer for Old while Young may have multiple buffers depending on
-  // active NUMA nodes.
+  // Returns the number of allocation buffers for the given dest, one per
+  // active NUMA node.
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
@@ -177,6 +184,7 @@ public:
 
   size_t waste() const;
   size_t undo_waste() const;
+  size_t off_node_allocated() const { return _off_node_allocated; }
 
   // Allocate word_sz words in dest, either directly into the regions or by
   // allocating a new PLAB. Returns the address of the allocated memory, NULL if
@@ -26,6 +26,7 @@
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1Predictions.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/debug.hpp"
@@ -71,6 +72,10 @@ static double non_young_other_cost_per_region_ms_defaults[] = {
   1.0, 0.7, 0.7, 0.5, 0.5, 0.42, 0.42, 0.30
 };
 
+// Weight of the previous samples in the linear regression models on every new
+// sample; matches the default decay of TruncatedSeq.
+static const double time_model_decay_factor = 0.7;
+
 G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _predictor(predictor),
     _recent_gc_times_ms(new TruncatedSeq(NumPrevPausesForHeuristics)),
@@ -94,6 +99,12 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _pending_cards_seq(new TruncatedSeq(TruncatedSeqLength)),
     _rs_length_seq(new TruncatedSeq(TruncatedSeqLength)),
     _cost_per_byte_ms_during_cm_seq(new TruncatedSeq(TruncatedSeqLength)),
+    _young_card_scan_time_model(time_model_decay_factor),
+    _mixed_card_scan_time_model(time_model_decay_factor),
+    _young_card_merge_time_model(time_model_decay_factor),
+    _mixed_card_merge_time_model(time_model_decay_factor),
+    _copy_time_model(time_model_decay_factor),
+    _copy_time_during_cm_model(time_model_decay_factor),
     _recent_prev_end_times_for_all_gcs_sec(new TruncatedSeq(NumPrevPausesForHeuristics)),
     _long_term_pause_time_ratio(0.0),
     _short_term_pause_time_ratio(0.0) {
@@ -138,6 +149,53 @@ double G1Analytics::predict_zero_bounded(TruncatedSeq const* seq) const {
   return _predictor->predict_zero_bounded(seq);
 }
 
+bool G1Analytics::use_model(G1LinearRegression const* model) const {
+  return G1UseLinearRegressionPrediction && model->num_samples() >= 3;
+}
+
+G1LinearRegression const* G1Analytics::card_scan_time_model(bool for_young_gc) const {
+  if (for_young_gc || !use_model(&_mixed_card_scan_time_model)) {
+    return &_young_card_scan_time_model;
+  } else {
+    return &_mixed_card_scan_time_model;
+  }
+}
+
+G1LinearRegression const* G1Analytics::card_merge_time_model(bool for_young_gc) const {
+  if (for_young_gc || !use_model(&_mixed_card_merge_time_model)) {
+    return &_young_card_merge_time_model;
+  } else {
+    return &_mixed_card_merge_time_model;
+  }
+}
+
+G1LinearRegression const* G1Analytics::copy_time_model(bool during_concurrent_mark) const {
+  if (!during_concurrent_mark || !use_model(&_copy_time_during_cm_model)) {
+    return &_copy_time_model;
+  } else {
+    return &_copy_time_during_cm_model;
+  }
+}
+
+double G1Analytics::predict_phase_overhead_time_ms(G1LinearRegression const* model) const {
+  if (!use_model(model)) {
+    return 0.0;
+  }
+  return model->intercept() + _predictor->sigma() * model->residual_stddev();
+}
+
+static void log_prediction(const char* phase, const char* gc_type, double predicted_ms, double actual_ms) {
+  log_debug(gc, ergo, predict)("%s (%s): predicted %.3fms actual %.3fms error %.3fms (%s)",
+                               phase, gc_type, predicted_ms, actual_ms, predicted_ms - actual_ms,
+                               G1UseLinearRegressionPrediction ? "regression" : "cost per unit");
+}
+
+static void log_model(const char* phase, const char* gc_type, G1LinearRegression const* model) {
+  log_trace(gc, ergo, predict)("%s (%s) model: %.3fms + %.9fms/unit residual stddev %.3fms samples %u",
+                               phase, gc_type, model->intercept(), model->slope(),
+                               model->residual_stddev(), model->num_samples());
+}
+
 int G1Analytics::num_alloc_rate_ms() const {
   return _alloc_rate_ms_seq->num();
 }
@@ -205,6 +263,42 @@ void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool mark_or_
   }
 }
 
+void G1Analytics::report_card_scan_time_ms(size_t card_num, double time_ms, bool for_young_gc) {
+  const char* gc_type = for_young_gc ? "Young" : "Mixed";
+  log_prediction("Card Scan", gc_type,
+                 predict_card_scan_time_ms(card_num, for_young_gc) +
+                 predict_phase_overhead_time_ms(card_scan_time_model(for_young_gc)),
+                 time_ms);
+
+  G1LinearRegression* model = for_young_gc ? &_young_card_scan_time_model : &_mixed_card_scan_time_model;
+  model->add(card_num, time_ms);
+  log_model("Card Scan", gc_type, model);
+}
+
+void G1Analytics::report_card_merge_time_ms(size_t card_num, double time_ms, bool for_young_gc) {
+  const char* gc_type = for_young_gc ? "Young" : "Mixed";
+  log_prediction("Card Merge", gc_type,
+                 predict_card_merge_time_ms(card_num, for_young_gc) +
+                 predict_phase_overhead_time_ms(card_merge_time_model(for_young_gc)),
+                 time_ms);
+
+  G1LinearRegression* model = for_young_gc ? &_young_card_merge_time_model : &_mixed_card_merge_time_model;
+  model->add(card_num, time_ms);
+  log_model("Card Merge", gc_type, model);
+}
+
+void G1Analytics::report_object_copy_time_ms(size_t bytes_copied, double time_ms, bool mark_or_rebuild_in_progress) {
+  const char* gc_type = mark_or_rebuild_in_progress ? "During Marking" : "Not Marking";
+  log_prediction("Object Copy", gc_type,
+                 predict_object_copy_time_ms(bytes_copied, mark_or_rebuild_in_progress) +
+                 predict_phase_overhead_time_ms(copy_time_model(mark_or_rebuild_in_progress)),
+                 time_ms);
+
+  G1LinearRegression* model = mark_or_rebuild_in_progress ? &_copy_time_during_cm_model : &_copy_time_model;
+  model->add(bytes_copied, time_ms);
+  log_model("Object Copy", gc_type, model);
+}
+
 void G1Analytics::report_young_other_cost_per_region_ms(double other_cost_per_region_ms) {
   _young_other_cost_per_region_ms_seq->add(other_cost_per_region_ms);
 }
@@ -250,6 +344,10 @@ size_t G1Analytics::predict_scan_card_num(size_t rs_length, bool for_young_gc) c
 }
 
 double G1Analytics::predict_card_merge_time_ms(size_t card_num, bool for_young_gc) const {
+  G1LinearRegression const* model = card_merge_time_model(for_young_gc);
+  if (use_model(model)) {
+    return card_num * model->slope();
+  }
   if (for_young_gc || !enough_samples_available(_mixed_cost_per_card_merge_ms_seq)) {
     return card_num * predict_zero_bounded(_young_cost_per_card_merge_ms_seq);
   } else {
@@ -258,6 +356,10 @@ double G1Analytics::predict_card_merge_time_ms(size_t card_num, bool for_young_g
 }
 
 double G1Analytics::predict_card_scan_time_ms(size_t card_num, bool for_young_gc) const {
+  G1LinearRegression const* model = card_scan_time_model(for_young_gc);
+  if (use_model(model)) {
+    return card_num * model->slope();
+  }
   if (for_young_gc || !enough_samples_available(_mixed_cost_per_card_scan_ms_seq)) {
     return card_num * predict_zero_bounded(_young_cost_per_card_scan_ms_seq);
   } else {
@@ -274,6 +376,10 @@ double G1Analytics::predict_object_copy_time_ms_during_cm(size_t bytes_to_copy)
 }
 
 double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool during_concurrent_mark) const {
+  G1LinearRegression const* model = copy_time_model(during_concurrent_mark);
+  if (use_model(model)) {
+    return bytes_to_copy * model->slope();
+  }
   if (during_concurrent_mark) {
     return predict_object_copy_time_ms_during_cm(bytes_to_copy);
   } else {
@@ -281,6 +387,12 @@ double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool durin
   }
 }
 
+double G1Analytics::predict_fixed_phase_time_ms(bool for_young_gc, bool during_concurrent_mark) const {
+  return predict_phase_overhead_time_ms(card_merge_time_model(for_young_gc)) +
+         predict_phase_overhead_time_ms(card_scan_time_model(for_young_gc)) +
+         predict_phase_overhead_time_ms(copy_time_model(during_concurrent_mark));
+}
+
 double G1Analytics::predict_constant_other_time_ms() const {
   return predict_zero_bounded(_constant_other_time_ms_seq);
 }
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_G1ANALYTICS_HPP
 #define SHARE_GC_G1_G1ANALYTICS_HPP
 
+#include "gc/g1/g1LinearRegression.hpp"
 #include "memory/allocation.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -72,6 +73,16 @@ class G1Analytics: public CHeapObj<mtGC> {
 
   TruncatedSeq* _cost_per_byte_ms_during_cm_seq;
 
+  // Models of the phase time in ms depending on the amount of work in the
+  // phase, used instead of the cost per unit sequences above if
+  // G1UseLinearRegressionPrediction is set.
+  G1LinearRegression _young_card_scan_time_model;
+  G1LinearRegression _mixed_card_scan_time_model;
+  G1LinearRegression _young_card_merge_time_model;
+  G1LinearRegression _mixed_card_merge_time_model;
+  G1LinearRegression _copy_time_model;
+  G1LinearRegression _copy_time_during_cm_model;
+
   // Statistics kept per GC stoppage, pause or full.
   TruncatedSeq* _recent_prev_end_times_for_all_gcs_sec;
 
@@ -88,6 +99,17 @@ class G1Analytics: public CHeapObj<mtGC> {
   size_t predict_size(TruncatedSeq const* seq) const;
   double predict_zero_bounded(TruncatedSeq const* seq) const;
 
+  // Returns whether the given model should be used for prediction.
+  bool use_model(G1LinearRegression const* model) const;
+
+  G1LinearRegression const* card_scan_time_model(bool for_young_gc) const;
+  G1LinearRegression const* card_merge_time_model(bool for_young_gc) const;
+  G1LinearRegression const* copy_time_model(bool during_concurrent_mark) const;
+
+  // The time of a phase that does not depend on the amount of work in it,
+  // including the safety margin for the prediction error.
+  double predict_phase_overhead_time_ms(G1LinearRegression const* model) const;
+
   double oldest_known_gc_end_time_sec() const;
   double most_recent_gc_end_time_sec() const;
 
@@ -133,6 +155,10 @@ public:
   void report_constant_other_time_ms(double constant_other_time_ms);
   void report_pending_cards(double pending_cards);
   void report_rs_length(double rs_length);
+  // Report the total time of a phase and the amount of work it did.
+  void report_card_scan_time_ms(size_t card_num, double time_ms, bool for_young_gc);
+  void report_card_merge_time_ms(size_t card_num, double time_ms, bool for_young_gc);
+  void report_object_copy_time_ms(size_t bytes_copied, double time_ms, bool mark_or_rebuild_in_progress);
 
   double predict_alloc_rate_ms() const;
   int num_alloc_rate_ms() const;
@@ -152,6 +178,13 @@ public:
 
   double predict_object_copy_time_ms(size_t bytes_to_copy, bool during_concurrent_mark) const;
 
+  // The card merge, card scan and object copy predictions above only cover the
+  // time proportional to the amount of work so that they can be summed up
+  // over regions. This is the remaining time for these phases that is spent once
+  // per pause. Always zero if the prediction is not based on the linear
+  // regression models.
+  double predict_fixed_phase_time_ms(bool for_young_gc, bool during_concurrent_mark) const;
+
   double predict_constant_other_time_ms() const;
 
   double predict_young_other_time_ms(size_t young_num) const;
@@ -32,9 +32,11 @@
 #include "memory/allocation.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
 
 G1CardSet::ContainerPtr G1CardSet::FullCardSet = (G1CardSet::ContainerPtr)-1;
 
@@ -923,6 +925,56 @@ void G1CardSet::clear() {
   _mm->flush();
 }
 
+size_t G1CardSet::coarsen_to_full_at_safepoint() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be");
+
+  struct ContainerToKeep {
+    uint _region_idx;
+    size_t _num_occupied;
+    ContainerPtr _container;
+  };
+
+  class CollectContainers : public ContainerPtrClosure {
+    const uint _max_cards_in_region;
+  public:
+    GrowableArrayCHeap<ContainerToKeep, mtGCCardSet> _containers;
+    size_t _num_coarsened;
+
+    CollectContainers(uint max_cards_in_region) :
+      _max_cards_in_region(max_cards_in_region), _containers(), _num_coarsened(0) { }
+
+    void do_containerptr(uint region_idx, size_t num_occupied, ContainerPtr container) override {
+      if (container_type(container) == ContainerInlinePtr || container == FullCardSet) {
+        _containers.append({ region_idx, num_occupied, container });
+      } else {
+        _containers.append({ region_idx, _max_cards_in_region, FullCardSet });
+        _num_coarsened++;
+      }
+    }
+  } cl(_config->max_cards_in_region());
+
+  iterate_containers(&cl, true /* at_safepoint */);
+  if (cl._num_coarsened == 0) {
+    return 0;
+  }
+
+  // Rebuild the card set from scratch so that the memory manager can return all
+  // memory of the coarsened containers.
+  clear();
+  for (int i = 0; i < cl._containers.length(); i++) {
+    const ContainerToKeep& c = cl._containers.at(i);
+    bool should_grow_table = false;
+    G1CardSetHashTableValue* table_entry = get_or_add_container(c._region_idx, &should_grow_table);
+    table_entry->_container = c._container;
+    table_entry->_num_occupied = c._num_occupied;
+    Atomic::add(&_num_occupied, c._num_occupied, memory_order_relaxed);
+    if (should_grow_table) {
+      _table->grow();
+    }
+  }
+  return cl._num_coarsened;
+}
+
 void G1CardSet::print(outputStream* os) {
   _table->print(os);
   _mm->print(os);
@@ -331,6 +331,12 @@ public:
   // Clear the entire contents of this remembered set.
   void clear();
 
+  // Replace all containers that use memory by Full containers and release that
+  // memory; inline pointer containers are kept. Trades remembered set memory
+  // for more cards to scan. Returns the number of coarsened containers.
+  // Must be called at a safepoint.
+  size_t coarsen_to_full_at_safepoint();
+
   void print(outputStream* os);
 
   // Iterate over the container, calling a method on every card or card range contained
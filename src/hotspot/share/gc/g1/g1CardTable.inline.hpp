@@ -28,6 +28,7 @@
 #include "gc/g1/g1CardTable.hpp"
 
 #include "gc/g1/heapRegion.hpp"
+#include "utilities/align.hpp"
 
 inline uint G1CardTable::region_idx_for(CardValue* p) {
   size_t const card_idx = pointer_delta(p, _byte_map, sizeof(CardValue));
@@ -81,6 +82,20 @@ inline size_t G1CardTable::mark_range_dirty(size_t start_card_index, size_t num_
 inline void G1CardTable::change_dirty_cards_to(size_t start_card_index, size_t num_cards, CardValue which) {
   CardValue* start = &_byte_map[start_card_index];
   CardValue* const end = start + num_cards;
+  // Process cards up to word alignment one by one, then whole words of cards.
+  while (start < end && !is_aligned(start, sizeof(size_t))) {
+    CardValue value = *start;
+    assert(value == dirty_card_val(),
+           "Must have been dirty %d start " PTR_FORMAT " " PTR_FORMAT, value, p2i(start), p2i(end));
+    *start++ = which;
+  }
+  size_t const which_word = (SIZE_MAX / 255) * which;
+  while (pointer_delta(end, start, sizeof(CardValue)) >= sizeof(size_t)) {
+    assert(*(size_t*)start == WordAllDirty,
+           "Must have been dirty " SIZE_FORMAT_X " start " PTR_FORMAT " " PTR_FORMAT, *(size_t*)start, p2i(start), p2i(end));
+    *(size_t*)start = which_word;
+    start += sizeof(size_t);
+  }
   while (start < end) {
     CardValue value = *start;
     assert(value == dirty_card_val(),
@@ -33,11 +33,13 @@
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/hashtable.inline.hpp"
 #include "utilities/stack.inline.hpp"
 
 G1CodeRootSetTable* volatile G1CodeRootSetTable::_purge_list = NULL;
+G1CodeRootSetTable* volatile G1CodeRootSetTable::_pending_purge_list = NULL;
 
 size_t G1CodeRootSetTable::mem_size() {
   return sizeof(G1CodeRootSetTable) + (entry_size() * number_of_entries()) + (sizeof(HashtableBucket<mtGC>) * table_size());
@@ -164,9 +166,7 @@ void G1CodeRootSetTable::purge_list_append(G1CodeRootSetTable* table) {
   }
 }
 
-void G1CodeRootSetTable::purge() {
-  G1CodeRootSetTable* table = _purge_list;
-  _purge_list = NULL;
+void G1CodeRootSetTable::delete_tables(G1CodeRootSetTable* table) {
   while (table != NULL) {
     G1CodeRootSetTable* to_purge = table;
     table = table->_purge_next;
@@ -174,6 +174,32 @@ void G1CodeRootSetTable::purge() {
   }
 }
 
+void G1CodeRootSetTable::purge() {
+  delete_tables(Atomic::xchg(&_pending_purge_list, (G1CodeRootSetTable*)NULL));
+  delete_tables(_purge_list);
+  _purge_list = NULL;
+}
+
+void G1CodeRootSetTable::prepare_concurrent_purge() {
+  assert_at_safepoint();
+  G1CodeRootSetTable* table = _purge_list;
+  if (table == NULL) {
+    return;
+  }
+  _purge_list = NULL;
+
+  G1CodeRootSetTable* last = table;
+  while (last->_purge_next != NULL) {
+    last = last->_purge_next;
+  }
+  last->_purge_next = Atomic::xchg(&_pending_purge_list, (G1CodeRootSetTable*)NULL);
+  Atomic::release_store(&_pending_purge_list, table);
+}
+
+void G1CodeRootSetTable::purge_pending() {
+  delete_tables(Atomic::xchg(&_pending_purge_list, (G1CodeRootSetTable*)NULL));
+}
+
 void G1CodeRootSet::move_to_large() {
   G1CodeRootSetTable* temp = new G1CodeRootSetTable(LargeSize);
 
@@ -188,6 +214,14 @@ void G1CodeRootSet::purge() {
   G1CodeRootSetTable::purge();
 }
 
+void G1CodeRootSet::prepare_concurrent_purge() {
+  G1CodeRootSetTable::prepare_concurrent_purge();
+}
+
+void G1CodeRootSet::purge_pending() {
+  G1CodeRootSetTable::purge_pending();
+}
+
 size_t G1CodeRootSet::static_mem_size() {
   return G1CodeRootSetTable::static_mem_size();
 }
@@ -52,7 +52,13 @@ class G1CodeRootSet {
   G1CodeRootSet() : _table(NULL), _length(0) {}
   ~G1CodeRootSet();
 
+  // Free the memory of tables replaced since the last purge. Must be called
+  // at a safepoint.
   static void purge();
+  // Split purge() into a part at the safepoint, and a part that can be run
+  // concurrently afterwards.
+  static void prepare_concurrent_purge();
+  static void purge_pending();
 
   static size_t static_mem_size();
 
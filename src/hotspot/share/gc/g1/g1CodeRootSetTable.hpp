@@ -33,6 +33,9 @@ class G1CodeRootSetTable : public Hashtable<nmethod*, mtGC> {
   typedef HashtableEntry<nmethod*, mtGC> Entry;
 
   static G1CodeRootSetTable* volatile _purge_list;
+  // Tables taken off the purge list at a safepoint. No thread can be
+  // accessing them any more, so they can be freed concurrently.
+  static G1CodeRootSetTable* volatile _pending_purge_list;
 
   G1CodeRootSetTable* _purge_next;
 
@@ -44,6 +47,8 @@ class G1CodeRootSetTable : public Hashtable<nmethod*, mtGC> {
   void remove_entry(Entry* e, Entry* previous);
   Entry* new_entry(nmethod* nm);
 
+  static void delete_tables(G1CodeRootSetTable* table);
+
  public:
   G1CodeRootSetTable(int size) : Hashtable<nmethod*, mtGC>(size, sizeof(Entry)), _purge_next(NULL) {}
   ~G1CodeRootSetTable();
@@ -65,9 +70,13 @@ class G1CodeRootSetTable : public Hashtable<nmethod*, mtGC> {
 
   static void purge_list_append(G1CodeRootSetTable* tbl);
   static void purge();
+  // Move the tables on the purge list to the pending purge list at a safepoint.
+  static void prepare_concurrent_purge();
+  // Free the tables on the pending purge list. Can be called concurrently.
+  static void purge_pending();
 
   static size_t static_mem_size() {
-    return sizeof(_purge_list);
+    return sizeof(_purge_list) + sizeof(_pending_purge_list);
   }
 
   size_t mem_size();
@@ -58,6 +58,7 @@
 #include "gc/g1/g1ParScanThreadState.inline.hpp"
 #include "gc/g1/g1PeriodicGCTask.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1PurgeCodeRootMemoryTask.hpp"
 #include "gc/g1/g1RedirtyCardsQueue.hpp"
 #include "gc/g1/g1RegionToSpaceMapper.hpp"
 #include "gc/g1/g1RemSet.hpp"
@@ -1432,6 +1433,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _service_thread(NULL),
   _periodic_gc_task(NULL),
   _free_segmented_array_memory_task(NULL),
+  _purge_code_root_memory_task(NULL),
   _workers(NULL),
   _card_table(NULL),
   _collection_pause_end(Ticks::now()),
@@ -1729,6 +1731,9 @@ jint G1CollectedHeap::initialize() {
   _free_segmented_array_memory_task = new G1SegmentedArrayFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_segmented_array_memory_task);
 
+  _purge_code_root_memory_task = new G1PurgeCodeRootMemoryTask("Purge Code Root Memory Task");
+  _service_thread->register_task(_purge_code_root_memory_task);
+
   // Here we allocate the dummy HeapRegion that is required by the
   // G1AllocRegion class.
   HeapRegion* dummy_region = _hrm.get_dummy_region();
@@ -2237,6 +2242,17 @@ bool G1CollectedHeap::is_in(const void* p) const {
   return is_in_reserved(p) && _hrm.is_available(addr_to_region((HeapWord*)p));
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(G1RegionPinning, "must be");
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(G1RegionPinning, "must be");
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 // Iteration functions.
 
 // Iterates an ObjectClosure over all objects within a HeapRegion.
@@ -3413,6 +3429,10 @@ void G1CollectedHeap::purge_code_root_memory() {
   G1CodeRootSet::purge();
 }
 
+void G1CollectedHeap::purge_code_root_memory_concurrently() {
+  _purge_code_root_memory_task->notify_purge_pending();
+}
+
 class RebuildCodeRootClosure: public CodeBlobClosure {
   G1CollectedHeap* _g1h;
 
@@ -75,6 +75,7 @@ class G1GCPhaseTimes;
 class G1HeapSizingPolicy;
 class G1HotCardCache;
 class G1NewTracer;
+class G1PurgeCodeRootMemoryTask;
 class G1RemSet;
 class G1ServiceTask;
 class G1ServiceThread;
@@ -145,6 +146,7 @@ private:
   G1ServiceThread* _service_thread;
   G1ServiceTask* _periodic_gc_task;
   G1SegmentedArrayFreeMemoryTask* _free_segmented_array_memory_task;
+  G1PurgeCodeRootMemoryTask* _purge_code_root_memory_task;
 
   WorkerThreads* _workers;
   G1CardTable* _card_table;
@@ -1042,6 +1044,12 @@ public:
 
   bool is_in(const void* p) const override;
 
+  // Support for JNI critical sections by pinning the region containing the
+  // object instead of blocking garbage collection with the GCLocker.
+  bool supports_object_pinning() const override { return G1RegionPinning; }
+  oop pin_object(JavaThread* thread, oop obj) override;
+  void unpin_object(JavaThread* thread, oop obj) override;
+
   // Return "TRUE" iff the given object address is within the collection
   // set. Assumes that the reference points into the heap.
   inline bool is_in_cset(const HeapRegion *hr);
@@ -1283,6 +1291,8 @@ public:
   void reset_hot_card_cache();
   // Free up superfluous code root memory.
   void purge_code_root_memory();
+  // Free up superfluous code root memory after the pause.
+  void purge_code_root_memory_concurrently();
 
   // Rebuild the code root lists for each region
   // after a full GC.
@@ -476,9 +476,9 @@ void G1CollectionSet::finalize_old_part(double time_remaining_ms) {
   QuickSort::sort(_collection_set_regions, _collection_set_cur_length, compare_region_idx, true);
 }
 
-void G1CollectionSet::move_candidates_to_collection_set(uint num_old_candidate_regions) {
+uint G1CollectionSet::move_candidates_to_collection_set(uint num_old_candidate_regions) {
   if (num_old_candidate_regions == 0) {
-    return;
+    return 0;
   }
   uint candidate_idx = candidates()->cur_idx();
   for (uint i = 0; i < num_old_candidate_regions; i++) {
@@ -486,11 +486,20 @@ void G1CollectionSet::move_candidates_to_collection_set(uint num_old_candidate_r
     // This potentially optional candidate region is going to be an actual collection
     // set region. Clear cset marker.
     _g1h->clear_region_attr(r);
+    if (r->has_pinned_objects()) {
+      // Keep regions with objects pinned by JNI critical sections out of the
+      // collection set; they would only fail evacuation. They stay candidates
+      // for a later collection, and their remembered sets are still needed.
+      log_debug(gc, ergo, cset)("Skipping pinned old region %u", r->hrm_index());
+      _g1h->register_region_with_region_attr(r);
+      continue;
+    }
     add_old_region(r);
   }
-  candidates()->remove(num_old_candidate_regions);
+  uint num_moved = candidates()->remove_unpinned(num_old_candidate_regions);
 
   candidates()->verify();
+  return num_moved;
 }
 
 void G1CollectionSet::finalize_initial_collection_set(double target_pause_time_ms, G1SurvivorRegions* survivor) {
@@ -507,15 +516,16 @@ bool G1CollectionSet::finalize_optional_for_evacuation(double remaining_pause_ti
                                                      remaining_pause_time,
                                                      num_selected_regions);
 
-  move_candidates_to_collection_set(num_selected_regions);
+  // Selected regions with pinned objects stay at the front of the optional regions.
+  uint num_moved_regions = move_candidates_to_collection_set(num_selected_regions);
 
-  _num_optional_regions -= num_selected_regions;
+  _num_optional_regions -= num_moved_regions;
 
   stop_incremental_building();
 
   _g1h->verify_region_attr_remset_is_tracked();
 
-  return num_selected_regions > 0;
+  return num_moved_regions > 0;
 }
 
 void G1CollectionSet::abandon_optional_collection_set(G1ParScanThreadStateSet* pss) {
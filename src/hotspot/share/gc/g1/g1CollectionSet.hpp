@@ -241,7 +241,8 @@ class G1CollectionSet {
   // Add old region "hr" to optional collection set.
   void add_optional_region(HeapRegion* hr);
 
-  void move_candidates_to_collection_set(uint num_regions);
+  // Returns the number of regions moved; candidates with pinned objects are kept.
+  uint move_candidates_to_collection_set(uint num_regions);
 
   // Finalize the young part of the initial collection set. Relabel survivor regions
   // as Eden and calculate a prediction on how long the evacuation of all young regions
@@ -35,6 +35,25 @@ void G1CollectionSetCandidates::remove(uint num_regions) {
   }
 }
 
+uint G1CollectionSetCandidates::remove_unpinned(uint num_regions) {
+  assert(num_regions <= num_remaining(), "Trying to remove more regions (%u) than available (%u)", num_regions, num_remaining());
+  // Compact the pinned regions towards the end of the range, which keeps the
+  // candidates sorted by decreasing gc efficiency.
+  const uint end_idx = _front_idx + num_regions;
+  uint new_front_idx = end_idx;
+  for (uint i = end_idx; i > _front_idx; i--) {
+    HeapRegion* r = _regions[i - 1];
+    if (r->has_pinned_objects()) {
+      _regions[--new_front_idx] = r;
+    } else {
+      _remaining_reclaimable_bytes -= r->reclaimable_bytes();
+    }
+  }
+  const uint num_removed = new_front_idx - _front_idx;
+  _front_idx = new_front_idx;
+  return num_removed;
+}
+
 void G1CollectionSetCandidates::remove_from_end(uint num_remove, size_t wasted) {
   assert(num_remove <= num_remaining(), "trying to remove more regions than remaining");
 
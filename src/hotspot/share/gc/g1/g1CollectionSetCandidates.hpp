@@ -76,6 +76,10 @@ public:
 
   // Remove num_regions from the front of the collection set candidate list.
   void remove(uint num_regions);
+  // Remove num_regions from the front of the collection set candidate list, except
+  // for the regions with pinned objects. These stay at the front, in their order, to
+  // be considered again. Returns the number of regions removed.
+  uint remove_unpinned(uint num_regions);
   // Remove num_remove regions from the back of the collection set candidate list.
   void remove_from_end(uint num_remove, size_t wasted);
 
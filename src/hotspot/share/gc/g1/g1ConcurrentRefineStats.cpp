@@ -29,7 +29,9 @@ G1ConcurrentRefineStats::G1ConcurrentRefineStats() :
   _refinement_time(),
   _refined_cards(0),
   _precleaned_cards(0),
-  _dirtied_cards(0)
+  _dirtied_cards(0),
+  _hot_card_cache_hits(0),
+  _hot_card_cache_misses(0)
 {}
 
 double G1ConcurrentRefineStats::refinement_rate_ms() const {
@@ -44,6 +46,8 @@ G1ConcurrentRefineStats::operator+=(const G1ConcurrentRefineStats& other) {
   _refined_cards += other._refined_cards;
   _precleaned_cards += other._precleaned_cards;
   _dirtied_cards += other._dirtied_cards;
+  _hot_card_cache_hits += other._hot_card_cache_hits;
+  _hot_card_cache_misses += other._hot_card_cache_misses;
   return *this;
 }
 
@@ -58,6 +62,8 @@ G1ConcurrentRefineStats::operator-=(const G1ConcurrentRefineStats& other) {
   _refined_cards = clipped_sub(_refined_cards, other._refined_cards);
   _precleaned_cards = clipped_sub(_precleaned_cards, other._precleaned_cards);
   _dirtied_cards = clipped_sub(_dirtied_cards, other._dirtied_cards);
+  _hot_card_cache_hits = clipped_sub(_hot_card_cache_hits, other._hot_card_cache_hits);
+  _hot_card_cache_misses = clipped_sub(_hot_card_cache_misses, other._hot_card_cache_misses);
   return *this;
 }
 
@@ -37,6 +37,8 @@ class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
   size_t _refined_cards;
   size_t _precleaned_cards;
   size_t _dirtied_cards;
+  size_t _hot_card_cache_hits;
+  size_t _hot_card_cache_misses;
 
 public:
   G1ConcurrentRefineStats();
@@ -57,10 +59,20 @@ public:
   // Number of cards marked dirty and in need of refinement.
   size_t dirtied_cards() const { return _dirtied_cards; }
 
+  // Number of hot cards whose refinement was delayed by inserting them into
+  // the hot card cache.
+  size_t hot_card_cache_hits() const { return _hot_card_cache_hits; }
+
+  // Number of cards passed to the hot card cache that were not yet hot and
+  // so were refined immediately.
+  size_t hot_card_cache_misses() const { return _hot_card_cache_misses; }
+
   void inc_refinement_time(Tickspan t) { _refinement_time += t; }
   void inc_refined_cards(size_t cards) { _refined_cards += cards; }
   void inc_precleaned_cards(size_t cards) { _precleaned_cards += cards; }
   void inc_dirtied_cards(size_t cards) { _dirtied_cards += cards; }
+  void inc_hot_card_cache_hits(size_t cards) { _hot_card_cache_hits += cards; }
+  void inc_hot_card_cache_misses(size_t cards) { _hot_card_cache_misses += cards; }
 
   G1ConcurrentRefineStats& operator+=(const G1ConcurrentRefineStats& other);
   G1ConcurrentRefineStats& operator-=(const G1ConcurrentRefineStats& other);
@@ -383,10 +383,10 @@ class G1RefineBufferedCards : public StackObj {
     assert(src <= dst, "invariant");
     for ( ; src < dst; ++src) {
       // Search low to high for a card to keep.
-      if (_g1rs->clean_card_before_refine(src)) {
+      if (_g1rs->clean_card_before_refine(src, _stats)) {
         // Found keeper.  Search high to low for a card to discard.
         while (src < --dst) {
-          if (!_g1rs->clean_card_before_refine(dst)) {
+          if (!_g1rs->clean_card_before_refine(dst, _stats)) {
             *dst = *src;         // Replace discard with keeper.
             break;
           }
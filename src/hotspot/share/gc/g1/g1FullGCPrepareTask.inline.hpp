@@ -50,6 +50,10 @@ inline bool G1DetermineCompactionQueueClosure::should_compact(HeapRegion* hr) co
   if (hr->is_pinned()) {
     return false;
   }
+  // Objects pinned by JNI critical sections must not move.
+  if (hr->has_pinned_objects()) {
+    return false;
+  }
   size_t live_words = _collector->live_words(hr->hrm_index());
   size_t live_words_threshold = _collector->scope()->region_compaction_threshold();
   // High live ratio region will not be compacted.
@@ -96,10 +100,10 @@ inline bool G1DetermineCompactionQueueClosure::do_heap_region(HeapRegion* hr) {
     } else if (hr->is_closed_archive()) {
       // nothing to do with closed archive region
     } else {
-      assert(MarkSweepDeadRatio > 0,
+      assert(MarkSweepDeadRatio > 0 || hr->has_pinned_objects(),
              "only skip compaction for other regions when MarkSweepDeadRatio > 0");
 
-      // Too many live objects in the region; skip compacting it.
+      // Too many live objects in the region or it contains pinned objects; skip compacting it.
       _collector->update_from_compacting_to_skip_compacting(hr->hrm_index());
       log_trace(gc, phases)("Phase 2: skip compaction region index: %u, live words: " SIZE_FORMAT,
                             hr->hrm_index(), _collector->live_words(hr->hrm_index()));
@@ -32,6 +32,7 @@
 class G1GCParPhaseTimesTracker : public CHeapObj<mtGC> {
 protected:
   Ticks _start_time;
+  jlong _start_cpu_time_ns;
   G1GCPhaseTimes::GCParPhases _phase;
   G1GCPhaseTimes* _phase_times;
   uint _worker_id;
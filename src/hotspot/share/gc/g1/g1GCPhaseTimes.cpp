@@ -131,6 +131,9 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
   _gc_par_phases[MergePSS]->create_thread_work_items("Copied Bytes", MergePSSCopiedBytes);
   _gc_par_phases[MergePSS]->create_thread_work_items("LAB Waste", MergePSSLABWasteBytes);
   _gc_par_phases[MergePSS]->create_thread_work_items("LAB Undo Waste", MergePSSLABUndoWasteBytes);
+  if (UseNUMA) {
+    _gc_par_phases[MergePSS]->create_thread_work_items("Off-Node Allocated Bytes", MergePSSOffNodeAllocatedBytes);
+  }
 
   _gc_par_phases[RestoreRetainedRegions]->create_thread_work_items("Evacuation Failure Regions:", RestoreRetainedRegionsNum);
 
@@ -156,6 +159,14 @@ G1GCPhaseTimes::G1GCPhaseTimes(STWGCTimer* gc_timer, uint max_gc_threads) :
   _gc_par_phases[ResetMarkingState] = new WorkerDataArray<double>("ResetMarkingState", "Reset Marking State (ms):", max_gc_threads);
   _gc_par_phases[NoteStartOfMark] = new WorkerDataArray<double>("NoteStartOfMark", "Note Start Of Mark (ms):", max_gc_threads);
 
+  for (int i = 0; i < GCParPhasesSentinel; i++) {
+    if (_gc_par_phases[i] != NULL) {
+      _gc_par_phases_cpu[i] = new WorkerDataArray<double>(_gc_par_phases[i]->short_name(), "CPU (ms):", max_gc_threads);
+    } else {
+      _gc_par_phases_cpu[i] = NULL;
+    }
+  }
+
   reset();
 }
 
@@ -191,6 +202,7 @@ void G1GCPhaseTimes::reset() {
   for (int i = 0; i < GCParPhasesSentinel; i++) {
     if (_gc_par_phases[i] != NULL) {
       _gc_par_phases[i]->reset();
+      _gc_par_phases_cpu[i]->reset();
     }
   }
 
@@ -271,6 +283,10 @@ void G1GCPhaseTimes::record_or_add_time_secs(GCParPhases phase, uint worker_id,
   _gc_par_phases[phase]->set_or_add(worker_id, secs);
 }
 
+void G1GCPhaseTimes::record_or_add_cpu_time_secs(GCParPhases phase, uint worker_id, double secs) {
+  _gc_par_phases_cpu[phase]->set_or_add(worker_id, secs);
+}
+
 double G1GCPhaseTimes::get_time_secs(GCParPhases phase, uint worker_id) {
   return _gc_par_phases[phase]->get(worker_id);
 }
@@ -317,6 +333,7 @@ void G1GCPhaseTimes::log_phase(WorkerDataArray<double>* phase, uint indent_level
   out->sp(indent_level * 2);
   phase->print_summary_on(out, print_sum);
   details(phase, indent_level);
+  log_cpu_time(phase, indent_level + 1, out);
 
   for (uint i = 0; i < phase->MaxThreadWorkItems; i++) {
     WorkerDataArray<size_t>* work_items = phase->thread_work_items(i);
@@ -328,6 +345,26 @@ void G1GCPhaseTimes::log_phase(WorkerDataArray<double>* phase, uint indent_level
   }
 }
 
+// Prints the thread CPU time next to the wall time of a phase, so that on an
+// oversubscribed machine descheduled workers show up as a difference of the two.
+void G1GCPhaseTimes::log_cpu_time(WorkerDataArray<double>* phase, uint indent_level, outputStream* out) const {
+  if (!log_is_enabled(Debug, gc, phases, cpu)) {
+    return;
+  }
+  for (int i = 0; i < GCParPhasesSentinel; i++) {
+    if (_gc_par_phases[i] == phase) {
+      WorkerDataArray<double>* cpu_times = _gc_par_phases_cpu[i];
+      // Phases derived from other phases, like GC Worker Total, have no CPU time.
+      if (cpu_times->sum() > 0.0) {
+        out->sp(indent_level * 2);
+        cpu_times->print_summary_on(out, true);
+        details(cpu_times, indent_level);
+      }
+      return;
+    }
+  }
+}
+
 void G1GCPhaseTimes::debug_phase(WorkerDataArray<double>* phase, uint extra_indent) const {
   LogTarget(Debug, gc, phases) lt;
   if (lt.is_enabled()) {
@@ -577,9 +614,14 @@ void G1EvacPhaseWithTrimTimeTracker::stop() {
 }
 
 G1GCParPhaseTimesTracker::G1GCParPhaseTimesTracker(G1GCPhaseTimes* phase_times, G1GCPhaseTimes::GCParPhases phase, uint worker_id, bool allow_multiple_record) :
-  _start_time(), _phase(phase), _phase_times(phase_times), _worker_id(worker_id), _event(), _allow_multiple_record(allow_multiple_record) {
+  _start_time(), _start_cpu_time_ns(-1), _phase(phase), _phase_times(phase_times), _worker_id(worker_id), _event(), _allow_multiple_record(allow_multiple_record) {
   if (_phase_times != NULL) {
     _start_time = Ticks::now();
+    // Reading the thread CPU time is a system call, only do it for a consumer.
+    if (os::is_thread_cpu_time_supported() &&
+        (log_is_enabled(Debug, gc, phases, cpu) || EventGCPhaseParallelCPUTime::is_enabled())) {
+      _start_cpu_time_ns = os::current_thread_cpu_time();
+    }
   }
 }
 
@@ -591,6 +633,19 @@ G1GCParPhaseTimesTracker::~G1GCParPhaseTimesTracker() {
       _phase_times->record_time_secs(_phase, _worker_id, (Ticks::now() - _start_time).seconds());
     }
     _event.commit(GCId::current(), _worker_id, G1GCPhaseTimes::phase_name(_phase));
+    if (_start_cpu_time_ns != -1) {
+      // Includes the time the evacuation trackers attribute to ObjCopy for trimming.
+      const jlong cpu_time_ns = os::current_thread_cpu_time() - _start_cpu_time_ns;
+      _phase_times->record_or_add_cpu_time_secs(_phase, _worker_id, (double)cpu_time_ns / NANOSECS_PER_SEC);
+      EventGCPhaseParallelCPUTime event;
+      if (event.should_commit()) {
+        event.set_gcId(GCId::current());
+        event.set_gcWorkerId(_worker_id);
+        event.set_name(G1GCPhaseTimes::phase_name(_phase));
+        event.set_cpuTime(cpu_time_ns);
+        event.commit();
+      }
+    }
   }
 }
 
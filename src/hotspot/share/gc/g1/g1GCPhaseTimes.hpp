@@ -141,7 +141,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   enum GCMergePSSWorkItems {
     MergePSSCopiedBytes,
     MergePSSLABWasteBytes,
-    MergePSSLABUndoWasteBytes
+    MergePSSLABUndoWasteBytes,
+    MergePSSOffNodeAllocatedBytes
   };
 
   enum RestoreRetainedRegionsWorkItems {
@@ -159,6 +160,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   static const int GCMainParPhasesLast = GCWorkerEnd;
 
   WorkerDataArray<double>* _gc_par_phases[GCParPhasesSentinel];
+  // Thread CPU time of the workers for each phase in _gc_par_phases.
+  WorkerDataArray<double>* _gc_par_phases_cpu[GCParPhasesSentinel];
 
   double _cur_collection_initial_evac_time_ms;
   double _cur_optional_evac_time_ms;
@@ -217,6 +220,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   void log_work_items(WorkerDataArray<double>* phase, uint indent, outputStream* out) const;
   void log_phase(WorkerDataArray<double>* phase, uint indent_level, outputStream* out, bool print_sum) const;
+  void log_cpu_time(WorkerDataArray<double>* phase, uint indent_level, outputStream* out) const;
   void debug_serial_phase(WorkerDataArray<double>* phase, uint extra_indent = 0) const;
   void debug_phase(WorkerDataArray<double>* phase, uint extra_indent = 0) const;
   void trace_phase(WorkerDataArray<double>* phase, bool print_sum = true, uint extra_indent = 0) const;
@@ -250,6 +254,9 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   void record_or_add_time_secs(GCParPhases phase, uint worker_id, double secs);
 
+  // add the thread CPU time a worker spent in a phase in seconds
+  void record_or_add_cpu_time_secs(GCParPhases phase, uint worker_id, double secs);
+
   double get_time_secs(GCParPhases phase, uint worker_id);
 
   void record_thread_work_item(GCParPhases phase, uint worker_id, size_t count, uint index = 0);
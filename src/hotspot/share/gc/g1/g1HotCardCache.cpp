@@ -27,38 +27,72 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
 #include "gc/g1/g1HotCardCache.hpp"
+#include "logging/log.hpp"
+#include "memory/padded.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 G1HotCardCache::G1HotCardCache(G1CollectedHeap *g1h):
   _g1h(g1h), _use_cache(false), _card_counts(g1h),
-  _hot_cache(NULL), _hot_cache_size(0), _hot_cache_par_chunk_size(0),
-  _hot_cache_idx(0), _hot_cache_par_claimed_idx(0), _cache_wrapped_around(false)
+  _shards(NULL), _num_shards(0), _hot_cache_par_chunk_size(0)
 {}
 
+uint G1HotCardCache::ergo_num_shards(size_t total_size) {
+  uint num_shards = G1HotCardCacheShards;
+  if (num_shards == 0) {
+    // One shard per refinement thread avoids most contention on the
+    // insertion index; more shards than that do not help.
+    num_shards = MIN2(MAX2(G1ConcRefinementThreads, 1u), 16u);
+  }
+  num_shards = round_down_power_of_2(num_shards);
+  // Every shard should at least hold a claim chunk worth of cards.
+  while (num_shards > 1 && (total_size / num_shards) < (size_t)ClaimChunkSize) {
+    num_shards /= 2;
+  }
+  return num_shards;
+}
+
 void G1HotCardCache::initialize(G1RegionToSpaceMapper* card_counts_storage) {
   if (default_use_cache()) {
     _use_cache = true;
 
-    _hot_cache_size = (size_t)1 << G1ConcRSLogCacheSize;
-    _hot_cache = ArrayAllocator<CardValue*>::allocate(_hot_cache_size, mtGC);
-
-    reset_hot_cache_internal();
+    size_t total_size = (size_t)1 << G1ConcRSLogCacheSize;
+    _num_shards = ergo_num_shards(total_size);
+    _shards = PaddedArray<Shard, mtGC>::create_unfreeable(_num_shards);
+
+    size_t shard_size = total_size / _num_shards;
+    size_t max_shard_size = G1AdaptiveHotCardCacheSize ? shard_size * MaxGrowthFactor : shard_size;
+    for (uint i = 0; i < _num_shards; i++) {
+      Shard* shard = &_shards[i];
+      shard->_max_size = max_shard_size;
+      shard->_hot_cache = ArrayAllocator<CardValue*>::allocate(max_shard_size, mtGC);
+      for (size_t j = 0; j < max_shard_size; j++) {
+        shard->_hot_cache[j] = NULL;
+      }
+      shard->reset(shard_size);
+    }
 
     // For refining the cards in the hot cache in parallel
     _hot_cache_par_chunk_size = ClaimChunkSize;
-    _hot_cache_par_claimed_idx = 0;
-
-    _cache_wrapped_around = false;
+    reset_hot_cache_claimed_index();
 
     _card_counts.initialize(card_counts_storage);
+
+    log_debug(gc, refine)("Hot card cache: " SIZE_FORMAT " entries in %u shards",
+                          total_size, _num_shards);
   }
 }
 
 G1HotCardCache::~G1HotCardCache() {
   if (default_use_cache()) {
-    assert(_hot_cache != NULL, "Logic");
-    ArrayAllocator<CardValue*>::free(_hot_cache, _hot_cache_size);
-    _hot_cache = NULL;
+    assert(_shards != NULL, "Logic");
+    for (uint i = 0; i < _num_shards; i++) {
+      Shard* shard = &_shards[i];
+      ArrayAllocator<CardValue*>::free(shard->_hot_cache, shard->_max_size);
+      shard->_hot_cache = NULL;
+    }
+    // The padded shard array itself can not be freed.
+    _shards = NULL;
   }
 }
 
@@ -70,14 +104,15 @@ CardTable::CardValue* G1HotCardCache::insert(CardValue* card_ptr) {
     return card_ptr;
   }
   // Otherwise, the card is hot.
-  size_t index = Atomic::fetch_and_add(&_hot_cache_idx, 1u);
-  if (index == _hot_cache_size) {
+  Shard* shard = shard_for(card_ptr);
+  size_t index = Atomic::fetch_and_add(&shard->_hot_cache_idx, 1u);
+  if (index == shard->_size) {
     // Can use relaxed store because all racing threads are writing the same
     // value and there aren't any concurrent readers.
-    Atomic::store(&_cache_wrapped_around, true);
+    Atomic::store(&shard->_cache_wrapped_around, true);
   }
-  size_t masked_index = index & (_hot_cache_size - 1);
-  CardValue* current_ptr = _hot_cache[masked_index];
+  size_t masked_index = index & (shard->_size - 1);
+  CardValue* current_ptr = shard->_hot_cache[masked_index];
 
   // Try to store the new card pointer into the cache. Compare-and-swap to guard
   // against the unlikely event of a race resulting in another card pointer to
@@ -85,7 +120,7 @@ CardTable::CardValue* G1HotCardCache::insert(CardValue* card_ptr) {
   // card_ptr in favor of the other option, which would be starting over. This
   // should be OK since card_ptr will likely be the older card already when/if
   // this ever happens.
-  CardValue* previous_ptr = Atomic::cmpxchg(&_hot_cache[masked_index],
+  CardValue* previous_ptr = Atomic::cmpxchg(&shard->_hot_cache[masked_index],
                                             current_ptr,
                                             card_ptr);
   return (previous_ptr == current_ptr) ? previous_ptr : card_ptr;
@@ -94,21 +129,25 @@ CardTable::CardValue* G1HotCardCache::insert(CardValue* card_ptr) {
 void G1HotCardCache::drain(G1CardTableEntryClosure* cl, uint worker_id) {
   assert(default_use_cache(), "Drain only necessary if we use the hot card cache.");
 
-  assert(_hot_cache != NULL, "Logic");
+  assert(_shards != NULL, "Logic");
   assert(!use_cache(), "cache should be disabled");
 
-  while (_hot_cache_par_claimed_idx < _hot_cache_size) {
-    size_t end_idx = Atomic::add(&_hot_cache_par_claimed_idx,
-                                 _hot_cache_par_chunk_size);
-    size_t start_idx = end_idx - _hot_cache_par_chunk_size;
-    // The current worker has successfully claimed the chunk [start_idx..end_idx)
-    end_idx = MIN2(end_idx, _hot_cache_size);
-    for (size_t i = start_idx; i < end_idx; i++) {
-      CardValue* card_ptr = _hot_cache[i];
-      if (card_ptr != NULL) {
-        cl->do_card_ptr(card_ptr, worker_id);
-      } else {
-        break;
+  // Start with a different shard for every worker to spread the claims.
+  for (uint i = 0; i < _num_shards; i++) {
+    Shard* shard = &_shards[(worker_id + i) & (_num_shards - 1)];
+    while (shard->_hot_cache_par_claimed_idx < shard->_size) {
+      size_t end_idx = Atomic::add(&shard->_hot_cache_par_claimed_idx,
+                                   _hot_cache_par_chunk_size);
+      size_t start_idx = end_idx - _hot_cache_par_chunk_size;
+      // The current worker has successfully claimed the chunk [start_idx..end_idx)
+      end_idx = MIN2(end_idx, shard->_size);
+      for (size_t j = start_idx; j < end_idx; j++) {
+        CardValue* card_ptr = shard->_hot_cache[j];
+        if (card_ptr != NULL) {
+          cl->do_card_ptr(card_ptr, worker_id);
+        } else {
+          break;
+        }
       }
     }
   }
@@ -117,6 +156,66 @@ void G1HotCardCache::drain(G1CardTableEntryClosure* cl, uint worker_id) {
   // above, are discarded prior to re-enabling the cache near the end of the GC.
 }
 
+void G1HotCardCache::reset_hot_cache_claimed_index() {
+  for (uint i = 0; i < _num_shards; i++) {
+    _shards[i]._hot_cache_par_claimed_idx = 0;
+  }
+}
+
+size_t G1HotCardCache::num_entries() const {
+  size_t result = 0;
+  for (uint i = 0; i < _num_shards; i++) {
+    result += _shards[i].num_entries();
+  }
+  return result;
+}
+
+size_t G1HotCardCache::next_size(const Shard* shard) const {
+  size_t size = shard->_size;
+  if (!G1AdaptiveHotCardCacheSize) {
+    return size;
+  }
+  size_t inserts = shard->num_inserts();
+  if (inserts > size * 2) {
+    // Hot cards were evicted well before they could be re-dirtied again;
+    // a larger cache delays their refinement more effectively.
+    return MIN2(size * 2, shard->_max_size);
+  } else if (inserts < size / 4) {
+    // Most of the cache is unused; draining a smaller one is cheaper.
+    return MAX2(size / 2, MIN2((size_t)ClaimChunkSize, shard->_max_size));
+  }
+  return size;
+}
+
+void G1HotCardCache::Shard::reset(size_t new_size) {
+  assert(is_power_of_2(new_size) && new_size <= _max_size, "invalid size " SIZE_FORMAT, new_size);
+  // Also clear stale entries beyond a shrunk size so that a later growth
+  // does not see them.
+  size_t clear_size = MAX2(_size, new_size);
+  for (size_t i = 0; i < clear_size; i++) {
+    _hot_cache[i] = NULL;
+  }
+  _size = new_size;
+  _hot_cache_idx = 0;
+  _cache_wrapped_around = false;
+}
+
+void G1HotCardCache::reset_hot_cache_internal() {
+  assert(_shards != NULL, "Logic");
+  size_t total_size = 0;
+  size_t old_total_size = 0;
+  for (uint i = 0; i < _num_shards; i++) {
+    Shard* shard = &_shards[i];
+    old_total_size += shard->_size;
+    shard->reset(next_size(shard));
+    total_size += shard->_size;
+  }
+  if (total_size != old_total_size) {
+    log_debug(gc, refine)("Hot card cache resized from " SIZE_FORMAT " to " SIZE_FORMAT " entries",
+                          old_total_size, total_size);
+  }
+}
+
 void G1HotCardCache::reset_card_counts(HeapRegion* hr) {
   _card_counts.clear_region(hr);
 }
@@ -27,6 +27,7 @@
 
 #include "gc/g1/g1CardCounts.hpp"
 #include "memory/allocation.hpp"
+#include "memory/padded.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/thread.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -51,43 +52,85 @@ class HeapRegion;
 // This can significantly reduce the overhead of the write barrier
 // code, increasing throughput.
 
+// The cache is split into a power of two number of shards, selected by card
+// address, so that concurrent inserters do not all contend on a single
+// insertion index. With G1AdaptiveHotCardCacheSize, the number of entries
+// used in each shard is adjusted at every reset according to how many cards
+// were inserted into the shard since the last reset.
+
 class G1HotCardCache: public CHeapObj<mtGC> {
 public:
   typedef CardTable::CardValue CardValue;
 
 private:
+  class Shard {
+  public:
+    // The card cache table of this shard, _max_size entries long.
+    CardValue** _hot_cache;
+
+    size_t _max_size;
+
+    // Number of entries in _hot_cache currently in use. Always a power of
+    // two. Only changed at a safepoint while the cache is disabled.
+    size_t _size;
+
+    volatile size_t _hot_cache_idx;
+
+    volatile size_t _hot_cache_par_claimed_idx;
+
+    // Records whether insertion overflowed this shard at least once. This
+    // avoids the need for a separate atomic counter of how many valid entries
+    // are in the shard.
+    volatile bool _cache_wrapped_around;
+
+    Shard() :
+      _hot_cache(NULL), _max_size(0), _size(0),
+      _hot_cache_idx(0), _hot_cache_par_claimed_idx(0),
+      _cache_wrapped_around(false) {}
+
+    size_t num_entries() const {
+      return _cache_wrapped_around ? _size : _hot_cache_idx;
+    }
+
+    // Number of cards inserted since the last reset, including overwritten ones.
+    size_t num_inserts() const { return _hot_cache_idx; }
+
+    void reset(size_t new_size);
+  };
+
   G1CollectedHeap*  _g1h;
 
   bool              _use_cache;
 
   G1CardCounts      _card_counts;
 
+  // The (padded) shards of the cache.
+  PaddedEnd<Shard>* _shards;
 
-  // The card cache table
-  CardValue** _hot_cache;
-
-  size_t            _hot_cache_size;
+  uint              _num_shards;
 
   size_t            _hot_cache_par_chunk_size;
 
-  // Avoids false sharing when concurrently updating _hot_cache_idx or
-  // _hot_cache_par_claimed_idx. These are never updated at the same time
-  // thus it's not necessary to separate them as well
-  char _pad_before[DEFAULT_CACHE_LINE_SIZE];
+  // The number of cached cards a thread claims when flushing the cache
+  static const int ClaimChunkSize = 32;
 
-  volatile size_t _hot_cache_idx;
+  // With G1AdaptiveHotCardCacheSize, the maximum factor a shard may grow
+  // beyond its initial size.
+  static const size_t MaxGrowthFactor = 4;
 
-  volatile size_t _hot_cache_par_claimed_idx;
+  // Number of cards mapped to the same shard: keeps cards of the same
+  // object or array together, which are likely to get dirtied together.
+  static const uint LogCardsPerShardStride = 6;
 
-  char _pad_after[DEFAULT_CACHE_LINE_SIZE];
+  Shard* shard_for(CardValue* card_ptr) const {
+    size_t stride_index = (uintptr_t)card_ptr >> LogCardsPerShardStride;
+    return &_shards[stride_index & (_num_shards - 1)];
+  }
 
-  // Records whether insertion overflowed the hot card cache at least once. This
-  // avoids the need for a separate atomic counter of how many valid entries are
-  // in the HCC.
-  volatile bool _cache_wrapped_around;
+  static uint ergo_num_shards(size_t total_size);
 
-  // The number of cached cards a thread claims when flushing the cache
-  static const int ClaimChunkSize = 32;
+  // Returns the size of the given shard for the next mutator phase.
+  size_t next_size(const Shard* shard) const;
 
  public:
   static bool default_use_cache() {
@@ -121,9 +164,7 @@ private:
   void drain(G1CardTableEntryClosure* cl, uint worker_id);
 
   // Set up for parallel processing of the cards in the hot cache
-  void reset_hot_cache_claimed_index() {
-    _hot_cache_par_claimed_idx = 0;
-  }
+  void reset_hot_cache_claimed_index();
 
   // Resets the hot card cache and discards the entries.
   void reset_hot_cache() {
@@ -137,18 +178,12 @@ private:
   void reset_card_counts(HeapRegion* hr);
 
   // Number of entries in the HCC.
-  size_t num_entries() const {
-    return _cache_wrapped_around ? _hot_cache_size : _hot_cache_idx + 1;
-  }
+  size_t num_entries() const;
+
+  uint num_shards() const { return _num_shards; }
+
  private:
-  void reset_hot_cache_internal() {
-    assert(_hot_cache != NULL, "Logic");
-    _hot_cache_idx = 0;
-    for (size_t i = 0; i < _hot_cache_size; i++) {
-      _hot_cache[i] = NULL;
-    }
-    _cache_wrapped_around = false;
-  }
+  void reset_hot_cache_internal();
 };
 
 #endif // SHARE_GC_G1_G1HOTCARDCACHE_HPP
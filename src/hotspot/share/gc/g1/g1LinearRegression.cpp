@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1LinearRegression.hpp"
+#include "utilities/debug.hpp"
+
+#include <math.h>
+
+G1LinearRegression::G1LinearRegression(double decay_factor) :
+  _decay_factor(decay_factor),
+  _num_samples(0),
+  _sum_weights(0.0),
+  _sum_x(0.0),
+  _sum_y(0.0),
+  _sum_xx(0.0),
+  _sum_xy(0.0),
+  _sum_residuals_sq(0.0) {
+  assert(decay_factor > 0.0 && decay_factor < 1.0, "Decay factor must be in (0, 1) but is %f", decay_factor);
+}
+
+void G1LinearRegression::add(double x, double y) {
+  if (_num_samples > 0) {
+    double residual = y - predict(x);
+    _sum_residuals_sq = _decay_factor * _sum_residuals_sq + residual * residual;
+  }
+
+  _sum_weights = _decay_factor * _sum_weights + 1.0;
+  _sum_x = _decay_factor * _sum_x + x;
+  _sum_y = _decay_factor * _sum_y + y;
+  _sum_xx = _decay_factor * _sum_xx + x * x;
+  _sum_xy = _decay_factor * _sum_xy + x * y;
+  _num_samples++;
+}
+
+void G1LinearRegression::fit(double& slope, double& intercept) const {
+  slope = _sum_x > 0.0 ? _sum_y / _sum_x : 0.0;
+  intercept = 0.0;
+  if (_num_samples < 2) {
+    return;
+  }
+  double const mx = mean_x();
+  double const var_x = _sum_xx / _sum_weights - mx * mx;
+  // Treat almost identical x as degenerate; the relative threshold avoids
+  // precision problems with the large values used e.g. for copied bytes.
+  if (var_x <= 1e-9 * mx * mx) {
+    return;
+  }
+  double const fitted_slope = (_sum_xy / _sum_weights - mx * mean_y()) / var_x;
+  if (fitted_slope >= 0.0) {
+    slope = fitted_slope;
+    intercept = mean_y() - fitted_slope * mx;
+  }
+}
+
+double G1LinearRegression::slope() const {
+  double slope, intercept;
+  fit(slope, intercept);
+  return slope;
+}
+
+double G1LinearRegression::intercept() const {
+  double slope, intercept;
+  fit(slope, intercept);
+  return intercept;
+}
+
+double G1LinearRegression::residual_stddev() const {
+  if (_num_samples < 2) {
+    return 0.0;
+  }
+  // The first sample has no residual, so its weight is missing from the sum.
+  double const weights = _sum_weights - pow(_decay_factor, _num_samples - 1);
+  return sqrt(_sum_residuals_sq / weights);
+}
+
+double G1LinearRegression::predict(double x) const {
+  double slope, intercept;
+  fit(slope, intercept);
+  return MAX2(intercept + slope * x, 0.0);
+}
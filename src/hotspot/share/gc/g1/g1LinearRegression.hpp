@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1LINEARREGRESSION_HPP
+#define SHARE_GC_G1_G1LINEARREGRESSION_HPP
+
+#include "utilities/globalDefinitions.hpp"
+
+// Online weighted least squares fit of y = intercept + slope * x.
+//
+// Every new sample scales down the weight of all previous samples by the decay
+// factor, so the model follows changes in the application behavior similar to
+// the decaying averages in TruncatedSeq. In contrast to a plain cost-per-unit
+// average the model captures a fixed per-phase overhead in the intercept, which
+// otherwise inflates the predictions for small and deflates them for large amounts
+// of work.
+//
+// Also tracks the decaying variance of the residuals, i.e. the error of the
+// prediction for a sample before it has been added to the model.
+class G1LinearRegression {
+  double _decay_factor;
+
+  uint _num_samples;
+
+  double _sum_weights;
+  double _sum_x;
+  double _sum_y;
+  double _sum_xx;
+  double _sum_xy;
+  double _sum_residuals_sq;
+
+  double mean_x() const { return _sum_x / _sum_weights; }
+  double mean_y() const { return _sum_y / _sum_weights; }
+
+  // Calculates the coefficients of the current fit. If there are too few
+  // samples, all samples have (almost) the same x, or the fitted slope is
+  // negative, i.e. more work would take less time, falls back to a proportional
+  // model through the origin.
+  void fit(double& slope, double& intercept) const;
+
+public:
+  G1LinearRegression(double decay_factor);
+
+  void add(double x, double y);
+
+  uint num_samples() const { return _num_samples; }
+
+  // The fitted coefficients, see fit().
+  double slope() const;
+  double intercept() const;
+
+  // Standard deviation of the residuals.
+  double residual_stddev() const;
+
+  // Predicted y for the given x, bounded by zero.
+  double predict(double x) const;
+};
+
+#endif // SHARE_GC_G1_G1LINEARREGRESSION_HPP
@@ -41,6 +41,7 @@
 #include "memory/allocation.inline.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "oops/stackChunkOop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -81,6 +82,8 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _surviving_words_length(young_cset_length + 1),
     _old_gen_is_full(false),
     _partial_objarray_chunk_size(ParGCArrayScanChunk),
+    // Only a fraction of the words of a stack are oops, so use larger parts than for arrays
+    _partial_stack_chunk_size(ParGCArrayScanChunk * 8),
     _partial_array_stepper(n_workers),
     _string_dedup_requests(),
     _num_optional_regions(optional_cset_length),
@@ -146,6 +149,10 @@ size_t G1ParScanThreadState::lab_undo_waste_words() const {
   return _plab_allocator->undo_waste();
 }
 
+size_t G1ParScanThreadState::off_node_allocated_words() const {
+  return _plab_allocator->off_node_allocated();
+}
+
 #ifdef ASSERT
 void G1ParScanThreadState::verify_task(narrowOop* task) const {
   assert(task != NULL, "invariant");
@@ -215,11 +222,85 @@ void G1ParScanThreadState::do_oop_evac(T* p) {
   write_ref_field_post(p, obj);
 }
 
+// Large stack chunks are split into parts of their stack, from the metadata of the
+// top frame to the end of the chunk, that are scanned using the chunk's bitmap.
+// The parts are claimed through the sp field of the from-space chunk, which is
+// not used after copying, while the to-space chunk's sp delimits the stack.
+static intptr_t* partial_stack_chunk_base(stackChunkOop chunk) {
+  return chunk->sp_address() - frame::metadata_words;
+}
+
+static int partial_stack_chunk_length(stackChunkOop chunk) {
+  return (int)(chunk->end_address() - partial_stack_chunk_base(chunk));
+}
+
+static int* partial_stack_chunk_claim_addr(oop from_obj) {
+  return from_obj->field_addr<int>(jdk_internal_vm_StackChunk::sp_offset());
+}
+
+MAYBE_INLINE_EVACUATION
+void G1ParScanThreadState::do_partial_stack_chunk(oop from_obj) {
+  assert(from_obj->is_forwarded(), "must be forwarded");
+  oop to_obj = from_obj->forwardee();
+  assert(from_obj != to_obj, "should not be chunking self-forwarded objects");
+  stackChunkOop to_chunk = stackChunkOopDesc::cast(to_obj);
+  assert(to_chunk->has_bitmap(), "only chunks with a bitmap are split");
+
+  const int length = partial_stack_chunk_length(to_chunk);
+  PartialArrayTaskStepper::Step step
+    = _partial_array_stepper.next(length,
+                                  partial_stack_chunk_claim_addr(from_obj),
+                                  _partial_stack_chunk_size);
+  for (uint i = 0; i < step._ncreate; ++i) {
+    push_on_queue(ScannerTask(PartialArrayScanTask(from_obj)));
+  }
+
+  G1HeapRegionAttr dest_attr = _g1h->region_attr(to_chunk);
+  G1SkipCardEnqueueSetter x(&_scanner, dest_attr.is_new_survivor());
+  intptr_t* const start = partial_stack_chunk_base(to_chunk) + step._index;
+  to_chunk->oop_iterate(&_scanner, MemRegion((HeapWord*)start, (HeapWord*)(start + _partial_stack_chunk_size)));
+}
+
+MAYBE_INLINE_EVACUATION
+bool G1ParScanThreadState::start_partial_stack_chunk(G1HeapRegionAttr dest_attr,
+                                                     oop from_obj,
+                                                     oop to_obj) {
+  assert(from_obj->is_forwarded() && from_obj->forwardee() == to_obj, "precondition");
+  stackChunkOop to_chunk = stackChunkOopDesc::cast(to_obj);
+  // Without a bitmap, every part would have to walk all frames.
+  if (!to_chunk->has_bitmap()) {
+    return false;
+  }
+  const int length = partial_stack_chunk_length(to_chunk);
+  if (length <= 2 * _partial_stack_chunk_size) {
+    return false;
+  }
+
+  PartialArrayTaskStepper::Step step
+    = _partial_array_stepper.start(length,
+                                   partial_stack_chunk_claim_addr(from_obj),
+                                   _partial_stack_chunk_size);
+  for (uint i = 0; i < step._ncreate; ++i) {
+    push_on_queue(ScannerTask(PartialArrayScanTask(from_obj)));
+  }
+
+  assert(dest_attr.is_young() == _g1h->heap_region_containing(to_chunk)->is_survivor(), "must be");
+  G1SkipCardEnqueueSetter x(&_scanner, dest_attr.is_young());
+  // Process the header fields and the initial part of the stack.
+  intptr_t* const end = partial_stack_chunk_base(to_chunk) + step._index;
+  to_chunk->oop_iterate(&_scanner, MemRegion(cast_from_oop<HeapWord*>(to_chunk), (HeapWord*)end));
+  return true;
+}
+
 MAYBE_INLINE_EVACUATION
 void G1ParScanThreadState::do_partial_array(PartialArrayScanTask task) {
   oop from_obj = task.to_source_array();
 
   assert(_g1h->is_in_reserved(from_obj), "must be in heap.");
+  if (from_obj->is_stackChunk()) {
+    do_partial_stack_chunk(from_obj);
+    return;
+  }
   assert(from_obj->is_objArray(), "must be obj array");
   assert(from_obj->is_forwarded(), "must be forwarded");
 
@@ -460,6 +541,12 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   HeapRegion* const from_region = _g1h->heap_region_containing(old);
   uint node_index = from_region->node_index();
 
+  // Objects in regions pinned by JNI critical sections must stay in place;
+  // retain them like after an allocation failure.
+  if (G1RegionPinning && from_region->has_pinned_objects()) {
+    return handle_evacuation_failure_par(old, old_mark, word_sz);
+  }
+
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
 
   // PLAB allocations should succeed most of the time, so we'll
@@ -528,6 +615,9 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     }
 
     ContinuationGCSupport::transform_stack_chunk(obj);
+    if (obj->is_stackChunk() && start_partial_stack_chunk(dest_attr, old, obj)) {
+      return obj;
+    }
 
     // Check for deduplicating young Strings.
     if (G1StringDedup::is_candidate_from_evacuation(klass,
@@ -592,11 +682,15 @@ void G1ParScanThreadStateSet::flush() {
     // because it resets the PLAB allocator where we get this info from.
     size_t lab_waste_bytes = pss->lab_waste_words() * HeapWordSize;
     size_t lab_undo_waste_bytes = pss->lab_undo_waste_words() * HeapWordSize;
+    size_t off_node_allocated_bytes = pss->off_node_allocated_words() * HeapWordSize;
     size_t copied_bytes = pss->flush(_surviving_young_words_total) * HeapWordSize;
 
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, copied_bytes, G1GCPhaseTimes::MergePSSCopiedBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_waste_bytes, G1GCPhaseTimes::MergePSSLABWasteBytes);
     p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, lab_undo_waste_bytes, G1GCPhaseTimes::MergePSSLABUndoWasteBytes);
+    if (UseNUMA) {
+      p->record_or_add_thread_work_item(G1GCPhaseTimes::MergePSS, worker_id, off_node_allocated_bytes, G1GCPhaseTimes::MergePSSOffNodeAllocatedBytes);
+    }
 
     delete pss;
     _states[worker_id] = NULL;
@@ -86,6 +86,8 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   bool _old_gen_is_full;
   // Size (in elements) of a partial objArray task chunk.
   int _partial_objarray_chunk_size;
+  // Size (in words) of a partial stack chunk task.
+  int _partial_stack_chunk_size;
   PartialArrayTaskStepper _partial_array_stepper;
   StringDedup::Requests _string_dedup_requests;
 
@@ -149,6 +151,7 @@ public:
 
   size_t lab_waste_words() const;
   size_t lab_undo_waste_words() const;
+  size_t off_node_allocated_words() const;
 
   // Pass locally gathered statistics to global state. Returns the total number of
   // HeapWords copied.
@@ -157,6 +160,8 @@ public:
 private:
   void do_partial_array(PartialArrayScanTask task);
   void start_partial_objarray(G1HeapRegionAttr dest_dir, oop from, oop to);
+  void do_partial_stack_chunk(oop from_obj);
+  bool start_partial_stack_chunk(G1HeapRegionAttr dest_dir, oop from, oop to);
 
   HeapWord* allocate_copy_slow(G1HeapRegionAttr* dest_attr,
                                oop old,
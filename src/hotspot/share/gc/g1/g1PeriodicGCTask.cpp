@@ -33,6 +33,9 @@
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/globalDefinitions.hpp"
+#ifdef LINUX
+#include "osContainer_linux.hpp"
+#endif
 
 bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
                                                 G1GCCounters* counters) {
@@ -45,11 +48,15 @@ bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
     return false;
   }
 
-  // Check if enough time has passed since the last GC.
+  // Check if enough time has passed since the last GC, or the memory pressure
+  // requires giving back memory earlier.
   uintx time_since_last_gc = (uintx)g1h->time_since_last_collection().milliseconds();
-  if ((time_since_last_gc < G1PeriodicGCInterval)) {
-    log_debug(gc, periodic)("Last GC occurred " UINTX_FORMAT "ms before which is below threshold " UINTX_FORMAT "ms. Skipping.",
-                            time_since_last_gc, G1PeriodicGCInterval);
+  if ((G1PeriodicGCInterval == 0 || time_since_last_gc < G1PeriodicGCInterval) &&
+      !is_memory_pressure_high(time_since_last_gc)) {
+    if (G1PeriodicGCInterval != 0) {
+      log_debug(gc, periodic)("Last GC occurred " UINTX_FORMAT "ms before which is below threshold " UINTX_FORMAT "ms. Skipping.",
+                              time_since_last_gc, G1PeriodicGCInterval);
+    }
     return false;
   }
 
@@ -69,9 +76,49 @@ bool G1PeriodicGCTask::should_start_periodic_gc(G1CollectedHeap* g1h,
   return true;
 }
 
+bool G1PeriodicGCTask::is_memory_pressure_high(uintx time_since_last_gc) {
+  if (G1PeriodicGCMemoryPressureThreshold == 0.0) {
+    return false;
+  }
+  if (time_since_last_gc < G1PeriodicGCMemoryPressureInterval) {
+    return false;
+  }
+
+  double pressure = -1.0;
+#ifdef LINUX
+  if (OSContainer::is_containerized()) {
+    pressure = OSContainer::memory_pressure();
+  }
+#endif
+  if (pressure < 0.0) {
+    log_debug(gc, periodic)("Memory pressure not available.");
+    return false;
+  }
+  if (pressure <= G1PeriodicGCMemoryPressureThreshold) {
+    log_trace(gc, periodic)("Memory pressure %1.2f%% is below threshold %1.2f%%.",
+                            pressure, G1PeriodicGCMemoryPressureThreshold);
+    return false;
+  }
+  log_debug(gc, periodic)("Memory pressure %1.2f%% is higher than threshold %1.2f%%.",
+                          pressure, G1PeriodicGCMemoryPressureThreshold);
+  return true;
+}
+
+uintx G1PeriodicGCTask::reschedule_delay_ms() const {
+  // G1PeriodicGCInterval is a manageable flag and can be updated
+  // during runtime. If no value is set, wait a second and run it
+  // again to see if the value has been updated. Otherwise use the
+  // real value provided.
+  uintx delay_ms = G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval;
+  if (G1PeriodicGCMemoryPressureThreshold > 0.0) {
+    delay_ms = MIN2(delay_ms, G1PeriodicGCMemoryPressureInterval);
+  }
+  return delay_ms;
+}
+
 void G1PeriodicGCTask::check_for_periodic_gc() {
   // If disabled, just return.
-  if (G1PeriodicGCInterval == 0) {
+  if (G1PeriodicGCInterval == 0 && G1PeriodicGCMemoryPressureThreshold == 0.0) {
     return;
   }
 
@@ -90,9 +137,5 @@ G1PeriodicGCTask::G1PeriodicGCTask(const char* name) :
 
 void G1PeriodicGCTask::execute() {
   check_for_periodic_gc();
-  // G1PeriodicGCInterval is a manageable flag and can be updated
-  // during runtime. If no value is set, wait a second and run it
-  // again to see if the value has been updated. Otherwise use the
-  // real value provided.
-  schedule(G1PeriodicGCInterval == 0 ? 1000 : G1PeriodicGCInterval);
+  schedule(reschedule_delay_ms());
 }
@@ -34,6 +34,10 @@ class G1GCCounters;
 class G1PeriodicGCTask : public G1ServiceTask {
   bool should_start_periodic_gc(G1CollectedHeap* g1h,
                                 G1GCCounters* counters);
+  // Returns whether the container memory pressure is above the threshold and
+  // enough time passed since the last GC to trigger another one.
+  bool is_memory_pressure_high(uintx time_since_last_gc);
+  uintx reschedule_delay_ms() const;
   void check_for_periodic_gc();
 
 public:
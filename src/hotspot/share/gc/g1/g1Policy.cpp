@@ -467,12 +467,15 @@ void G1Policy::record_full_collection_end() {
 static void log_refinement_stats(const char* kind, const G1ConcurrentRefineStats& stats) {
   log_debug(gc, refine, stats)
            ("%s refinement: %.2fms, refined: " SIZE_FORMAT
-            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT,
+            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT
+            ", hot card cache hits: " SIZE_FORMAT ", misses: " SIZE_FORMAT,
             kind,
             stats.refinement_time().seconds() * MILLIUNITS,
             stats.refined_cards(),
             stats.precleaned_cards(),
-            stats.dirtied_cards());
+            stats.dirtied_cards(),
+            stats.hot_card_cache_hits(),
+            stats.hot_card_cache_misses());
 }
 
 void G1Policy::record_concurrent_refinement_stats() {
@@ -715,6 +718,8 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
                                     average_time_ms(G1GCPhaseTimes::MergeHCC) +
                                     average_time_ms(G1GCPhaseTimes::MergeLB) +
                                     average_time_ms(G1GCPhaseTimes::OptMergeRS);
+      _analytics->report_card_merge_time_ms(total_cards_merged, avg_time_merge_cards,
+                                            G1GCPauseTypeHelper::is_young_only_pause(this_pause));
       _analytics->report_cost_per_card_merge_ms(avg_time_merge_cards / total_cards_merged,
                                                 G1GCPauseTypeHelper::is_young_only_pause(this_pause));
     }
@@ -727,6 +732,8 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
       double avg_time_dirty_card_scan = average_time_ms(G1GCPhaseTimes::ScanHR) +
                                         average_time_ms(G1GCPhaseTimes::OptScanHR);
 
+      _analytics->report_card_scan_time_ms(total_cards_scanned, avg_time_dirty_card_scan,
+                                           G1GCPauseTypeHelper::is_young_only_pause(this_pause));
       _analytics->report_cost_per_card_scan_ms(avg_time_dirty_card_scan / total_cards_scanned,
                                                G1GCPauseTypeHelper::is_young_only_pause(this_pause));
     }
@@ -753,7 +760,9 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     size_t copied_bytes = p->sum_thread_work_items(G1GCPhaseTimes::MergePSS, G1GCPhaseTimes::MergePSSCopiedBytes);
 
     if (copied_bytes > 0) {
-      double cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / copied_bytes;
+      double copy_time_ms = average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy);
+      _analytics->report_object_copy_time_ms(copied_bytes, copy_time_ms, collector_state()->mark_or_rebuild_in_progress());
+      double cost_per_byte_ms = copy_time_ms / copied_bytes;
       _analytics->report_cost_per_byte_ms(cost_per_byte_ms, collector_state()->mark_or_rebuild_in_progress());
     }
 
@@ -905,6 +914,8 @@ double G1Policy::predict_base_elapsed_time_ms(size_t pending_cards,
     _analytics->predict_card_merge_time_ms(pending_cards + rs_length, collector_state()->in_young_only_phase()) +
     _analytics->predict_card_scan_time_ms(effective_scanned_cards, collector_state()->in_young_only_phase()) +
     _analytics->predict_constant_other_time_ms() +
+    _analytics->predict_fixed_phase_time_ms(collector_state()->in_young_only_phase(),
+                                            collector_state()->mark_or_rebuild_in_progress()) +
     predict_survivor_regions_evac_time();
 }
 
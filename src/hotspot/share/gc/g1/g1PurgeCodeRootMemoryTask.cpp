@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CodeCacheRemSet.hpp"
+#include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1PurgeCodeRootMemoryTask.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/safepoint.hpp"
+
+G1PurgeCodeRootMemoryTask::G1PurgeCodeRootMemoryTask(const char* name) :
+  // Registering the task schedules it.
+  G1ServiceTask(name), _scheduled(true) { }
+
+void G1PurgeCodeRootMemoryTask::notify_purge_pending() {
+  assert_at_safepoint();
+
+  G1CodeRootSet::prepare_concurrent_purge();
+
+  // If the task is still scheduled, it will pick up the new memory too.
+  if (!Atomic::load(&_scheduled)) {
+    Atomic::store(&_scheduled, true);
+    G1CollectedHeap::heap()->service_thread()->schedule_task(this, 0);
+  }
+}
+
+void G1PurgeCodeRootMemoryTask::execute() {
+  SuspendibleThreadSetJoiner sts;
+
+  Atomic::store(&_scheduled, false);
+  G1CodeRootSet::purge_pending();
+  log_trace(gc, task)("%s done", name());
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1PURGECODEROOTMEMORYTASK_HPP
+#define SHARE_GC_G1_G1PURGECODEROOTMEMORYTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+
+// Task freeing code root set memory that was released during a young
+// collection after the mutators have been restarted.
+class G1PurgeCodeRootMemoryTask : public G1ServiceTask {
+  // Whether the task is scheduled but has not started yet. Only set at
+  // a safepoint, and only reset by the task while joined to the suspendible
+  // thread set.
+  volatile bool _scheduled;
+
+public:
+  G1PurgeCodeRootMemoryTask(const char* name);
+
+  // Take the code root memory released so far and schedule freeing it.
+  // Must be called at a safepoint.
+  void notify_purge_pending();
+
+  virtual void execute();
+};
+
+#endif // SHARE_GC_G1_G1PURGECODEROOTMEMORYTASK_HPP
@@ -30,7 +30,10 @@
 #include "gc/g1/g1CardTable.inline.hpp"
 #include "gc/g1/g1CardTableEntryClosure.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
+#include "gc/g1/g1ConcurrentRefineStats.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
 #include "gc/g1/g1FromCardCache.hpp"
 #include "gc/g1/g1GCParPhaseTimesTracker.hpp"
@@ -57,8 +60,11 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/stack.inline.hpp"
 #include "utilities/ticks.hpp"
 #include CPU_HEADER(gc/g1/g1Globals)
@@ -651,15 +657,31 @@ private:
     return (value & ToScanMask) == 0;
   }
 
-  bool cur_word_of_cards_contains_any_dirty_card() const {
+  // Returns a mask with a bit set in every byte of the current word of cards
+  // that is a dirty card.
+  size_t cur_word_dirty_cards_mask() const {
     assert(cur_addr_aligned(), "Current address should be aligned");
     size_t const value = *(size_t*)_cur_addr;
-    return (~value & ExpandedToScanMask) != 0;
+    return ~value & ExpandedToScanMask;
   }
 
-  bool cur_word_of_cards_all_dirty_cards() const {
+  // Returns a mask with a bit set in every byte of the current word of cards
+  // that is not a dirty card.
+  size_t cur_word_non_dirty_cards_mask() const {
+    assert(cur_addr_aligned(), "Current address should be aligned");
     size_t const value = *(size_t*)_cur_addr;
-    return value == G1CardTable::WordAllDirty;
+    return value & ExpandedToScanMask;
+  }
+
+  // Returns the offset of the first card (in address order) in a word of cards
+  // that has any bit set in the given mask.
+  static size_t first_card_in_word(size_t mask) {
+    assert(mask != 0, "must have a card set");
+#ifdef VM_LITTLE_ENDIAN
+    return count_trailing_zeros(mask) / BitsPerByte;
+#else
+    return count_leading_zeros(mask) / BitsPerByte;
+#endif
   }
 
   size_t get_and_advance_pos() {
@@ -687,14 +709,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (cur_word_of_cards_contains_any_dirty_card()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a dirty card in the word.");
+      size_t const dirty_mask = cur_word_dirty_cards_mask();
+      if (dirty_mask != 0) {
+        _cur_addr += first_card_in_word(dirty_mask);
+        assert(cur_card_is_dirty(), "Should have found a dirty card in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
@@ -713,14 +732,11 @@ public:
 
     assert(cur_addr_aligned(), "Current address should be aligned now.");
     while (_cur_addr != _end_addr) {
-      if (!cur_word_of_cards_all_dirty_cards()) {
-        for (size_t i = 0; i < sizeof(size_t); i++) {
-          if (!cur_card_is_dirty()) {
-            return get_and_advance_pos();
-          }
-          _cur_addr++;
-        }
-        assert(false, "Should not reach here given we detected a non-dirty card in the word.");
+      size_t const non_dirty_mask = cur_word_non_dirty_cards_mask();
+      if (non_dirty_mask != 0) {
+        _cur_addr += first_card_in_word(non_dirty_mask);
+        assert(!cur_card_is_dirty(), "Should have found a non-dirty card in the word.");
+        return get_and_advance_pos();
       }
       _cur_addr += sizeof(size_t);
     }
@@ -1592,7 +1608,8 @@ inline void check_card_ptr(CardTable::CardValue* card_ptr, G1CardTable* ct) {
 #endif
 }
 
-bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr) {
+bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr,
+                                        G1ConcurrentRefineStats* stats) {
   assert(!_g1h->is_gc_active(), "Only call concurrently");
 
   CardValue* card_ptr = *card_ptr_addr;
@@ -1652,6 +1669,11 @@ bool G1RemSet::clean_card_before_refine(CardValue** const card_ptr_addr) {
 
     const CardValue* orig_card_ptr = card_ptr;
     card_ptr = _hot_card_cache->insert(card_ptr);
+    if (card_ptr == orig_card_ptr) {
+      stats->inc_hot_card_cache_misses(1);
+    } else {
+      stats->inc_hot_card_cache_hits(1);
+    }
     if (card_ptr == NULL) {
       // There was no eviction. Nothing to do.
       return false;
@@ -2019,18 +2041,74 @@ public:
     }
   };
 
-  HeapRegionClaimer _hr_claimer;
+  // A region to rebuild with its estimated amount of work.
+  struct RegionToRebuild {
+    uint _region_idx;
+    size_t _words_to_scan;
+  };
+
+  static int compare_by_words_to_scan(const RegionToRebuild& a, const RegionToRebuild& b) {
+    // Sort in decreasing order.
+    if (a._words_to_scan > b._words_to_scan) {
+      return -1;
+    } else if (a._words_to_scan < b._words_to_scan) {
+      return 1;
+    }
+    return static_cast<int>(a._region_idx - b._region_idx);
+  }
+
   G1ConcurrentMark* _cm;
 
+  // The regions to rebuild, ordered by decreasing amount of work.
+  RegionToRebuild* _regions;
+  uint _num_regions;
+  volatile uint _next_region;
+
   uint _worker_id_offset;
+
+  // Collects the regions to rebuild. Scanning regions with the most live
+  // data first keeps the expensive regions from being claimed last, leaving
+  // the other workers idle while they finish.
+  void collect_regions_to_rebuild(G1CollectedHeap* g1h) {
+    SuspendibleThreadSetJoiner sts_join;
+
+    uint max_regions = g1h->max_reserved_regions();
+    _regions = NEW_C_HEAP_ARRAY(RegionToRebuild, max_regions, mtGC);
+    for (uint i = 0; i < max_regions; i++) {
+      HeapWord* const top_at_rebuild_start = _cm->top_at_rebuild_start(i);
+      if (top_at_rebuild_start == NULL) {
+        continue;
+      }
+      HeapRegion* hr = g1h->region_at(i);
+      HeapWord* const top_at_mark_start = hr->prev_top_at_mark_start();
+      size_t words_to_scan = _cm->live_words(i);
+      if (top_at_rebuild_start > top_at_mark_start) {
+        words_to_scan += pointer_delta(top_at_rebuild_start, top_at_mark_start);
+      }
+      _regions[_num_regions]._region_idx = i;
+      _regions[_num_regions]._words_to_scan = words_to_scan;
+      _num_regions++;
+    }
+    QuickSort::sort(_regions, _num_regions, compare_by_words_to_scan, false);
+
+    log_debug(gc, remset, tracking)("Rebuilding remembered sets scanning %u regions", _num_regions);
+  }
+
 public:
   G1RebuildRemSetTask(G1ConcurrentMark* cm,
                       uint n_workers,
                       uint worker_id_offset) :
       WorkerTask("G1 Rebuild Remembered Set"),
-      _hr_claimer(n_workers),
       _cm(cm),
+      _regions(NULL),
+      _num_regions(0),
+      _next_region(0),
       _worker_id_offset(worker_id_offset) {
+    collect_regions_to_rebuild(G1CollectedHeap::heap());
+  }
+
+  ~G1RebuildRemSetTask() {
+    FREE_C_HEAP_ARRAY(RegionToRebuild, _regions);
   }
 
   void work(uint worker_id) {
@@ -2039,7 +2117,22 @@ public:
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
 
     G1RebuildRemSetHeapRegionClosure cl(g1h, _cm, _worker_id_offset + worker_id);
-    g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
+    while (true) {
+      uint const i = Atomic::fetch_and_add(&_next_region, 1u);
+      if (i >= _num_regions) {
+        break;
+      }
+      // The region may have been eagerly reclaimed (and even uncommitted) since
+      // collecting the regions to rebuild; the closure skips reclaimed regions
+      // based on their reset TARS.
+      HeapRegion* hr = g1h->region_at_or_null(_regions[i]._region_idx);
+      if (hr == NULL) {
+        continue;
+      }
+      if (cl.do_heap_region(hr)) {
+        break;
+      }
+    }
   }
 };
 
@@ -2053,3 +2146,64 @@ void G1RemSet::rebuild_rem_set(G1ConcurrentMark* cm,
                          worker_id_offset);
   workers->run_task(&cl, num_workers);
 }
+
+void G1RemSet::coarsen_card_sets_over_budget() {
+  assert_at_safepoint_on_vm_thread();
+
+  if (G1RemSetMemoryBudgetPercent == 0) {
+    return;
+  }
+  G1CollectionSetCandidates* candidates = _g1h->collection_set()->candidates();
+  if (candidates == NULL || candidates->is_empty()) {
+    return;
+  }
+
+  class SumRemSetMemoryClosure : public HeapRegionClosure {
+  public:
+    size_t _mem_size;
+    SumRemSetMemoryClosure() : HeapRegionClosure(), _mem_size(0) { }
+
+    bool do_heap_region(HeapRegion* r) override {
+      _mem_size += r->rem_set()->mem_size();
+      return false;
+    }
+  } sum_cl;
+  _g1h->heap_region_iterate(&sum_cl);
+
+  size_t const budget = _g1h->capacity() / 100 * G1RemSetMemoryBudgetPercent;
+  if (sum_cl._mem_size <= budget) {
+    return;
+  }
+
+  // Candidates are sorted by decreasing gc efficiency, so the ones at the end
+  // are the least likely to be collected soon.
+  class CoarsenCardSetClosure : public HeapRegionClosure {
+    size_t const _budget;
+  public:
+    size_t _mem_size;
+    uint _num_regions;
+    size_t _num_containers;
+
+    CoarsenCardSetClosure(size_t budget, size_t mem_size) :
+      HeapRegionClosure(), _budget(budget), _mem_size(mem_size), _num_regions(0), _num_containers(0) { }
+
+    bool do_heap_region(HeapRegion* r) override {
+      HeapRegionRemSet* rem_set = r->rem_set();
+      size_t const before = rem_set->mem_size();
+      size_t const num_coarsened = rem_set->coarsen_card_set_at_safepoint();
+      if (num_coarsened > 0) {
+        size_t const after = rem_set->mem_size();
+        _mem_size -= MIN2(_mem_size, before - MIN2(before, after));
+        _num_regions++;
+        _num_containers += num_coarsened;
+      }
+      return _mem_size <= _budget;
+    }
+  } coarsen_cl(budget, sum_cl._mem_size);
+  candidates->iterate_backwards(&coarsen_cl);
+
+  log_debug(gc, remset)("Coarsened " SIZE_FORMAT " card set containers of %u candidate regions: "
+                        "remembered set memory " SIZE_FORMAT "B -> " SIZE_FORMAT "B (budget " SIZE_FORMAT "B)",
+                        coarsen_cl._num_containers, coarsen_cl._num_regions,
+                        sum_cl._mem_size, coarsen_cl._mem_size, budget);
+}
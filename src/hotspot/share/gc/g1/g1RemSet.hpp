@@ -43,6 +43,7 @@ class CodeBlobClosure;
 class G1AbstractSubTask;
 class G1CollectedHeap;
 class G1CMBitMap;
+class G1ConcurrentRefineStats;
 class G1HotCardCache;
 class G1RemSetScanState;
 class G1ParScanThreadState;
@@ -134,8 +135,10 @@ public:
   // the mutator:
   // Cleans the card at "*card_ptr_addr" before refinement, returns true iff the
   // card needs later refinement. Note that "*card_ptr_addr" could be updated to
-  // a different card due to use of hot card cache.
-  bool clean_card_before_refine(CardValue** const card_ptr_addr);
+  // a different card due to use of hot card cache. Hot card cache hits and
+  // misses are recorded in "stats".
+  bool clean_card_before_refine(CardValue** const card_ptr_addr,
+                                G1ConcurrentRefineStats* stats);
   // Refine the region corresponding to "card_ptr". Must be called after
   // being filtered by clean_card_before_refine(), and after proper
   // fence/synchronization.
@@ -151,6 +154,11 @@ public:
   // Rebuilds the remembered set by scanning from bottom to TARS for all regions
   // using the given workers.
   void rebuild_rem_set(G1ConcurrentMark* cm, WorkerThreads* workers, uint worker_id_offset);
+
+  // If remembered sets use more memory than G1RemSetMemoryBudgetPercent of the
+  // heap capacity, coarsen the card sets of collection set candidates, starting
+  // with the least efficient, until within budget again.
+  void coarsen_card_sets_over_budget();
 };
 
 #endif // SHARE_GC_G1_G1REMSET_HPP
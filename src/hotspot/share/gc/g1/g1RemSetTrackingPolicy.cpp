@@ -92,8 +92,11 @@ bool G1RemSetTrackingPolicy::update_humongous_before_rebuild(HeapRegion* r, bool
   bool selected_for_rebuild = false;
   // For humongous regions, to be of interest for rebuilding the remembered set the following must apply:
   // - We always try to update the remembered sets of humongous regions containing
-  // type arrays as they might have been reset after full gc.
-  if (is_live && cast_to_oop(r->humongous_start_region()->bottom())->is_typeArray() && !r->rem_set()->is_tracked()) {
+  // type arrays (and object arrays if these may be eagerly reclaimed) as they
+  // might have been reset after full gc.
+  oop const obj = cast_to_oop(r->humongous_start_region()->bottom());
+  bool const is_reclaimable_type = obj->is_typeArray() || (G1EagerReclaimHumongousObjArrays && obj->is_objArray());
+  if (is_live && is_reclaimable_type && !r->rem_set()->is_tracked()) {
     r->rem_set()->set_state_updating();
     selected_for_rebuild = true;
   }
@@ -316,6 +316,11 @@ class G1PrepareEvacuationTask : public WorkerTask {
       if (!region->rem_set()->is_complete()) {
         return false;
       }
+
+      // Objects pinned by JNI critical sections are live by definition.
+      if (region->has_pinned_objects()) {
+        return false;
+      }
       // Candidate selection must satisfy the following constraints
       // while concurrent marking is in progress:
       //
@@ -337,23 +342,33 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
-      //
-      // We also treat is_typeArray() objects specially, allowing them
-      // to be reclaimed even if allocated before the start of
-      // concurrent mark.  For this we rely on mark stack insertion to
-      // exclude is_typeArray() objects, preventing reclaiming an object
-      // that is in the mark stack.  We also rely on the metadata for
-      // such objects to be built-in and so ensured to be kept live.
+      // We treat is_typeArray() objects specially, allowing them to be
+      // reclaimed even if allocated before the start of concurrent mark.
+      // For this we rely on mark stack insertion to exclude is_typeArray()
+      // objects, preventing reclaiming an object that is in the mark stack.
+      // We also rely on the metadata for such objects to be built-in and
+      // so ensured to be kept live.
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
-
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      //
+      // is_objArray() objects are only nominated outside of marking or if
+      // allocated after the start of marking. A humongous object containing
+      // references induces remembered set entries on other regions. These
+      // become stale when the object is reclaimed, which is harmless: we
+      // never scan cards of free regions, and later users of the region
+      // treat such cards like any other spurious remembered set entry.
+      // Any references the object had into the collection set have been
+      // processed normally during evacuation.
+      if (obj->is_typeArray()) {
+        return _g1h->is_potential_eager_reclaim_candidate(region);
+      }
+      if (G1EagerReclaimHumongousObjArrays && obj->is_objArray()) {
+        return (!_g1h->collector_state()->mark_or_rebuild_in_progress() ||
+                region->obj_allocated_since_next_marking(obj)) &&
+               _g1h->is_potential_eager_reclaim_candidate(region);
+      }
+      return false;
     }
 
   public:
@@ -1096,6 +1111,10 @@ void G1YoungCollector::collect() {
     }
     post_evacuate_collection_set(jtm.evacuation_info(), &per_thread_states);
 
+    // Remaining collection set candidates are final now; keep their remembered
+    // sets within budget.
+    rem_set()->coarsen_card_sets_over_budget();
+
     // Refine the type of a concurrent mark operation now that we did the
     // evacuation, eventually aborting it.
     _concurrent_operation_is_full_mark = policy()->concurrent_operation_is_full_mark("Revise IHOP");
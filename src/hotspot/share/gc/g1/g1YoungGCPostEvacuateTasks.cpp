@@ -166,10 +166,10 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
   // So there is no need to re-check remembered set size of the humongous region.
   //
   // Other implementation considerations:
-  // - never consider object arrays at this time because they would pose
-  // considerable effort for cleaning up the the remembered sets. This is
-  // required because stale remembered sets might reference locations that
-  // are currently allocated into.
+  // - object arrays are only candidates if they can not be on the mark stack,
+  // see G1PrepareEvacuationTask::humongous_region_is_candidate(). The remembered
+  // set entries in other regions induced by their references become stale,
+  // which is tolerated like for any other freed region.
   bool is_reclaimable(uint region_idx) const {
     return G1CollectedHeap::heap()->is_humongous_reclaim_candidate(region_idx);
   }
@@ -192,8 +192,8 @@ public:
     }
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || (G1EagerReclaimHumongousObjArrays && obj->is_objArray()),
+              "Only eagerly reclaiming type and object arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")",
@@ -250,7 +250,9 @@ public:
   PurgeCodeRootsTask() : G1AbstractSubTask(G1GCPhaseTimes::PurgeCodeRoots) { }
 
   double worker_cost() const override { return 1.0; }
-  void do_work(uint worker_id) override { G1CollectedHeap::heap()->purge_code_root_memory(); }
+  // Freeing the memory does not need the safepoint, so leave that to the
+  // service thread.
+  void do_work(uint worker_id) override { G1CollectedHeap::heap()->purge_code_root_memory_concurrently(); }
 };
 
 #if COMPILER2_OR_JVMCI
@@ -312,8 +314,9 @@ public:
     delete _task;
   }
 
+  // Workers claim the marks to restore one chunk at a time.
   double worker_cost() const override {
-    return _preserved_marks->num();
+    return (double)_preserved_marks->num_chunks();
   }
 
   void do_work(uint worker_id) override { _task->work(worker_id); }
@@ -117,6 +117,11 @@
           "Confidence level for MMU/pause predictions")                     \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, G1UseLinearRegressionPrediction, false, EXPERIMENTAL,       \
+          "Predict the time for object copy, card scan and card merge "     \
+          "using an online linear regression of the time on the amount "    \
+          "of work per phase instead of an average cost per unit of work.") \
+                                                                            \
   product(intx, G1SummarizeRSetStatsPeriod, 0, DIAGNOSTIC,                  \
           "The period (in number of GCs) at which we will generate "        \
           "update buffer processing info "                                  \
@@ -212,6 +217,25 @@
           "Log base 2 of the length of conc RS hot-card cache.")            \
           range(0, 27)                                                      \
                                                                             \
+  product(uint, G1RemSetMemoryBudgetPercent, 0, EXPERIMENTAL,               \
+          "Budget for the memory used by remembered sets as a percentage "  \
+          "of the heap capacity. If exceeded after a young collection, "    \
+          "the card sets of the least efficient collection set candidates " \
+          "are coarsened until memory is back within budget. 0 disables "   \
+          "this.")                                                          \
+          range(0, 100)                                                     \
+                                                                            \
+  product(uint, G1HotCardCacheShards, 0, EXPERIMENTAL,                      \
+          "Number of shards of the hot card cache. The value is rounded "   \
+          "down to a power of two. 0 selects the number of shards based "   \
+          "on the number of refinement threads.")                           \
+          range(0, 64)                                                      \
+                                                                            \
+  product(bool, G1AdaptiveHotCardCacheSize, false, EXPERIMENTAL,            \
+          "Adapt the size of the hot card cache at every garbage "          \
+          "collection to the rate hot cards were inserted since the "       \
+          "previous one, up to four times G1ConcRSLogCacheSize.")           \
+                                                                            \
   product(uintx, G1ConcRSHotCardLimit, 4,                                   \
           "The threshold that defines (>=) a hot card.")                    \
           range(0, max_jubyte)                                              \
@@ -317,6 +341,11 @@
           "Try to reclaim dead large objects that have a few stale "        \
           "references at every young GC.")                                  \
                                                                             \
+  product(bool, G1EagerReclaimHumongousObjArrays, true, EXPERIMENTAL,       \
+          "Also try to reclaim dead large object arrays at every young GC. "\
+          "During concurrent marking only object arrays allocated after "   \
+          "the start of marking are considered.")                           \
+                                                                            \
   product(uint, G1EagerReclaimRemSetThreshold, 0, EXPERIMENTAL,             \
           "Maximum number of remembered set entries a humongous region "    \
           "otherwise eligible for eager reclaim may have to be a candidate "\
@@ -358,6 +387,21 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(double, G1PeriodicGCMemoryPressureThreshold, 0.0, MANAGEABLE,     \
+          "Container memory pressure in percent above which G1 triggers "   \
+          "a periodic GC to shrink the heap independent of "                \
+          "G1PeriodicGCInterval. The memory pressure is the share of time " \
+          "some tasks of the container stalled on memory in the last 10 "   \
+          "seconds as reported by the memory.pressure file of cgroups v2. " \
+          "A value of zero disables this check.")                           \
+          range(0.0, 100.0)                                                 \
+                                                                            \
+  product(uintx, G1PeriodicGCMemoryPressureInterval, 1000, MANAGEABLE,      \
+          "Number of milliseconds between checks of the container memory "  \
+          "pressure, and after a previous GC to wait at least before "      \
+          "triggering a periodic GC due to memory pressure.")               \
+          range(1, max_uintx)                                               \
+                                                                            \
   product(uint, G1RemSetFreeMemoryRescheduleDelayMillis, 10, EXPERIMENTAL,  \
           "Time after which the card set free memory task reschedules "     \
           "itself if there is work remaining.")                             \
@@ -374,6 +418,12 @@
           "percentage of the currently used memory.")                       \
           range(0.0, 1.0)                                                   \
                                                                             \
+  product(bool, G1RegionPinning, false, EXPERIMENTAL,                       \
+          "Implement JNI critical sections by pinning the heap region "     \
+          "containing the object instead of stalling garbage collection "   \
+          "with the GCLocker. Regions with pinned objects are kept in "     \
+          "place during evacuation and compaction.")                        \
+                                                                            \
   product(bool, G1UsePreventiveGC, true, DIAGNOSTIC,                        \
           "Allows collections to be triggered proactively based on the      \
            number of free regions and the expected survival rates in each   \
@@ -253,6 +253,10 @@ private:
 
   uint _node_index;
 
+  // Number of objects in this region currently pinned through JNI critical
+  // sections. Regions with pinned objects are never evacuated or compacted.
+  volatile size_t _pinned_object_count;
+
   void report_region_type_change(G1HeapRegionTraceType::Type to);
 
   // Returns whether the given object address refers to a dead object, and either the
@@ -574,6 +578,13 @@ public:
   uint node_index() const { return _node_index; }
   void set_node_index(uint node_index) { _node_index = node_index; }
 
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+  inline size_t pinned_count() const;
+  // Whether this region currently contains objects pinned by JNI critical
+  // sections. Unlike is_pinned(), this status is independent of the region type.
+  inline bool has_pinned_objects() const;
+
   // Verify that the entries on the code root list for this
   // region are live and include at least one pointer into this region.
   void verify_code_roots(VerifyOption vo, bool* failures) const;
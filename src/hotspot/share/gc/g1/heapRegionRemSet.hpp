@@ -128,6 +128,10 @@ public:
 
   G1SegmentedArrayMemoryStats card_set_memory_stats() const;
 
+  // Coarsen all card set containers using memory. See
+  // G1CardSet::coarsen_to_full_at_safepoint().
+  size_t coarsen_card_set_at_safepoint() { return _card_set.coarsen_to_full_at_safepoint(); }
+
   // The actual # of bytes this hr_remset takes up. Also includes the code
   // root set.
   size_t mem_size() {
@@ -28,6 +28,7 @@
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/spaceDecorator.hpp"
 #include "gc/shared/workerThread.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.hpp"
@@ -396,6 +397,17 @@ void MutableNUMASpace::scan_pages(size_t page_count)
 
 // Accumulate statistics about the allocation rate of each lgrp.
 void MutableNUMASpace::accumulate_statistics() {
+  LogTarget(Debug, gc, heap, numa) lt;
+  if (lt.is_enabled()) {
+    // Log before sampling, which clears the allocation failure state.
+    for (int i = 0; i < lgrp_spaces()->length(); i++) {
+      LGRPSpace* ls = lgrp_spaces()->at(i);
+      lt.print("NUMA node %d: used " SIZE_FORMAT "K, capacity " SIZE_FORMAT "K, alloc rate %.0fK%s",
+               ls->lgrp_id(), ls->space()->used_in_bytes() / K, ls->space()->capacity_in_bytes() / K,
+               ls->alloc_rate()->average() / K, ls->allocation_failed() ? ", allocation failed" : "");
+    }
+  }
+
   if (UseAdaptiveNUMAChunkSizing) {
     for (int i = 0; i < lgrp_spaces()->length(); i++) {
       lgrp_spaces()->at(i)->sample();
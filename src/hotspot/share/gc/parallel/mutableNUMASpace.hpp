@@ -115,6 +115,7 @@ class MutableNUMASpace : public MutableSpace {
 
     // Report a failed allocation.
     void set_allocation_failed() { _allocation_failed = true;  }
+    bool allocation_failed() const { return _allocation_failed; }
 
     void sample() {
       // If there was a failed allocation make allocation rate equal
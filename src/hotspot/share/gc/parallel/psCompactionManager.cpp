@@ -38,6 +38,7 @@
 #include "oops/instanceMirrorKlass.inline.hpp"
 #include "oops/objArrayKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 
 PSOldGen*               ParCompactionManager::_old_gen = NULL;
 ParCompactionManager**  ParCompactionManager::_manager_array = NULL;
@@ -50,6 +51,9 @@ ObjectStartArray*    ParCompactionManager::_start_array = NULL;
 ParMarkBitMap*       ParCompactionManager::_mark_bitmap = NULL;
 GrowableArray<size_t >* ParCompactionManager::_shadow_region_array = NULL;
 Monitor*                ParCompactionManager::_shadow_region_monitor = NULL;
+GrowableArray<size_t >* ParCompactionManager::_ready_region_array = NULL;
+volatile int            ParCompactionManager::_ready_region_top = 0;
+uint                    ParCompactionManager::_ready_region_workers = 1;
 
 ParCompactionManager::ParCompactionManager() {
 
@@ -90,6 +94,8 @@ void ParCompactionManager::initialize(ParMarkBitMap* mbm) {
   _shadow_region_array = new (ResourceObj::C_HEAP, mtGC) GrowableArray<size_t >(10, mtGC);
 
   _shadow_region_monitor = new Monitor(Mutex::nosafepoint, "CompactionManager_lock");
+
+  _ready_region_array = new (ResourceObj::C_HEAP, mtGC) GrowableArray<size_t >(10, mtGC);
 }
 
 void ParCompactionManager::reset_all_bitmap_query_caches() {
@@ -195,6 +201,41 @@ void ParCompactionManager::remove_all_shadow_regions() {
   _shadow_region_array->clear();
 }
 
+void ParCompactionManager::push_ready_region(size_t region) {
+  _ready_region_array->push(region);
+}
+
+void ParCompactionManager::start_ready_region_claiming(uint active_workers) {
+  _ready_region_workers = MAX2(active_workers, 1u);
+  Atomic::store(&_ready_region_top, _ready_region_array->length());
+}
+
+void ParCompactionManager::remove_all_ready_regions() {
+  assert(Atomic::load(&_ready_region_top) == 0, "Unclaimed ready regions");
+  _ready_region_array->clear();
+}
+
+bool ParCompactionManager::claim_ready_regions() {
+  // Guided chunking: claim a share of the remaining regions, so that the
+  // chunks get smaller towards the end and the workers finish together.
+  const int max_chunk = 64;
+  int top = Atomic::load(&_ready_region_top);
+  while (top > 0) {
+    int chunk = clamp(top / (int)(2 * _ready_region_workers), 1, max_chunk);
+    int new_top = top - chunk;
+    int cur = Atomic::cmpxchg(&_ready_region_top, top, new_top);
+    if (cur == top) {
+      // Push in reverse fill order, the region at the top is filled first.
+      for (int i = new_top; i < top; i++) {
+        region_stack()->push(_ready_region_array->at(i));
+      }
+      return true;
+    }
+    top = cur;
+  }
+  return false;
+}
+
 #ifdef ASSERT
 void ParCompactionManager::verify_all_marking_stack_empty() {
   uint parallel_gc_threads = ParallelGCThreads;
@@ -85,6 +85,14 @@ class ParCompactionManager : public CHeapObj<mtGC> {
   // See pop/push_shadow_region_mt_safe() below
   static Monitor*               _shadow_region_monitor;
 
+  // Regions that can be filled immediately at the start of the compaction
+  // phase, in reverse fill order. Workers claim them from the top in chunks
+  // that shrink as the array drains, instead of getting a fixed share up
+  // front, so that dense regions spread over all workers.
+  static GrowableArray<size_t>* _ready_region_array;
+  static volatile int           _ready_region_top;
+  static uint                   _ready_region_workers;
+
   HeapWord* _last_query_beg;
   oop _last_query_obj;
   size_t _last_query_ret;
@@ -121,6 +129,13 @@ class ParCompactionManager : public CHeapObj<mtGC> {
   static void    push_shadow_region(size_t shadow_region);
   static void    remove_all_shadow_regions();
 
+  static void    push_ready_region(size_t region);
+  static void    start_ready_region_claiming(uint active_workers);
+  static void    remove_all_ready_regions();
+  // Claim the next chunk of ready regions onto the region stack.
+  // Returns false if there are no ready regions left.
+  bool           claim_ready_regions();
+
   inline size_t  next_shadow_region() { return _next_shadow_region; }
   inline void    set_next_shadow_region(size_t record) { _next_shadow_region = record; }
   inline size_t  move_next_shadow_region_by(size_t workers) {
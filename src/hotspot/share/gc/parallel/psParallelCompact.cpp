@@ -88,6 +88,7 @@
 #include "utilities/formatBuffer.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/stack.inline.hpp"
+#include "utilities/ticks.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmci.hpp"
 #endif
@@ -2180,12 +2181,10 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
 {
   GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
 
-  // Find the threads that are active
-  uint worker_id = 0;
-
   // Find all regions that are available (can be filled immediately) and
-  // distribute them to the thread stacks.  The iteration is done in reverse
-  // order (high to low) so the regions will be removed in ascending order.
+  // record them for the workers to claim in chunks.  The iteration is done
+  // in reverse order (high to low) so the regions will be claimed in
+  // ascending order.
 
   const ParallelCompactData& sd = PSParallelCompact::summary_data();
 
@@ -2202,19 +2201,16 @@ void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
 
     for (size_t cur = end_region - 1; cur + 1 > beg_region; --cur) {
       if (sd.region(cur)->claim_unsafe()) {
-        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
         bool result = sd.region(cur)->mark_normal();
         assert(result, "Must succeed at this point.");
-        cm->region_stack()->push(cur);
+        ParCompactionManager::push_ready_region(cur);
         region_logger.handle(cur);
-        // Assign regions to tasks in round-robin fashion.
-        if (++worker_id == parallel_gc_threads) {
-          worker_id = 0;
-        }
       }
     }
     region_logger.print_line();
   }
+
+  ParCompactionManager::start_ready_region_claiming(parallel_gc_threads);
 }
 
 class TaskQueue : StackObj {
@@ -2371,23 +2367,22 @@ void PSParallelCompact::write_block_fill_histogram()
 }
 #endif // #ifdef ASSERT
 
-static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id) {
+static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id, Tickspan& idle_time) {
   assert(ParallelScavengeHeap::heap()->is_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
     ParCompactionManager::gc_thread_compaction_manager(worker_id);
 
-  // Drain the stacks that have been preloaded with regions
-  // that are ready to fill.
-
-  cm->drain_region_stacks();
-
   guarantee(cm->region_stack()->is_empty(), "Not empty");
 
   size_t region_index = 0;
 
   while (true) {
-    if (ParCompactionManager::steal(worker_id, region_index)) {
+    if (cm->claim_ready_regions()) {
+      // Fill the claimed chunk of regions that were ready at the start,
+      // and the regions that become ready while doing so.
+      cm->drain_region_stacks();
+    } else if (ParCompactionManager::steal(worker_id, region_index)) {
       PSParallelCompact::fill_and_update_region(cm, region_index);
       cm->drain_region_stacks();
     } else if (PSParallelCompact::steal_unavailable_region(cm, region_index)) {
@@ -2395,7 +2390,10 @@ static void compaction_with_stealing_work(TaskTerminator* terminator, uint worke
       PSParallelCompact::fill_and_update_shadow_region(cm, region_index);
       cm->drain_region_stacks();
     } else {
-      if (terminator->offer_termination()) {
+      Ticks start = Ticks::now();
+      bool terminated = terminator->offer_termination();
+      idle_time += Ticks::now() - start;
+      if (terminated) {
         break;
       }
       // Go around again.
@@ -2407,15 +2405,40 @@ class UpdateDensePrefixAndCompactionTask: public WorkerTask {
   TaskQueue& _tq;
   TaskTerminator _terminator;
   uint _active_workers;
+  Tickspan* _busy_times;
+  Tickspan* _idle_times;
 
 public:
   UpdateDensePrefixAndCompactionTask(TaskQueue& tq, uint active_workers) :
       WorkerTask("UpdateDensePrefixAndCompactionTask"),
       _tq(tq),
       _terminator(active_workers, ParCompactionManager::region_task_queues()),
-      _active_workers(active_workers) {
+      _active_workers(active_workers),
+      _busy_times(NEW_C_HEAP_ARRAY(Tickspan, active_workers, mtGC)),
+      _idle_times(NEW_C_HEAP_ARRAY(Tickspan, active_workers, mtGC)) {
+    for (uint i = 0; i < active_workers; i++) {
+      _busy_times[i] = Tickspan();
+      _idle_times[i] = Tickspan();
+    }
   }
+  ~UpdateDensePrefixAndCompactionTask() {
+    FREE_C_HEAP_ARRAY(Tickspan, _busy_times);
+    FREE_C_HEAP_ARRAY(Tickspan, _idle_times);
+  }
+
+  // Log the time each worker spent filling regions and waiting for work to steal.
+  void log_worker_times() const {
+    LogTarget(Debug, gc, phases) lt;
+    if (lt.is_enabled()) {
+      for (uint i = 0; i < _active_workers; i++) {
+        lt.print("Par Compact Worker %u: Busy %.3fms Idle %.3fms", i,
+                 _busy_times[i].seconds() * MILLIUNITS, _idle_times[i].seconds() * MILLIUNITS);
+      }
+    }
+  }
+
   virtual void work(uint worker_id) {
+    Ticks start = Ticks::now();
     ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
 
     for (PSParallelCompact::UpdateDensePrefixTask task; _tq.try_claim(task); /* empty */) {
@@ -2425,9 +2448,11 @@ public:
                                                              task._region_index_end);
     }
 
-    // Once a thread has drained it's stack, it should try to steal regions from
-    // other threads.
-    compaction_with_stealing_work(&_terminator, worker_id);
+    // Then claim chunks of the ready regions, and once those have run out,
+    // try to steal regions from other threads.
+    compaction_with_stealing_work(&_terminator, worker_id, _idle_times[worker_id]);
+
+    _busy_times[worker_id] = (Ticks::now() - start) - _idle_times[worker_id];
   }
 };
 
@@ -2455,6 +2480,8 @@ void PSParallelCompact::compact() {
 
     UpdateDensePrefixAndCompactionTask task(task_queue, active_gc_threads);
     ParallelScavengeHeap::heap()->workers().run_task(&task);
+    task.log_worker_times();
+    ParCompactionManager::remove_all_ready_regions();
 
 #ifdef  ASSERT
     // Verify that all regions have been processed before the deferred updates.
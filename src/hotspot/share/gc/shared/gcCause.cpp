@@ -135,6 +135,9 @@ const char* GCCause::to_string(GCCause::Cause cause) {
     case _z_allocation_stall:
       return "Allocation Stall";
 
+    case _z_allocation_stall_risk:
+      return "Allocation Stall Risk";
+
     case _z_proactive:
       return "Proactive";
 
@@ -89,6 +89,7 @@ class GCCause : public AllStatic {
     _z_warmup,
     _z_allocation_rate,
     _z_allocation_stall,
+    _z_allocation_stall_risk,
     _z_proactive,
     _z_high_usage,
 
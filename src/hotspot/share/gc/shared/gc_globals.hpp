@@ -278,6 +278,12 @@
   product(uintx, WorkStealingSpinToYieldRatio, 10, EXPERIMENTAL,            \
           "Ratio of hard spins to calls to yield")                          \
                                                                             \
+  product(uint, GCTaskQueueStealBatch, 1, EXPERIMENTAL,                     \
+          "Maximum number of tasks taken from the same queue by a "         \
+          "successful steal, at most half of the victim queue. 1 steals "   \
+          "a single task")                                                  \
+          range(1, 1024)                                                    \
+                                                                            \
   develop(uintx, ObjArrayMarkingStride, 2048,                               \
           "Number of object array elements to push onto the marking stack " \
           "before pushing a continuation entry")                            \
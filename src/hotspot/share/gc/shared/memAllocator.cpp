@@ -37,6 +37,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/thread.inline.hpp"
 #include "services/lowMemoryDetector.hpp"
+#include "services/threadService.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
 
@@ -59,6 +60,7 @@ class MemAllocator::Allocation: StackObj {
   void notify_allocation_low_memory_detector();
   void notify_allocation_jfr_sampler();
   void notify_allocation_dtrace_sampler();
+  void notify_allocation_perf_data();
   void check_for_bad_heap_word_value() const;
 #ifdef ASSERT
   void check_for_valid_allocation_state() const;
@@ -244,11 +246,20 @@ void MemAllocator::Allocation::notify_allocation_dtrace_sampler() {
   }
 }
 
+void MemAllocator::Allocation::notify_allocation_perf_data() {
+  // Per-thread PerfData counters are refreshed at TLAB refills and
+  // allocations outside the TLAB, not at every allocation.
+  if ((_allocated_outside_tlab || _allocated_tlab_size != 0) && _thread->is_Java_thread()) {
+    ThreadService::update_thread_perf_data(JavaThread::cast(_thread));
+  }
+}
+
 void MemAllocator::Allocation::notify_allocation() {
   notify_allocation_low_memory_detector();
   notify_allocation_jfr_sampler();
   notify_allocation_dtrace_sampler();
   notify_allocation_jvmti_sampler();
+  notify_allocation_perf_data();
 }
 
 HeapWord* MemAllocator::allocate_outside_tlab(Allocation& allocation) const {
@@ -312,24 +323,40 @@ HeapWord* MemAllocator::allocate_inside_tlab_slow(Allocation& allocation) const
 
   tlab.retire_before_allocation();
 
-  if (new_tlab_size == 0) {
-    return NULL;
-  }
-
-  // Allocate a new TLAB requesting new_tlab_size. Any size
-  // between minimal and new_tlab_size is accepted.
   size_t min_tlab_size = ThreadLocalAllocBuffer::compute_min_size(_word_size);
-  mem = Universe::heap()->allocate_new_tlab(min_tlab_size, new_tlab_size, &allocation._allocated_tlab_size);
+
+  // Refill from the reserve, if there is one, without allocating from the heap.
+  mem = tlab.take_reserve(min_tlab_size, &allocation._allocated_tlab_size);
+
   if (mem == NULL) {
-    assert(allocation._allocated_tlab_size == 0,
-           "Allocation failed, but actual size was updated. min: " SIZE_FORMAT
-           ", desired: " SIZE_FORMAT ", actual: " SIZE_FORMAT,
-           min_tlab_size, new_tlab_size, allocation._allocated_tlab_size);
-    return NULL;
+    if (new_tlab_size == 0) {
+      return NULL;
+    }
+
+    // Allocate a new TLAB requesting new_tlab_size, plus the reserve for
+    // the next refill if the thread gets one. Any size between minimal
+    // and the requested size is accepted.
+    size_t reserve_size = tlab.compute_reserve_size(new_tlab_size);
+    size_t requested_size = new_tlab_size + reserve_size;
+    mem = Universe::heap()->allocate_new_tlab(min_tlab_size, requested_size, &allocation._allocated_tlab_size);
+    if (mem == NULL) {
+      assert(allocation._allocated_tlab_size == 0,
+             "Allocation failed, but actual size was updated. min: " SIZE_FORMAT
+             ", desired: " SIZE_FORMAT ", actual: " SIZE_FORMAT,
+             min_tlab_size, requested_size, allocation._allocated_tlab_size);
+      return NULL;
+    }
+    assert(allocation._allocated_tlab_size != 0, "Allocation succeeded but actual size not updated. mem at: "
+           PTR_FORMAT " min: " SIZE_FORMAT ", desired: " SIZE_FORMAT,
+           p2i(mem), min_tlab_size, requested_size);
+
+    // Split off the reserve if enough beyond new_tlab_size was handed out.
+    if (reserve_size > 0 &&
+        allocation._allocated_tlab_size >= new_tlab_size + ThreadLocalAllocBuffer::min_size()) {
+      tlab.set_reserve(mem + new_tlab_size, mem + allocation._allocated_tlab_size);
+      allocation._allocated_tlab_size = new_tlab_size;
+    }
   }
-  assert(allocation._allocated_tlab_size != 0, "Allocation succeeded but actual size not updated. mem at: "
-         PTR_FORMAT " min: " SIZE_FORMAT ", desired: " SIZE_FORMAT,
-         p2i(mem), min_tlab_size, new_tlab_size);
 
   if (ZeroTLAB) {
     // ..and clear it.
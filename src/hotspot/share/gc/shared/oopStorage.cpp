@@ -435,8 +435,44 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // full.  The block is moved to the end of the _allocation_list if the bitmask
 // is empty, for ease of empty block deletion processing.
 
+// Locks the _allocation_mutex like MutexLocker, counting the number of
+// times the mutex was already held by another thread.
+class OopStorage::AllocationLocker : public StackObj {
+  OopStorage* _storage;
+
+  NONCOPYABLE(AllocationLocker);
+
+public:
+  explicit AllocationLocker(OopStorage* storage) : _storage(storage) {
+    Mutex* mutex = _storage->_allocation_mutex;
+    bool contended = !mutex->try_lock();
+    if (contended) {
+      mutex->lock_without_safepoint_check();
+    }
+    // Plain increments are sufficient, these are only modified while locked.
+    Atomic::store(&_storage->_allocation_lock_count,
+                  Atomic::load(&_storage->_allocation_lock_count) + 1);
+    if (contended) {
+      Atomic::store(&_storage->_allocation_contended_count,
+                    Atomic::load(&_storage->_allocation_contended_count) + 1);
+    }
+  }
+
+  ~AllocationLocker() {
+    _storage->_allocation_mutex->unlock();
+  }
+};
+
+size_t OopStorage::allocation_lock_count() const {
+  return Atomic::load(&_allocation_lock_count);
+}
+
+size_t OopStorage::allocation_contended_count() const {
+  return Atomic::load(&_allocation_contended_count);
+}
+
 oop* OopStorage::allocate() {
-  MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  AllocationLocker ml(this);
 
   Block* block = block_for_allocation();
   if (block == NULL) return NULL; // Block allocation failed.
@@ -472,7 +508,7 @@ size_t OopStorage::allocate(oop** ptrs, size_t size) {
   Block* block;
   uintx taken;
   {
-    MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+    AllocationLocker ml(this);
     block = block_for_allocation();
     if (block == NULL) return 0; // Block allocation failed.
     // Taking all remaining entries, so remove from list.
@@ -835,6 +871,8 @@ OopStorage::OopStorage(const char* name, MEMFLAGS memflags) :
   _active_mutex(make_oopstorage_mutex(name, "active", Mutex::oopstorage - 1)),
   _num_dead_callback(NULL),
   _allocation_count(0),
+  _allocation_lock_count(0),
+  _allocation_contended_count(0),
   _concurrent_iteration_count(0),
   _memflags(memflags),
   _needs_cleanup(false)
@@ -1174,6 +1212,36 @@ void OopStorage::print_on(outputStream* st) const {
   if (_concurrent_iteration_count > 0) {
     st->print(", concurrent iteration active");
   }
+  st->print(", " SIZE_FORMAT " of " SIZE_FORMAT " allocation locks contended",
+            allocation_contended_count(), allocation_lock_count());
 }
 
 #endif // !PRODUCT
+
+OopStorageAllocationCache::OopStorageAllocationCache(OopStorage* storage) :
+  _storage(storage),
+  _count(0)
+{}
+
+OopStorageAllocationCache::~OopStorageAllocationCache() {
+  flush();
+}
+
+oop* OopStorageAllocationCache::allocate() {
+  if (_count == 0) {
+    _count = _storage->allocate(_entries, cache_size);
+    if (_count == 0) {
+      return NULL;              // Block allocation failed.
+    }
+  }
+  oop* result = _entries[--_count];
+  assert(*result == NULL, "cached entry must be clear");
+  return result;
+}
+
+void OopStorageAllocationCache::flush() {
+  if (_count > 0) {
+    _storage->release(_entries, _count);
+    _count = 0;
+  }
+}
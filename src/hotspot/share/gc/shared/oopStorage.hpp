@@ -126,6 +126,11 @@ public:
   // postcondition: *ptrs[i] == NULL for i in [0, result).
   size_t allocate(oop** ptrs, size_t size);
 
+  // The number of times allocation has locked _allocation_mutex, and how
+  // many of those found it held by another thread.  Racy, for statistics.
+  size_t allocation_lock_count() const;
+  size_t allocation_contended_count() const;
+
   // Deallocates ptr.  No locking.
   // precondition: ptr is a valid allocated entry.
   // precondition: *ptr == NULL.
@@ -270,6 +275,11 @@ private:
   // Volatile for racy unlocked accesses.
   volatile size_t _allocation_count;
 
+  // Allocation mutex statistics; only updated while holding the mutex.
+  volatile size_t _allocation_lock_count;
+  volatile size_t _allocation_contended_count;
+  class AllocationLocker;       // RAII helper for counting allocation locking.
+
   // Protection for _active_array.
   mutable SingleWriterSynchronizer _protect_active;
 
@@ -321,4 +331,39 @@ private:
   template<typename F> static SkipNullFn<F> skip_null_fn(F f);
 };
 
+// A cache of entries obtained from an OopStorage in bulk, for use by a
+// single thread at a time.  Taking an entry from the cache needs no locking,
+// and refilling an empty cache locks the allocation mutex of the storage
+// once for up to cache_size entries.  Cached entries are allocated entries
+// containing NULL, and are seen as such by iteration and counted by
+// allocation_count() of the storage.  Unused entries are released by flush()
+// and by the destructor.
+class OopStorageAllocationCache : public CHeapObj<mtInternal> {
+public:
+  static const size_t cache_size = 16;
+
+private:
+  OopStorage* const _storage;
+  size_t _count;
+  oop* _entries[cache_size];
+
+  NONCOPYABLE(OopStorageAllocationCache);
+
+public:
+  explicit OopStorageAllocationCache(OopStorage* storage);
+  ~OopStorageAllocationCache();
+
+  OopStorage* storage() const { return _storage; }
+
+  // The number of entries taken from the storage but not yet handed out.
+  size_t count() const { return _count; }
+
+  // Returns a new entry of the storage, or NULL if memory allocation failed.
+  // postcondition: result == NULL or *result == NULL.
+  oop* allocate();
+
+  // Releases all cached entries back to the storage.
+  void flush();
+};
+
 #endif // SHARE_GC_SHARED_OOPSTORAGE_HPP
@@ -28,6 +28,7 @@
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/ostream.hpp"
 
 OopStorage* OopStorageSet::_storages[all_count] = {};
 
@@ -82,6 +83,14 @@ template OopStorage* OopStorageSet::get_storage(StrongId);
 template OopStorage* OopStorageSet::get_storage(WeakId);
 template OopStorage* OopStorageSet::get_storage(Id);
 
+void OopStorageSet::print_allocation_contention_on(outputStream* st) {
+  for (OopStorage* storage : Range<Id>()) {
+    st->print_cr("%s: " SIZE_FORMAT " of " SIZE_FORMAT " allocation locks contended",
+                 storage->name(), storage->allocation_contended_count(),
+                 storage->allocation_lock_count());
+  }
+}
+
 #ifdef ASSERT
 
 void OopStorageSet::verify_initialized(uint index) {
@@ -32,6 +32,7 @@
 #include "utilities/macros.hpp"
 
 class OopStorage;
+class outputStream;
 
 class OopStorageSet : public AllStatic {
   friend class OopStorageSetTest;
@@ -89,6 +90,9 @@ public:
   template <typename Closure>
   static void strong_oops_do(Closure* cl);
 
+  // Prints the allocation mutex contention counters of each storage.
+  static void print_allocation_contention_on(outputStream* st);
+
 };
 
 ENUMERATOR_VALUE_RANGE(OopStorageSet::StrongId,
@@ -63,6 +63,13 @@ public:
   // precondition: chunk_size must be the same as used to start the task sequence.
   inline Step next(arrayOop from, arrayOop to, int chunk_size) const;
 
+  // Variants for objects that are not arrays but are split the same way,
+  // such as the stack of a stack chunk.  length is the number of elements,
+  // and claim_addr is the address of a value, not otherwise used while the
+  // object is being processed, that tracks the processing progress.
+  inline Step start(int length, int* claim_addr, int chunk_size) const;
+  inline Step next(int length, int* claim_addr, int chunk_size) const;
+
   class TestSupport;            // For unit tests
 
 private:
@@ -115,4 +115,14 @@ PartialArrayTaskStepper::next(arrayOop from, arrayOop to, int chunk_size) const
   return next_impl(from->length(), to->length_addr(), chunk_size);
 }
 
+PartialArrayTaskStepper::Step
+PartialArrayTaskStepper::start(int length, int* claim_addr, int chunk_size) const {
+  return start_impl(length, claim_addr, chunk_size);
+}
+
+PartialArrayTaskStepper::Step
+PartialArrayTaskStepper::next(int length, int* claim_addr, int chunk_size) const {
+  return next_impl(length, claim_addr, chunk_size);
+}
+
 #endif // SHARE_GC_SHARED_PARTIALARRAYTASKSTEPPER_INLINE_HPP
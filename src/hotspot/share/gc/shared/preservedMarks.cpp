@@ -25,7 +25,6 @@
 #include "precompiled.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/workerThread.hpp"
-#include "gc/shared/workerUtils.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
@@ -52,12 +51,18 @@ void PreservedMarks::adjust_during_full_gc() {
   }
 }
 
-void PreservedMarks::restore_and_increment(volatile size_t* const total_size_addr) {
-  const size_t stack_size = size();
-  restore();
-  // Only do the atomic add if the size is > 0.
-  if (stack_size > 0) {
-    Atomic::add(total_size_addr, stack_size);
+void PreservedMarks::Chunk::restore() const {
+  for (size_t i = 0; i < _size; i += 1) {
+    _start[i].set_mark();
+  }
+}
+
+void PreservedMarks::add_chunks(GrowableArrayCHeap<Chunk, mtGC>* chunks) {
+  StackIterator<OopAndMarkWord, mtGC> iter(_stack);
+  while (!iter.is_empty()) {
+    size_t chunk_size;
+    const OopAndMarkWord* start = iter.next_segment(&chunk_size);
+    chunks->append(Chunk(start, chunk_size));
   }
 }
 
@@ -87,9 +92,14 @@ void PreservedMarksSet::init(uint num) {
   assert_empty();
 }
 
+// Restores the preserved marks of all stacks in parallel.  Workers claim
+// the stack segments one at a time rather than whole stacks, which keeps
+// them balanced when the marks were preserved by only a few threads.
+// The segments are reclaimed when the task is destroyed.
 class RestorePreservedMarksTask : public WorkerTask {
   PreservedMarksSet* const _preserved_marks_set;
-  SequentialSubTasksDone _sub_tasks;
+  GrowableArrayCHeap<PreservedMarks::Chunk, mtGC> _chunks;
+  volatile int _next_chunk;
   volatile size_t _total_size;
 #ifdef ASSERT
   size_t _total_size_before;
@@ -97,27 +107,40 @@ class RestorePreservedMarksTask : public WorkerTask {
 
 public:
   void work(uint worker_id) override {
-    uint task_id = 0;
-    while (_sub_tasks.try_claim_task(task_id)) {
-      _preserved_marks_set->get(task_id)->restore_and_increment(&_total_size);
+    size_t restored = 0;
+    for (int i = Atomic::fetch_and_add(&_next_chunk, 1);
+         i < _chunks.length();
+         i = Atomic::fetch_and_add(&_next_chunk, 1)) {
+      const PreservedMarks::Chunk& chunk = _chunks.at(i);
+      chunk.restore();
+      restored += chunk.size();
+    }
+    // Only do the atomic add if the size is > 0.
+    if (restored > 0) {
+      Atomic::add(&_total_size, restored);
     }
   }
 
   RestorePreservedMarksTask(PreservedMarksSet* preserved_marks_set)
     : WorkerTask("Restore Preserved Marks"),
       _preserved_marks_set(preserved_marks_set),
-      _sub_tasks(preserved_marks_set->num()),
+      _chunks(),
+      _next_chunk(0),
       _total_size(0)
       DEBUG_ONLY(COMMA _total_size_before(0)) {
-#ifdef ASSERT
-    // This is to make sure the total_size we'll calculate below is correct.
     for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+      _preserved_marks_set->get(i)->add_chunks(&_chunks);
+#ifdef ASSERT
+      // This is to make sure the total_size we'll calculate below is correct.
       _total_size_before += _preserved_marks_set->get(i)->size();
-    }
 #endif // ASSERT
+    }
   }
 
   ~RestorePreservedMarksTask() {
+    for (uint i = 0; i < _preserved_marks_set->num(); ++i) {
+      _preserved_marks_set->get(i)->clear();
+    }
     assert(_total_size == _total_size_before, "total_size = %zu before = %zu", _total_size, _total_size_before);
     size_t mem_size = _total_size * (sizeof(oop) + sizeof(markWord));
     log_trace(gc)("Restored %zu marks, occupying %zu %s", _total_size,
@@ -143,6 +166,14 @@ WorkerTask* PreservedMarksSet::create_task() {
   return new RestorePreservedMarksTask(this);
 }
 
+size_t PreservedMarksSet::num_chunks() const {
+  size_t result = 0;
+  for (uint i = 0; i < _num; ++i) {
+    result += get(i)->num_chunks();
+  }
+  return result;
+}
+
 void PreservedMarksSet::reclaim() {
   assert_empty();
 
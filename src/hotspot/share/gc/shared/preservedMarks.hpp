@@ -28,6 +28,7 @@
 #include "memory/allocation.hpp"
 #include "memory/padded.hpp"
 #include "oops/oop.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/stack.hpp"
 
 class WorkerTask;
@@ -55,6 +56,21 @@ private:
   inline bool should_preserve_mark(oop obj, markWord m) const;
 
 public:
+  // A run of preserved marks stored contiguously in one stack segment.
+  // Chunks are the unit of work of the parallel restore, so that a single
+  // large stack does not end up being restored by one worker.
+  class Chunk {
+    const OopAndMarkWord* _start;
+    size_t _size;
+
+  public:
+    Chunk() : _start(NULL), _size(0) { }
+    Chunk(const OopAndMarkWord* start, size_t size) : _start(start), _size(size) { }
+
+    size_t size() const { return _size; }
+    void restore() const;
+  };
+
   size_t size() const { return _stack.size(); }
   inline void push_if_necessary(oop obj, markWord m);
   inline void push_always(oop obj, markWord m);
@@ -65,7 +81,14 @@ public:
   // to their forwarding location stored in the mark.
   void adjust_during_full_gc();
 
-  void restore_and_increment(volatile size_t* const _total_size_addr);
+  // Append a chunk for every segment of the stack to chunks.
+  void add_chunks(GrowableArrayCHeap<Chunk, mtGC>* chunks);
+  // The number of chunks add_chunks() appends.
+  size_t num_chunks() const {
+    return (_stack.size() + _stack.segment_size() - 1) / _stack.segment_size();
+  }
+  // Reclaim the stack segments once all chunks have been restored.
+  void clear() { _stack.clear(true); }
 
   // Assert the stack is empty and has no cached segments.
   void assert_empty() PRODUCT_RETURN;
@@ -109,6 +132,8 @@ public:
   void restore(WorkerThreads* workers);
 
   WorkerTask* create_task();
+  // The number of chunks, the units of work, of the task restoring all stacks.
+  size_t num_chunks() const;
 
   // Reclaim stack array.
   void reclaim();
@@ -116,8 +116,9 @@ bool StringDedup::Processor::yield_or_continue(SuspendibleThreadSetJoiner* joine
 
 void StringDedup::Processor::cleanup_table(SuspendibleThreadSetJoiner* joiner,
                                            bool grow_only,
-                                           bool force) const {
-  if (Table::cleanup_start_if_needed(grow_only, force)) {
+                                           bool force,
+                                           size_t expected_entries) const {
+  if (Table::cleanup_start_if_needed(grow_only, force, expected_entries)) {
     Stat::Phase phase = Table::cleanup_phase();
     while (yield_or_continue(joiner, phase)) {
       if (!Table::cleanup_step()) break;
@@ -142,6 +143,17 @@ class StringDedup::Processor::ProcessRequest final : public OopClosure {
     }
   }
 
+  // Estimate of the new table entries from the requests still to be
+  // processed, based on the fraction of new strings seen so far.
+  size_t expected_new_entries() const {
+    size_t inspected = _cur_stat.inspected();
+    if (inspected == 0) {
+      return 0;
+    }
+    double new_fraction = (double)_cur_stat.new_count() / inspected;
+    return static_cast<size_t>(_storage->allocation_count() * new_fraction);
+  }
+
 public:
   ProcessRequest(OopStorage* storage, SuspendibleThreadSetJoiner* joiner) :
     _storage(storage),
@@ -172,7 +184,10 @@ public:
         Table::deduplicate(java_string);
         if (Table::is_grow_needed()) {
           _cur_stat.report_process_pause();
-          _processor->cleanup_table(_joiner, true /* grow_only */, false /* force */);
+          _processor->cleanup_table(_joiner,
+                                    true /* grow_only */,
+                                    false /* force */,
+                                    expected_new_entries());
           _cur_stat.report_process_resume();
         }
       }
@@ -203,7 +218,8 @@ void StringDedup::Processor::run_service() {
     _cur_stat.report_process_end();
     cleanup_table(&sts_joiner,
                   false /* grow_only */,
-                  StringDeduplicationResizeALot /* force */);
+                  StringDeduplicationResizeALot /* force */,
+                  0 /* expected_entries */);
     if (should_terminate()) break;
     _cur_stat.report_concurrent_end();
     log_statistics();
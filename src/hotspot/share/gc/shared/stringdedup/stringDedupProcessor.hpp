@@ -62,7 +62,10 @@ class StringDedup::Processor : public ConcurrentGCThread {
 
   class ProcessRequest;
   void process_requests(SuspendibleThreadSetJoiner* joiner) const;
-  void cleanup_table(SuspendibleThreadSetJoiner* joiner, bool grow_only, bool force) const;
+  void cleanup_table(SuspendibleThreadSetJoiner* joiner,
+                     bool grow_only,
+                     bool force,
+                     size_t expected_entries) const;
 
   void log_statistics();
 
@@ -84,6 +84,9 @@ private:
 public:
   Stat();
 
+  size_t inspected() const { return _inspected; }
+  size_t new_count() const { return _new; }
+
   // Track number of strings looked up.
   void inc_inspected() {
     _inspected++;
@@ -666,7 +666,9 @@ void StringDedup::Table::deduplicate(oop java_string) {
   }
 }
 
-bool StringDedup::Table::cleanup_start_if_needed(bool grow_only, bool force) {
+bool StringDedup::Table::cleanup_start_if_needed(bool grow_only,
+                                                 bool force,
+                                                 size_t expected_entries) {
   assert(_cleanup_state == nullptr, "cleanup already in progress");
   if (!is_dead_count_good_acquire()) return false;
   // If dead count is good then we can read it once and use it below
@@ -679,7 +681,7 @@ bool StringDedup::Table::cleanup_start_if_needed(bool grow_only, bool force) {
   assert(dead_count <= _number_of_entries, "invariant");
   size_t adjusted = _number_of_entries - dead_count;
   if (force || Config::should_grow_table(_number_of_buckets, adjusted)) {
-    return start_resizer(grow_only, adjusted);
+    return start_resizer(grow_only, adjusted + expected_entries);
   } else if (grow_only) {
     return false;
   } else if (Config::should_shrink_table(_number_of_buckets, adjusted)) {
@@ -125,9 +125,11 @@ public:
 
   // If cleanup (resizing or removing dead entries) is needed or force
   // is true, setup cleanup state and return true.  If result is true,
-  // the caller must eventually call cleanup_end.
+  // the caller must eventually call cleanup_end.  A table that needs to
+  // grow is sized for expected_entries more entries than it has, so that
+  // a large batch of new strings does not grow the table repeatedly.
   // precondition: no cleanup is in progress.
-  static bool cleanup_start_if_needed(bool grow_only, bool force);
+  static bool cleanup_start_if_needed(bool grow_only, bool force, size_t expected_entries);
 
   // Perform some cleanup work.  Returns true if any progress was made,
   // false if there is no further work to do.
@@ -485,6 +485,11 @@ private:
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // After a successful steal from queue victim, moves up to half of the
+  // remaining elements of victim, but less than max_batch, to the local queue
+  // queue_num. Returns the number of elements moved.
+  uint steal_batch(uint queue_num, uint victim, uint max_batch);
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
@@ -496,9 +501,15 @@ public:
   T* queue(uint n);
 
   // Try to steal a task from some other queue than queue_num. It may perform several attempts at doing so.
-  // Returns if stealing succeeds, and sets "t" to the stolen task.
+  // Returns if stealing succeeds, and sets "t" to the stolen task. Steals up to
+  // GCTaskQueueStealBatch tasks at once, see below.
   bool steal(uint queue_num, E& t);
 
+  // As above, but on success also moves up to max_batch - 1 further tasks from
+  // the same queue to queue_num, at most half of what that queue holds. This
+  // spreads the work of a deep queue with fewer rounds of victim selection.
+  bool steal(uint queue_num, E& t, uint max_batch);
+
   DEBUG_ONLY(virtual void assert_empty() const;)
 
   virtual uint tasks() const;
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_SHARED_TASKQUEUE_INLINE_HPP
 #define SHARE_GC_SHARED_TASKQUEUE_INLINE_HPP
 
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/taskqueue.hpp"
 
 #include "logging/log.hpp"
@@ -372,14 +373,54 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
   }
 }
 
+// Batching uses the regular single element pop_global() on the victim. Taking
+// several elements with a single CAS of the victim's age would race with
+// pop_local() of the owner, which only synchronizes with thieves about the
+// last element in the queue.
+template<class T, MEMFLAGS F>
+uint GenericTaskQueueSet<T, F>::steal_batch(uint queue_num, uint victim, uint max_batch) {
+  T* const local_queue = queue(queue_num);
+  T* const victim_queue = queue(victim);
+
+  // Only take what surely fits into the local queue, and leave the victim
+  // at least as much as taken, so that it does not become the next thief.
+  uint const local_free = local_queue->max_elems() - local_queue->size();
+  uint const batch = MIN3(max_batch - 1, victim_queue->size() / 2, local_free);
+
+  uint moved = 0;
+  E t;
+  while (moved < batch) {
+    PopResult res = victim_queue->pop_global(t);
+    TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res != PopResult::Success) {
+      break;
+    }
+    bool pushed = local_queue->push(t);
+    assert(pushed, "must have space for stolen element");
+    moved++;
+  }
+  return moved;
+}
+
 template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
+  return steal(queue_num, t, GCTaskQueueStealBatch);
+}
+
+template<class T, MEMFLAGS F>
+bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t, uint max_batch) {
   uint const num_retries = 2 * _n;
 
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
     PopResult sr = steal_best_of_2(queue_num, t);
     if (sr == PopResult::Success) {
+      if (max_batch > 1 && _n > 1) {
+        // steal_best_of_2() remembers the victim, except when there is
+        // only one other queue.
+        uint victim = (_n == 2) ? (queue_num + 1) % 2 : queue(queue_num)->last_stolen_queue_id();
+        steal_batch(queue_num, victim, max_batch);
+      }
       return true;
     } else if (sr == PopResult::Contended) {
       TASKQUEUE_STATS_ONLY(
@@ -36,6 +36,7 @@
 #include "runtime/thread.inline.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/copy.hpp"
+#include "utilities/ostream.hpp"
 
 size_t       ThreadLocalAllocBuffer::_max_size = 0;
 int          ThreadLocalAllocBuffer::_reserve_for_allocation_prefetch = 0;
@@ -47,6 +48,8 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _pf_top(NULL),
   _end(NULL),
   _allocation_end(NULL),
+  _reserve_start(NULL),
+  _reserve_end(NULL),
   _desired_size(0),
   _refill_waste_limit(0),
   _allocated_before_last_gc(0),
@@ -56,7 +59,11 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _gc_waste(0),
   _slow_allocations(0),
   _allocated_size(0),
-  _allocation_fraction(TLABAllocationWeight) {
+  _reserve_refills(0),
+  _reserve_waste(0),
+  _refills_before_last_gc(0),
+  _allocation_fraction(TLABAllocationWeight),
+  _waste_fraction(TLABAllocationWeight) {
 
   // do nothing. TLABs must be inited by initialize() calls
 }
@@ -102,6 +109,12 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
       _allocation_fraction.sample(alloc_frac);
     }
 
+    if (TLABWasteAwareResize && _allocated_size > 0) {
+      // Keep waste_frac as float and not double to avoid the double to float conversion
+      float waste_frac = MIN2(1.0f, (_gc_waste + _refill_waste) / (float) _allocated_size);
+      _waste_fraction.sample(waste_frac);
+    }
+
     stats->update_fast_allocations(_number_of_refills,
                                    _allocated_size,
                                    _gc_waste,
@@ -113,6 +126,7 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   stats->update_slow_allocations(_slow_allocations);
 
+  _refills_before_last_gc = _number_of_refills;
   reset_statistics();
 }
 
@@ -124,6 +138,9 @@ void ThreadLocalAllocBuffer::insert_filler() {
 }
 
 void ThreadLocalAllocBuffer::make_parsable() {
+  // The reserve is parsable, but it must not be used for allocation after
+  // a safepoint that may have started a GC cycle.
+  discard_reserve();
   if (end() != NULL) {
     invariants();
     if (ZeroTLAB) {
@@ -135,10 +152,16 @@ void ThreadLocalAllocBuffer::make_parsable() {
 }
 
 void ThreadLocalAllocBuffer::retire(ThreadLocalAllocStats* stats) {
+  discard_reserve();
+
   if (stats != NULL) {
     accumulate_and_reset_statistics(stats);
   }
 
+  retire_current();
+}
+
+void ThreadLocalAllocBuffer::retire_current() {
   if (end() != NULL) {
     invariants();
     thread()->incr_allocated_bytes(used_bytes());
@@ -149,7 +172,49 @@ void ThreadLocalAllocBuffer::retire(ThreadLocalAllocStats* stats) {
 
 void ThreadLocalAllocBuffer::retire_before_allocation() {
   _refill_waste += (unsigned int)remaining();
-  retire();
+  // The reserve is kept for the refill that follows.
+  retire_current();
+}
+
+size_t ThreadLocalAllocBuffer::compute_reserve_size(size_t new_tlab_size) {
+  // Only threads that have already refilled more than once since the last
+  // GC are likely to need another refill soon.
+  if (!TLABReserve || _number_of_refills < 2) {
+    return 0;
+  }
+  const size_t reserve = desired_size();
+  const size_t available_size = Universe::heap()->unsafe_max_tlab_alloc(thread()) / HeapWordSize;
+  if (new_tlab_size + reserve > MIN2(available_size, max_size())) {
+    return 0;
+  }
+  return reserve;
+}
+
+void ThreadLocalAllocBuffer::set_reserve(HeapWord* start, HeapWord* end) {
+  assert(reserve_size() == 0, "reserve already set");
+  assert(pointer_delta(end, start) >= min_size(), "reserve too small");
+  Universe::heap()->fill_with_dummy_object(start, end, true);
+  _reserve_start = start;
+  _reserve_end = end;
+}
+
+HeapWord* ThreadLocalAllocBuffer::take_reserve(size_t min_size, size_t* actual_size) {
+  size_t size = reserve_size();
+  if (size == 0 || size < min_size) {
+    return NULL;
+  }
+  HeapWord* result = _reserve_start;
+  _reserve_start = NULL;
+  _reserve_end = NULL;
+  _reserve_refills++;
+  *actual_size = size;
+  return result;
+}
+
+void ThreadLocalAllocBuffer::discard_reserve() {
+  _reserve_waste += reserve_size();
+  _reserve_start = NULL;
+  _reserve_end = NULL;
 }
 
 void ThreadLocalAllocBuffer::resize() {
@@ -159,6 +224,20 @@ void ThreadLocalAllocBuffer::resize() {
                           (Universe::heap()->tlab_capacity(thread()) / HeapWordSize));
   size_t new_size = alloc / _target_refills;
 
+  if (TLABWasteAwareResize) {
+    // Shrink the tlabs of threads that waste more than the target, in
+    // proportion, and grow the tlabs of threads that waste little but
+    // refill much more often than targeted, e.g. because they allocate in
+    // bursts; every refill is an allocation slow path.
+    const double waste = _waste_fraction.average();
+    const double target = TLABWasteTargetPercent / 100.0;
+    if (waste > target) {
+      new_size = (size_t)(new_size * MAX2(0.5, target / waste));
+    } else if (waste < target / 2 && _refills_before_last_gc > 2 * _target_refills) {
+      new_size *= 2;
+    }
+  }
+
   new_size = clamp(new_size, min_size(), max_size());
 
   size_t aligned_new_size = align_object_size(new_size);
@@ -178,6 +257,8 @@ void ThreadLocalAllocBuffer::reset_statistics() {
   _gc_waste          = 0;
   _slow_allocations  = 0;
   _allocated_size    = 0;
+  _reserve_refills   = 0;
+  _reserve_waste     = 0;
 }
 
 void ThreadLocalAllocBuffer::fill(HeapWord* start,
@@ -311,6 +392,19 @@ void ThreadLocalAllocBuffer::print_stats(const char* tag) {
             _refill_waste * HeapWordSize);
 }
 
+void ThreadLocalAllocBuffer::print_on(outputStream* st) {
+  size_t waste = _gc_waste + _refill_waste;
+  st->print_cr("desired_size: " SIZE_FORMAT "KB refills: %u slow allocs: %u"
+               " allocated: " SIZE_FORMAT "KB waste: %4.1f%% (gc: " SIZE_FORMAT "B refill: " SIZE_FORMAT "B)"
+               " alloc fraction: %8.5f waste fraction: %8.5f"
+               " reserve refills: %u reserve discarded: " SIZE_FORMAT "B",
+               _desired_size / (K / HeapWordSize), _number_of_refills, _slow_allocations,
+               _allocated_size / (K / HeapWordSize), percent_of(waste, _allocated_size),
+               (size_t)_gc_waste * HeapWordSize, (size_t)_refill_waste * HeapWordSize,
+               _allocation_fraction.average(), _waste_fraction.average(),
+               _reserve_refills, _reserve_waste * HeapWordSize);
+}
+
 void ThreadLocalAllocBuffer::set_sample_end(bool reset_byte_accumulation) {
   size_t heap_words_remaining = pointer_delta(_end, _top);
   size_t bytes_until_sample = thread()->heap_sampler().bytes_until_sample();
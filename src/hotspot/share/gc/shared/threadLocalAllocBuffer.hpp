@@ -31,6 +31,7 @@
 #include "utilities/sizes.hpp"
 
 class ThreadLocalAllocStats;
+class outputStream;
 
 // ThreadLocalAllocBuffer: a descriptor for thread-local storage used by
 // the threads for allocation.
@@ -52,6 +53,8 @@ private:
   HeapWord* _pf_top;                             // allocation prefetch watermark
   HeapWord* _end;                                // allocation end (can be the sampling end point or _allocation_end)
   HeapWord* _allocation_end;                     // end for allocations (actual TLAB end, excluding alignment_reserve)
+  HeapWord* _reserve_start;                      // start of the reserve for the next refill
+  HeapWord* _reserve_end;                        // end of the reserve for the next refill
 
   size_t    _desired_size;                       // desired size   (including alignment_reserve)
   size_t    _refill_waste_limit;                 // hold onto tlab if free() is larger than this
@@ -67,8 +70,12 @@ private:
   unsigned  _gc_waste;
   unsigned  _slow_allocations;
   size_t    _allocated_size;
+  unsigned  _reserve_refills;
+  size_t    _reserve_waste;                      // total size of discarded reserves
+  unsigned  _refills_before_last_gc;
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
+  AdaptiveWeightedAverage _waste_fraction;       // fraction of tlab space wasted
 
   void reset_statistics();
 
@@ -90,6 +97,13 @@ private:
   // Make parsable and release it.
   void reset();
 
+  // Retire the current tlab, keeping the reserve.
+  void retire_current();
+
+  // Drop the reserve. It has been filled with a dummy object when it was
+  // set up, so only its space is lost.
+  void discard_reserve();
+
   void invariants() const { assert(top() >= start() && top() <= end(), "invalid tlab"); }
 
   void initialize(HeapWord* start, HeapWord* top, HeapWord* end);
@@ -128,6 +142,8 @@ public:
   // Don't discard tlab if remaining space is larger than this.
   size_t refill_waste_limit() const              { return _refill_waste_limit; }
   size_t bytes_since_last_sample_point() const   { return _bytes_since_last_sample_point; }
+  // Averaged fraction of eden allocated by this thread.
+  float allocation_fraction() const              { return _allocation_fraction.average(); }
 
   // For external inspection.
   const HeapWord* start_relaxed() const;
@@ -152,6 +168,18 @@ public:
   // Record slow allocation
   inline void record_slow_allocation(size_t obj_size);
 
+  // TLAB reserve support. With TLABReserve, a thread that refills often gets
+  // a reserve carved from the end of a new TLAB, which is used for the next
+  // refill instead of allocating from the heap again. The reserve never
+  // survives a safepoint that retires or makes the TLAB parsable.
+  size_t reserve_size() const                    { return pointer_delta(_reserve_end, _reserve_start); }
+  // Size of the reserve to request together with a new tlab of new_tlab_size, or 0.
+  size_t compute_reserve_size(size_t new_tlab_size);
+  // Install [start, end) as the reserve, filling it with a dummy object.
+  void set_reserve(HeapWord* start, HeapWord* end);
+  // Take the reserve if it is at least min_size, or return NULL.
+  HeapWord* take_reserve(size_t min_size, size_t* actual_size);
+
   // Initialization at startup
   static void startup_initialization();
 
@@ -170,6 +198,9 @@ public:
   void fill(HeapWord* start, HeapWord* top, size_t new_size);
   void initialize();
 
+  // Print the statistics of this tlab since the last GC, for diagnostics.
+  void print_on(outputStream* st);
+
   void set_back_allocation_end();
   void set_sample_end(bool reset_byte_accumulation);
 
@@ -181,6 +212,8 @@ public:
     f(&_pf_top);
     f(&_end);
     f(&_allocation_end);
+    f(&_reserve_start);
+    f(&_reserve_end);
   }
 
   // Code generation support
@@ -85,6 +85,15 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  product(bool, TLABWasteAwareResize, false, EXPERIMENTAL,                  \
+          "Also weigh the waste and the refill count of a thread when "     \
+          "resizing its TLAB")                                              \
+                                                                            \
+  product(bool, TLABReserve, false, EXPERIMENTAL,                           \
+          "Allocate a reserve for the next refill together with the TLAB "  \
+          "of threads that refill often, so that the refill does not "      \
+          "allocate from the heap")                                         \
+                                                                            \
 
 // end of TLAB_FLAGS
 
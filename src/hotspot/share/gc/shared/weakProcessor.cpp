@@ -108,9 +108,27 @@ void WeakProcessor::Task::initialize() {
   if (_times) {
     _times->set_active_workers(_nworkers);
   }
+  initialize_storage_order();
   notify_jvmti_tagmaps();
 }
 
+void WeakProcessor::Task::initialize_storage_order() {
+  // Insertion sort by decreasing block count; there are only a handful
+  // of storages.
+  size_t n = 0;
+  for (WeakId id : EnumRange<WeakId>()) {
+    size_t blocks = OopStorageSet::storage(id)->block_count();
+    size_t i = n++;
+    for ( ; i > 0; --i) {
+      if (OopStorageSet::storage(_storage_order[i - 1])->block_count() >= blocks) {
+        break;
+      }
+      _storage_order[i] = _storage_order[i - 1];
+    }
+    _storage_order[i] = id;
+  }
+}
+
 WeakProcessor::Task::Task(uint nworkers) : Task(nullptr, nworkers) {}
 
 WeakProcessor::Task::Task(WeakProcessorTimes* times, uint nworkers) :
@@ -26,9 +26,11 @@
 #define SHARE_GC_SHARED_WEAKPROCESSOR_HPP
 
 #include "gc/shared/oopStorageParState.hpp"
+#include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/oopStorageSetParState.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "memory/allStatic.hpp"
+#include "utilities/enumIterator.hpp"
 
 class WeakProcessorTimes;
 class WorkerThreads;
@@ -84,12 +86,19 @@ private:
 
 class WeakProcessor::Task {
   typedef OopStorage::ParState<false, false> StorageState;
+  typedef OopStorageSet::WeakId WeakId;
 
   WeakProcessorTimes* _times;
   uint _nworkers;
   OopStorageSetWeakParState<false, false> _storage_states;
+  // The storages in the order workers process them, largest first.  All
+  // workers start on the biggest storage and move on to the smaller ones
+  // as its blocks run out, so the small storages fill in the tail of the
+  // phase instead of a large one being left for the last few workers.
+  WeakId _storage_order[EnumRange<WeakId>().size()];
 
   void initialize();
+  void initialize_storage_order();
 
 public:
   Task(uint nworkers);          // No time tracking.
@@ -83,7 +83,7 @@ void WeakProcessor::Task::work(uint worker_id,
          "worker_id (%u) exceeds task's configured workers (%u)",
          worker_id, _nworkers);
 
-  for (auto id : EnumRange<OopStorageSet::WeakId>()) {
+  for (WeakId id : _storage_order) {
     CountingClosure<IsAlive, KeepAlive> cl(is_alive, keep_alive);
     WeakProcessorParTimeTracker pt(_times, id, worker_id);
     StorageState* cur_state = _storage_states.par_state(id);
@@ -27,40 +27,49 @@
 #include "gc/shared/workerPolicy.hpp"
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/os.hpp"
 #include "runtime/vm_version.hpp"
 
 uint WorkerPolicy::_parallel_worker_threads = 0;
 bool WorkerPolicy::_parallel_worker_threads_initialized = false;
+volatile uint WorkerPolicy::_last_processor_count = 0;
+
+uint WorkerPolicy::worker_threads_for_processors(uint ncpus,
+                                                 uint num,
+                                                 uint den,
+                                                 uint switch_pt) {
+  uint threads;
+  // For very large machines, there are diminishing returns
+  // for large numbers of worker threads.  Instead of
+  // hogging the whole system, use a fraction of the workers for every
+  // processor after the first 8.  For example, on a 72 cpu machine
+  // and a chosen fraction of 5/8
+  // use 8 + (72 - 8) * (5/8) == 48 worker threads.
+  threads = (ncpus <= switch_pt) ?
+            ncpus :
+            (switch_pt + ((ncpus - switch_pt) * num) / den);
+#ifndef _LP64
+  // On 32-bit binaries the virtual address space available to the JVM
+  // is usually limited to 2-3 GB (depends on the platform).
+  // Do not use up address space with too many threads (stacks and per-thread
+  // data). Note that x86 apps running on Win64 have 2 stacks per thread.
+  // GC may more generally scale down threads by max heap size (etc), but the
+  // consequences of over-provisioning threads are higher on 32-bit JVMS,
+  // so add hard limit here:
+  threads = MIN2(threads, (2 * switch_pt));
+#endif
+  return threads;
+}
 
 uint WorkerPolicy::nof_parallel_worker_threads(uint num,
                                                uint den,
                                                uint switch_pt) {
   if (FLAG_IS_DEFAULT(ParallelGCThreads)) {
     assert(ParallelGCThreads == 0, "Default ParallelGCThreads is not 0");
-    uint threads;
-    // For very large machines, there are diminishing returns
-    // for large numbers of worker threads.  Instead of
-    // hogging the whole system, use a fraction of the workers for every
-    // processor after the first 8.  For example, on a 72 cpu machine
-    // and a chosen fraction of 5/8
-    // use 8 + (72 - 8) * (5/8) == 48 worker threads.
     uint ncpus = (uint) os::initial_active_processor_count();
-    threads = (ncpus <= switch_pt) ?
-              ncpus :
-              (switch_pt + ((ncpus - switch_pt) * num) / den);
-#ifndef _LP64
-    // On 32-bit binaries the virtual address space available to the JVM
-    // is usually limited to 2-3 GB (depends on the platform).
-    // Do not use up address space with too many threads (stacks and per-thread
-    // data). Note that x86 apps running on Win64 have 2 stacks per thread.
-    // GC may more generally scale down threads by max heap size (etc), but the
-    // consequences of over-provisioning threads are higher on 32-bit JVMS,
-    // so add hard limit here:
-    threads = MIN2(threads, (2 * switch_pt));
-#endif
-    return threads;
+    return worker_threads_for_processors(ncpus, num, den, switch_pt);
   } else {
     return ParallelGCThreads;
   }
@@ -71,6 +80,23 @@ uint WorkerPolicy::calc_parallel_worker_threads() {
   return nof_parallel_worker_threads(5, den, 8);
 }
 
+uint WorkerPolicy::calc_workers_by_processors() {
+  // The number of available processors may change while the VM runs,
+  // e.g. when the CPU quota of the container is updated.  The container
+  // support caches the quota for a short time, so this is cheap enough
+  // to do for every collection.
+  uint ncpus = (uint) os::active_processor_count();
+  uint den = VM_Version::parallel_worker_threads_denominator();
+  uint threads = worker_threads_for_processors(ncpus, 5, den, 8);
+
+  uint prev_ncpus = Atomic::xchg(&_last_processor_count, ncpus);
+  if (prev_ncpus != 0 && prev_ncpus != ncpus) {
+    log_info(gc, task)("Active processor count changed from %u to %u, "
+                       "limiting GC workers to %u", prev_ncpus, ncpus, threads);
+  }
+  return threads;
+}
+
 uint WorkerPolicy::parallel_worker_threads() {
   if (!_parallel_worker_threads_initialized) {
     if (FLAG_IS_DEFAULT(ParallelGCThreads)) {
@@ -119,6 +145,12 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   uintx max_active_workers =
     MAX2(active_workers_by_JT, active_workers_by_heap_size);
 
+  // Do not use more workers than the processors currently available to
+  // the VM can keep busy.
+  uintx active_workers_by_cpus =
+    MAX2((uintx) calc_workers_by_processors(), min_workers);
+  max_active_workers = MIN2(max_active_workers, active_workers_by_cpus);
+
   new_active_workers = MIN2(max_active_workers, (uintx) total_workers);
 
   // Increase GC workers instantly but decrease them more
@@ -136,9 +168,10 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   log_trace(gc, task)("WorkerPolicy::calc_default_active_workers() : "
     "active_workers(): " UINTX_FORMAT "  new_active_workers: " UINTX_FORMAT "  "
     "prev_active_workers: " UINTX_FORMAT "\n"
-    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT,
+    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT
+    "  active_workers_by_cpus: " UINTX_FORMAT,
     active_workers, new_active_workers, prev_active_workers,
-    active_workers_by_JT, active_workers_by_heap_size);
+    active_workers_by_JT, active_workers_by_heap_size, active_workers_by_cpus);
   assert(new_active_workers > 0, "Always need at least 1");
   return new_active_workers;
 }
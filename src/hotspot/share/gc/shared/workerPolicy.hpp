@@ -34,6 +34,14 @@ class WorkerPolicy : public AllStatic {
   static bool _debug_perturbation;
   static uint _parallel_worker_threads;
   static bool _parallel_worker_threads_initialized;
+  // Processor count seen by the last calc_workers_by_processors().
+  static volatile uint _last_processor_count;
+
+  // Returns the number of worker threads to use for ncpus processors.
+  static uint worker_threads_for_processors(uint ncpus,
+                                            uint num,
+                                            uint den,
+                                            uint switch_pt);
 
   static uint nof_parallel_worker_threads(uint num,
                                           uint den,
@@ -43,6 +51,10 @@ class WorkerPolicy : public AllStatic {
   // be CPU-architecture-specific.
   static uint calc_parallel_worker_threads();
 
+  // Returns the number of workers the currently available processors
+  // support, logging changes of the processor count.
+  static uint calc_workers_by_processors();
+
 public:
   // Returns the number of parallel threads to be used as default value of
   // ParallelGCThreads. If that number has not been calculated, do so and
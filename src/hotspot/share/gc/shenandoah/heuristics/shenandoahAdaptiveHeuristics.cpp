@@ -54,11 +54,19 @@ const double ShenandoahAdaptiveHeuristics::HIGHEST_EXPECTED_AVAILABLE_AT_END = 0
 const double ShenandoahAdaptiveHeuristics::MINIMUM_CONFIDENCE = 0.319; // 25%
 const double ShenandoahAdaptiveHeuristics::MAXIMUM_CONFIDENCE = 3.291; // 99.9%
 
+// The cycle time model forgets old cycles slowly, so that it covers daily
+// variations in live set and occupancy, and needs a few cycles to learn.
+const double ShenandoahCycleTimeModel::DECAY_FACTOR = 0.95;
+const size_t ShenandoahCycleTimeModel::MIN_SAMPLES = 5;
+
 ShenandoahAdaptiveHeuristics::ShenandoahAdaptiveHeuristics() :
   ShenandoahHeuristics(),
   _margin_of_error_sd(ShenandoahAdaptiveInitialConfidence),
   _spike_threshold_sd(ShenandoahAdaptiveInitialSpikeThreshold),
-  _last_trigger(OTHER) { }
+  _last_trigger(OTHER),
+  _last_live(0),
+  _cycle_start_live(0),
+  _cycle_start_used(0) { }
 
 ShenandoahAdaptiveHeuristics::~ShenandoahAdaptiveHeuristics() {}
 
@@ -123,12 +131,29 @@ void ShenandoahAdaptiveHeuristics::choose_collection_set_from_regiondata(Shenand
 void ShenandoahAdaptiveHeuristics::record_cycle_start() {
   ShenandoahHeuristics::record_cycle_start();
   _allocation_rate.allocation_counter_reset();
+  _cycle_start_live = _last_live;
+  _cycle_start_used = ShenandoahHeap::heap()->used();
 }
 
 void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
   ShenandoahHeuristics::record_success_concurrent();
 
-  size_t available = ShenandoahHeap::heap()->free_set()->available();
+  ShenandoahHeap* heap = ShenandoahHeap::heap();
+  double cycle_time = time_since_last_gc();
+
+  if (_cycle_start_live > 0) {
+    if (_cycle_time_model.is_ready()) {
+      double predicted = _cycle_time_model.predict(_cycle_start_live, _cycle_start_used);
+      log_debug(gc, ergo)("Cycle time: %.2f ms, predicted: %.2f ms for live " SIZE_FORMAT "%s, used " SIZE_FORMAT "%s",
+                          cycle_time * 1000, predicted * 1000,
+                          byte_size_in_proper_unit(_cycle_start_live), proper_unit_for_byte_size(_cycle_start_live),
+                          byte_size_in_proper_unit(_cycle_start_used), proper_unit_for_byte_size(_cycle_start_used));
+    }
+    _cycle_time_model.add(_cycle_start_live, _cycle_start_used, cycle_time);
+  }
+  _last_live = heap->used();
+
+  size_t available = heap->free_set()->available();
 
   _available.add(available);
   double z_score = 0.0;
@@ -177,6 +202,7 @@ void ShenandoahAdaptiveHeuristics::record_success_concurrent() {
 
 void ShenandoahAdaptiveHeuristics::record_success_degenerated() {
   ShenandoahHeuristics::record_success_degenerated();
+  _last_live = ShenandoahHeap::heap()->used();
   // Adjust both trigger's parameters in the case of a degenerated GC because
   // either of them should have triggered earlier to avoid this case.
   adjust_margin_of_error(DEGENERATE_PENALTY_SD);
@@ -185,6 +211,7 @@ void ShenandoahAdaptiveHeuristics::record_success_degenerated() {
 
 void ShenandoahAdaptiveHeuristics::record_success_full() {
   ShenandoahHeuristics::record_success_full();
+  _last_live = ShenandoahHeap::heap()->used();
   // Adjust both trigger's parameters in the case of a full GC because
   // either of them should have triggered earlier to avoid this case.
   adjust_margin_of_error(FULL_PENALTY_SD);
@@ -241,11 +268,12 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
   allocation_headroom -= MIN2(allocation_headroom, spike_headroom);
   allocation_headroom -= MIN2(allocation_headroom, penalties);
 
-  double avg_cycle_time = _gc_time_history->davg() + (_margin_of_error_sd * _gc_time_history->dsd());
+  double avg_cycle_time = predicted_cycle_time(heap->used());
   double avg_alloc_rate = _allocation_rate.upper_bound(_margin_of_error_sd);
+  const char* estimate = _cycle_time_model.is_ready() && ShenandoahAdaptiveCycleTimeModel ? "Predicted" : "Average";
   if (avg_cycle_time > allocation_headroom / avg_alloc_rate) {
-    log_info(gc)("Trigger: Average GC time (%.2f ms) is above the time for average allocation rate (%.0f %sB/s) to deplete free headroom (" SIZE_FORMAT "%s) (margin of error = %.2f)",
-                 avg_cycle_time * 1000,
+    log_info(gc)("Trigger: %s GC time (%.2f ms) is above the time for average allocation rate (%.0f %sB/s) to deplete free headroom (" SIZE_FORMAT "%s) (margin of error = %.2f)",
+                 estimate, avg_cycle_time * 1000,
                  byte_size_in_proper_unit(avg_alloc_rate), proper_unit_for_byte_size(avg_alloc_rate),
                  byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom),
                  _margin_of_error_sd);
@@ -262,8 +290,8 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
 
   bool is_spiking = _allocation_rate.is_spiking(rate, _spike_threshold_sd);
   if (is_spiking && avg_cycle_time > allocation_headroom / rate) {
-    log_info(gc)("Trigger: Average GC time (%.2f ms) is above the time for instantaneous allocation rate (%.0f %sB/s) to deplete free headroom (" SIZE_FORMAT "%s) (spike threshold = %.2f)",
-                 avg_cycle_time * 1000,
+    log_info(gc)("Trigger: %s GC time (%.2f ms) is above the time for instantaneous allocation rate (%.0f %sB/s) to deplete free headroom (" SIZE_FORMAT "%s) (spike threshold = %.2f)",
+                 estimate, avg_cycle_time * 1000,
                  byte_size_in_proper_unit(rate), proper_unit_for_byte_size(rate),
                  byte_size_in_proper_unit(allocation_headroom), proper_unit_for_byte_size(allocation_headroom),
                  _spike_threshold_sd);
@@ -274,6 +302,21 @@ bool ShenandoahAdaptiveHeuristics::should_start_gc() {
   return ShenandoahHeuristics::should_start_gc();
 }
 
+double ShenandoahAdaptiveHeuristics::predicted_cycle_time(size_t used) {
+  double avg_cycle_time = _gc_time_history->davg() + (_margin_of_error_sd * _gc_time_history->dsd());
+  if (!ShenandoahAdaptiveCycleTimeModel || !_cycle_time_model.is_ready()) {
+    return avg_cycle_time;
+  }
+
+  double predicted = _cycle_time_model.upper_bound(_last_live, used, _margin_of_error_sd);
+  log_trace(gc, ergo)("Predicted GC time: %.2f ms for live " SIZE_FORMAT "%s, used " SIZE_FORMAT "%s (average GC time: %.2f ms)",
+                      predicted * 1000,
+                      byte_size_in_proper_unit(_last_live), proper_unit_for_byte_size(_last_live),
+                      byte_size_in_proper_unit(used),       proper_unit_for_byte_size(used),
+                      avg_cycle_time * 1000);
+  return predicted;
+}
+
 void ShenandoahAdaptiveHeuristics::adjust_last_trigger_parameters(double amount) {
   switch (_last_trigger) {
     case RATE:
@@ -365,3 +408,101 @@ double ShenandoahAllocationRate::instantaneous_rate(double time, size_t allocate
   double time_delta_sec = time - last_time;
   return (time_delta_sec > 0)  ? (allocation_delta / time_delta_sec) : 0;
 }
+
+ShenandoahCycleTimeModel::ShenandoahCycleTimeModel() :
+  _num_samples(0),
+  _sum_w(0.0),
+  _sum_live(0.0),
+  _sum_used(0.0),
+  _sum_time(0.0),
+  _sum_live_live(0.0),
+  _sum_live_used(0.0),
+  _sum_used_used(0.0),
+  _sum_live_time(0.0),
+  _sum_used_time(0.0),
+  _errors(10, ShenandoahAdaptiveDecayFactor) {
+}
+
+void ShenandoahCycleTimeModel::add(size_t live, size_t used, double cycle_time) {
+  if (is_ready()) {
+    // Track how far off the model was, this is used for the confidence bounds.
+    _errors.add(cycle_time - predict(live, used));
+  }
+
+  double x1 = (double)live / M;
+  double x2 = (double)used / M;
+
+  _sum_w         = _sum_w         * DECAY_FACTOR + 1.0;
+  _sum_live      = _sum_live      * DECAY_FACTOR + x1;
+  _sum_used      = _sum_used      * DECAY_FACTOR + x2;
+  _sum_time      = _sum_time      * DECAY_FACTOR + cycle_time;
+  _sum_live_live = _sum_live_live * DECAY_FACTOR + x1 * x1;
+  _sum_live_used = _sum_live_used * DECAY_FACTOR + x1 * x2;
+  _sum_used_used = _sum_used_used * DECAY_FACTOR + x2 * x2;
+  _sum_live_time = _sum_live_time * DECAY_FACTOR + x1 * cycle_time;
+  _sum_used_time = _sum_used_time * DECAY_FACTOR + x2 * cycle_time;
+  _num_samples++;
+
+  if (log_is_enabled(Debug, gc, ergo)) {
+    double intercept, live_slope, used_slope;
+    fit(&intercept, &live_slope, &used_slope);
+    log_debug(gc, ergo)("Cycle time model: %.2f ms + %.4f ms/MB live + %.4f ms/MB used, error: %.2f ms +/- %.2f ms",
+                        intercept * 1000, live_slope * 1000, used_slope * 1000,
+                        _errors.avg() * 1000, _errors.sd() * 1000);
+  }
+}
+
+bool ShenandoahCycleTimeModel::is_ready() const {
+  return _num_samples >= MIN_SAMPLES;
+}
+
+void ShenandoahCycleTimeModel::fit(double* intercept, double* live_slope, double* used_slope) const {
+  assert(_sum_w > 0, "Should have samples");
+
+  double mean_live = _sum_live / _sum_w;
+  double mean_used = _sum_used / _sum_w;
+  double mean_time = _sum_time / _sum_w;
+
+  double var_live      = _sum_live_live / _sum_w - mean_live * mean_live;
+  double var_used      = _sum_used_used / _sum_w - mean_used * mean_used;
+  double cov_live_used = _sum_live_used / _sum_w - mean_live * mean_used;
+  double cov_live_time = _sum_live_time / _sum_w - mean_live * mean_time;
+  double cov_used_time = _sum_used_time / _sum_w - mean_used * mean_time;
+
+  // Solve the normal equations. Live set and occupancy are often strongly
+  // correlated, or one of them hardly varies, in which case we fall back
+  // to a single variable fit. Negative slopes are not plausible and are
+  // treated the same way.
+  double b1 = 0.0;
+  double b2 = 0.0;
+  double det = var_live * var_used - cov_live_used * cov_live_used;
+  if (det > 1e-6 * var_live * var_used) {
+    b1 = (cov_live_time * var_used - cov_used_time * cov_live_used) / det;
+    b2 = (cov_used_time * var_live - cov_live_time * cov_live_used) / det;
+  }
+  if (b1 < 0.0 || b2 < 0.0 || (b1 == 0.0 && b2 == 0.0)) {
+    b1 = 0.0;
+    b2 = 0.0;
+    if (var_used > 0.0 && cov_used_time > 0.0) {
+      b2 = cov_used_time / var_used;
+    } else if (var_live > 0.0 && cov_live_time > 0.0) {
+      b1 = cov_live_time / var_live;
+    }
+  }
+
+  *live_slope = b1;
+  *used_slope = b2;
+  *intercept = mean_time - b1 * mean_live - b2 * mean_used;
+}
+
+double ShenandoahCycleTimeModel::predict(size_t live, size_t used) const {
+  double intercept, live_slope, used_slope;
+  fit(&intercept, &live_slope, &used_slope);
+  double predicted = intercept + live_slope * ((double)live / M) + used_slope * ((double)used / M);
+  return MAX2(0.0, predicted);
+}
+
+double ShenandoahCycleTimeModel::upper_bound(size_t live, size_t used, double sds) const {
+  // Correct for the bias of past predictions, and add the margin of error.
+  return predict(live, used) + _errors.davg() + (sds * _errors.dsd());
+}
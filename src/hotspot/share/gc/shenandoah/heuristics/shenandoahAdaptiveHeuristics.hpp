@@ -51,6 +51,42 @@ class ShenandoahAllocationRate : public CHeapObj<mtGC> {
   TruncatedSeq _rate_avg;
 };
 
+// Learns the concurrent cycle time as a linear function of the live set
+// and the heap occupancy at the start of the cycle. Marking time mostly
+// depends on the former, evacuation and update-refs time on the latter.
+class ShenandoahCycleTimeModel : public CHeapObj<mtGC> {
+ public:
+  explicit ShenandoahCycleTimeModel();
+
+  void add(size_t live, size_t used, double cycle_time);
+
+  bool is_ready() const;
+  double predict(size_t live, size_t used) const;
+  double upper_bound(size_t live, size_t used, double sds) const;
+
+ private:
+  const static double DECAY_FACTOR;
+  const static size_t MIN_SAMPLES;
+
+  void fit(double* intercept, double* live_slope, double* used_slope) const;
+
+  size_t _num_samples;
+
+  // Exponentially decayed sums for the least squares fit, in seconds and MB.
+  double _sum_w;
+  double _sum_live;
+  double _sum_used;
+  double _sum_time;
+  double _sum_live_live;
+  double _sum_live_used;
+  double _sum_used_used;
+  double _sum_live_time;
+  double _sum_used_time;
+
+  // Prediction errors of the model for past cycles.
+  TruncatedSeq _errors;
+};
+
 class ShenandoahAdaptiveHeuristics : public ShenandoahHeuristics {
 public:
   ShenandoahAdaptiveHeuristics();
@@ -99,8 +135,17 @@ public:
   void adjust_margin_of_error(double amount);
   void adjust_spike_threshold(double amount);
 
+  double predicted_cycle_time(size_t used);
+
   ShenandoahAllocationRate _allocation_rate;
 
+  // Learned cycle time model, and the inputs for the running cycle. The live
+  // set is estimated by the heap occupancy at the end of the last cycle.
+  ShenandoahCycleTimeModel _cycle_time_model;
+  size_t _last_live;
+  size_t _cycle_start_live;
+  size_t _cycle_start_used;
+
   // The margin of error expressed in standard deviations to add to our
   // average cycle time and allocation rate. As this value increases we
   // tend to over estimate the rate at which mutators will deplete the
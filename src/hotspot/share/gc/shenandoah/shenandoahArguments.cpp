@@ -63,8 +63,8 @@ void ShenandoahArguments::initialize() {
     }
   }
 
-  // Enable NUMA by default. While Shenandoah is not NUMA-aware, enabling NUMA makes
-  // storage allocation code NUMA-aware.
+  // Enable NUMA by default. Shenandoah binds regions to NUMA nodes and prefers
+  // node-local regions for allocation, and storage allocation code is NUMA-aware too.
   if (FLAG_IS_DEFAULT(UseNUMA)) {
     FLAG_SET_DEFAULT(UseNUMA, true);
   }
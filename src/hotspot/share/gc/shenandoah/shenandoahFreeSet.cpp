@@ -28,9 +28,13 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc/shenandoah/shenandoahPadding.hpp"
+#include "gc/shenandoah/shenandoahUtils.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
@@ -73,11 +77,37 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
   //
   // Free set maintains mutator and collector views, and normally they allocate in their views only,
   // unless we special cases for stealing and mixed allocations.
+  //
+  // With NUMA, regions are interleaved over the nodes, and allocations prefer the regions
+  // local to the requesting thread before falling back to the first fit in the view. This
+  // runs under the heap lock, so the node-local scan only probes the first few free regions
+  // from the allocation bound of the view: with interleaving, they usually include one for
+  // every node, and a view with fewer free regions than that is nearly exhausted anyway.
+
+  int numa_id = (_heap->num_numa_nodes() > 1) ? os::numa_get_group_id() : -1;
+  size_t numa_probes = (size_t)_heap->num_numa_nodes() * 4;
 
   switch (req.type()) {
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
+      // Try to allocate in the node-local part of mutator view
+      if (numa_id >= 0) {
+        size_t probed = 0;
+        for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost && probed < numa_probes; idx++) {
+          if (is_mutator_free(idx)) {
+            probed++;
+            ShenandoahHeapRegion* r = _heap->get_region(idx);
+            if (r->numa_id() == numa_id) {
+              HeapWord* result = try_allocate_in(r, req, in_new_region);
+              if (result != NULL) {
+                return result;
+              }
+            }
+          }
+        }
+      }
+
       // Try to allocate in the mutator view
       for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
         if (is_mutator_free(idx)) {
@@ -95,7 +125,25 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_shared_gc: {
       // size_t is unsigned, need to dodge underflow when _leftmost = 0
 
-      // Fast-path: try to allocate in the collector view first
+      // Fast-path: try to allocate in the node-local part of collector view first
+      if (numa_id >= 0) {
+        size_t probed = 0;
+        for (size_t c = _collector_rightmost + 1; c > _collector_leftmost && probed < numa_probes; c--) {
+          size_t idx = c - 1;
+          if (is_collector_free(idx)) {
+            probed++;
+            ShenandoahHeapRegion* r = _heap->get_region(idx);
+            if (r->numa_id() == numa_id) {
+              HeapWord* result = try_allocate_in(r, req, in_new_region);
+              if (result != NULL) {
+                return result;
+              }
+            }
+          }
+        }
+      }
+
+      // Then try to allocate anywhere in the collector view
       for (size_t c = _collector_rightmost + 1; c > _collector_leftmost; c--) {
         size_t idx = c - 1;
         if (is_collector_free(idx)) {
@@ -402,11 +450,10 @@ void ShenandoahFreeSet::clear_internal() {
   _used = 0;
 }
 
-void ShenandoahFreeSet::rebuild() {
-  shenandoah_assert_heaplocked();
-  clear();
+size_t ShenandoahFreeSet::add_mutator_free(size_t start, size_t end) {
+  size_t capacity = 0;
 
-  for (size_t idx = 0; idx < _heap->num_regions(); idx++) {
+  for (size_t idx = start; idx < end; idx++) {
     ShenandoahHeapRegion* region = _heap->get_region(idx);
     if (region->is_alloc_allowed() || region->is_trash()) {
       assert(!region->is_cset(), "Shouldn't be adding those to the free set");
@@ -414,14 +461,73 @@ void ShenandoahFreeSet::rebuild() {
       // Do not add regions that would surely fail allocation
       if (has_no_alloc_capacity(region)) continue;
 
-      _capacity += alloc_capacity(region);
-      assert(_used <= _capacity, "must not use more than we have");
+      capacity += alloc_capacity(region);
 
       assert(!is_mutator_free(idx), "We are about to add it, it shouldn't be there already");
       _mutator_free_bitmap.set_bit(idx);
     }
   }
 
+  return capacity;
+}
+
+class ShenandoahRebuildFreeSetTask : public WorkerTask {
+private:
+  ShenandoahFreeSet* const _free_set;
+  const size_t _num_regions;
+  const size_t _stride;
+
+  shenandoah_padding(0);
+  volatile size_t _index;
+  shenandoah_padding(1);
+  volatile size_t _capacity;
+  shenandoah_padding(2);
+
+public:
+  ShenandoahRebuildFreeSetTask(ShenandoahFreeSet* free_set, size_t num_regions) :
+          WorkerTask("Shenandoah Rebuild Free Set"),
+          _free_set(free_set),
+          _num_regions(num_regions),
+          // Workers own whole bitmap words, so they can set bits without atomics
+          _stride(align_up(ShenandoahParallelRegionStride, BitsPerWord)),
+          _index(0),
+          _capacity(0) {}
+
+  void work(uint worker_id) {
+    ShenandoahParallelWorkerSession worker_session(worker_id);
+
+    // Collect the capacity of the claimed chunks, and merge it once at the end
+    size_t capacity = 0;
+    while (Atomic::load(&_index) < _num_regions) {
+      size_t start = Atomic::fetch_and_add(&_index, _stride, memory_order_relaxed);
+      if (start >= _num_regions) break;
+
+      size_t end = MIN2(start + _stride, _num_regions);
+      capacity += _free_set->add_mutator_free(start, end);
+    }
+
+    Atomic::add(&_capacity, capacity, memory_order_relaxed);
+  }
+
+  size_t capacity() const {
+    return Atomic::load(&_capacity);
+  }
+};
+
+void ShenandoahFreeSet::rebuild() {
+  shenandoah_assert_heaplocked();
+  clear();
+
+  size_t num_regions = _heap->num_regions();
+  if (num_regions > ShenandoahParallelRegionStride) {
+    ShenandoahRebuildFreeSetTask task(this, num_regions);
+    _heap->workers()->run_task(&task);
+    _capacity = task.capacity();
+  } else {
+    _capacity = add_mutator_free(0, num_regions);
+  }
+  assert(_used <= _capacity, "must not use more than we have");
+
   // Evac reserve: reserve trailing space for evacuations
   size_t to_reserve = _heap->max_capacity() / 100 * ShenandoahEvacReserve;
   size_t reserved = 0;
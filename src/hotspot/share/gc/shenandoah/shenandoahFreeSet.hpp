@@ -29,6 +29,8 @@
 #include "gc/shenandoah/shenandoahHeap.hpp"
 
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
+  friend class ShenandoahRebuildFreeSetTask;
+
 private:
   ShenandoahHeap* const _heap;
   CHeapBitMap _mutator_free_bitmap;
@@ -70,6 +72,8 @@ private:
   size_t alloc_capacity(ShenandoahHeapRegion *r);
   bool has_no_alloc_capacity(ShenandoahHeapRegion *r);
 
+  size_t add_mutator_free(size_t start, size_t end);
+
 public:
   ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions);
 
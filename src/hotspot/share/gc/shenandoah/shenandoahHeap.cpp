@@ -318,6 +318,15 @@ jint ShenandoahHeap::initialize() {
   _regions = NEW_C_HEAP_ARRAY(ShenandoahHeapRegion*, _num_regions, mtGC);
   _free_set = new ShenandoahFreeSet(this, _num_regions);
 
+  // Interleave regions over the NUMA nodes, so that local regions are
+  // found close to the allocation bounds of the free set for every node.
+  int* numa_ids = NULL;
+  if (UseNUMA) {
+    size_t num_groups = os::numa_get_groups_num();
+    numa_ids = NEW_C_HEAP_ARRAY(int, num_groups, mtGC);
+    _num_numa_nodes = MAX2((uint)os::numa_get_leaf_groups(numa_ids, num_groups), 1u);
+  }
+
   {
     ShenandoahHeapLocker locker(lock());
 
@@ -326,7 +335,9 @@ jint ShenandoahHeap::initialize() {
       bool is_committed = i < num_committed_regions;
       void* loc = region_storage.base() + i * region_align;
 
-      ShenandoahHeapRegion* r = new (loc) ShenandoahHeapRegion(start, i, is_committed);
+      int numa_id = (_num_numa_nodes > 1) ? numa_ids[i % _num_numa_nodes] : -1;
+
+      ShenandoahHeapRegion* r = new (loc) ShenandoahHeapRegion(start, i, is_committed, numa_id);
       assert(is_aligned(r, SHENANDOAH_CACHE_LINE_SIZE), "Sanity");
 
       _marking_context->initialize_top_at_mark_start(r);
@@ -340,6 +351,10 @@ jint ShenandoahHeap::initialize() {
     _free_set->rebuild();
   }
 
+  if (numa_ids != NULL) {
+    FREE_C_HEAP_ARRAY(int, numa_ids);
+  }
+
   if (AlwaysPreTouch) {
     // For NUMA, it is important to pre-touch the storage under bitmaps with worker threads,
     // before initialize() below zeroes it with initializing thread. For any given region,
@@ -465,6 +480,7 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _heap_region_special(false),
   _num_regions(0),
   _regions(NULL),
+  _num_numa_nodes(1),
   _update_refs_iterator(this),
   _control_thread(NULL),
   _shenandoah_policy(policy),
@@ -818,12 +834,13 @@ HeapWord* ShenandoahHeap::allocate_new_gclab(size_t min_size,
 
 HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
   intptr_t pacer_epoch = 0;
+  bool paced_locally = false;
   bool in_new_region = false;
   HeapWord* result = NULL;
 
   if (req.is_mutator_alloc()) {
     if (ShenandoahPacing) {
-      pacer()->pace_for_alloc(req.size());
+      paced_locally = pacer()->pace_for_alloc(req.size());
       pacer_epoch = pacer()->epoch();
     }
 
@@ -881,7 +898,7 @@ HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
       // This only matters if we are in the same pacing epoch: do not try to unpace
       // over the budget for the other phase.
       if (ShenandoahPacing && (pacer_epoch > 0) && (requested > actual)) {
-        pacer()->unpace_for_alloc(pacer_epoch, requested - actual);
+        pacer()->unpace_for_alloc(pacer_epoch, requested - actual, paced_locally);
       }
     } else {
       increase_used(actual*HeapWordSize);
@@ -1660,6 +1677,8 @@ void ShenandoahHeap::prepare_regions_and_collection_set(bool concurrent) {
     ShenandoahGCPhase phase(concurrent ? ShenandoahPhaseTimings::final_rebuild_freeset :
                                          ShenandoahPhaseTimings::degen_gc_final_rebuild_freeset);
     ShenandoahHeapLocker locker(lock());
+    ShenandoahTimingsTracker locked(concurrent ? ShenandoahPhaseTimings::final_rebuild_freeset_locked :
+                                                ShenandoahPhaseTimings::degen_gc_final_rebuild_freeset_locked);
     _free_set->rebuild();
   }
 }
@@ -2126,6 +2145,9 @@ void ShenandoahHeap::rebuild_free_set(bool concurrent) {
                             ShenandoahPhaseTimings::final_update_refs_rebuild_freeset :
                             ShenandoahPhaseTimings::degen_gc_final_update_refs_rebuild_freeset);
     ShenandoahHeapLocker locker(lock());
+    ShenandoahTimingsTracker locked(concurrent ?
+                                    ShenandoahPhaseTimings::final_update_refs_rebuild_freeset_locked :
+                                    ShenandoahPhaseTimings::degen_gc_final_update_refs_rebuild_freeset_locked);
     _free_set->rebuild();
   }
 }
@@ -226,6 +226,7 @@ private:
   bool      _heap_region_special;
   size_t    _num_regions;
   ShenandoahHeapRegion** _regions;
+  uint      _num_numa_nodes;
   ShenandoahRegionIterator _update_refs_iterator;
 
 public:
@@ -233,6 +234,7 @@ public:
   inline HeapWord* base() const { return _heap_region.start(); }
 
   inline size_t num_regions() const { return _num_regions; }
+  inline uint num_numa_nodes() const { return _num_numa_nodes; }
   inline bool is_heap_region_special() { return _heap_region_special; }
 
   inline ShenandoahHeapRegion* const heap_region_containing(const void* addr) const;
@@ -55,10 +55,11 @@ size_t ShenandoahHeapRegion::HumongousThresholdWords = 0;
 size_t ShenandoahHeapRegion::MaxTLABSizeBytes = 0;
 size_t ShenandoahHeapRegion::MaxTLABSizeWords = 0;
 
-ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool committed) :
+ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool committed, int numa_id) :
   _index(index),
   _bottom(start),
   _end(start + RegionSizeWords),
+  _numa_id(numa_id),
   _new_top(NULL),
   _empty_time(os::elapsedTime()),
   _state(committed ? _empty_committed : _empty_uncommitted),
@@ -71,6 +72,9 @@ ShenandoahHeapRegion::ShenandoahHeapRegion(HeapWord* start, size_t index, bool c
 
   assert(Universe::on_page_boundary(_bottom) && Universe::on_page_boundary(_end),
          "invalid space boundaries");
+  if (committed) {
+    make_numa_local();
+  }
   if (ZapUnusedHeapArea && committed) {
     SpaceMangler::mangle_region(MemRegion(_bottom, _end));
   }
@@ -636,6 +640,7 @@ void ShenandoahHeapRegion::do_commit() {
   if (!heap->is_heap_region_special() && !os::commit_memory((char *) bottom(), RegionSizeBytes, false)) {
     report_java_out_of_memory("Unable to commit region");
   }
+  make_numa_local();
   if (!heap->commit_bitmap_slice(this)) {
     report_java_out_of_memory("Unable to commit bitmaps for region");
   }
@@ -645,6 +650,13 @@ void ShenandoahHeapRegion::do_commit() {
   heap->increase_committed(ShenandoahHeapRegion::region_size_bytes());
 }
 
+void ShenandoahHeapRegion::make_numa_local() {
+  // Bind the region memory to its node before it is first touched
+  if (_numa_id >= 0) {
+    os::numa_make_local((char *) bottom(), RegionSizeBytes, _numa_id);
+  }
+}
+
 void ShenandoahHeapRegion::do_uncommit() {
   ShenandoahHeap* heap = ShenandoahHeap::heap();
   if (!heap->is_heap_region_special() && !os::uncommit_memory((char *) bottom(), RegionSizeBytes)) {
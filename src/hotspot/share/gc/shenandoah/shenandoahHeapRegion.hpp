@@ -227,6 +227,7 @@ private:
   size_t const _index;
   HeapWord* const _bottom;
   HeapWord* const _end;
+  int const _numa_id;
 
   // Rarely updated fields
   HeapWord* _new_top;
@@ -247,7 +248,7 @@ private:
   HeapWord* volatile _update_watermark;
 
 public:
-  ShenandoahHeapRegion(HeapWord* start, size_t index, bool committed);
+  ShenandoahHeapRegion(HeapWord* start, size_t index, bool committed, int numa_id);
 
   static const size_t MIN_NUM_REGIONS = 10;
 
@@ -334,6 +335,11 @@ public:
     return _index;
   }
 
+  // NUMA node the region memory is bound to, or -1 if not NUMA-aware
+  inline int numa_id() const {
+    return _numa_id;
+  }
+
   // Allocation (return NULL if full)
   inline HeapWord* allocate(size_t word_size, ShenandoahAllocRequest::Type type);
 
@@ -391,6 +397,7 @@ public:
 private:
   void do_commit();
   void do_uncommit();
+  void make_numa_local();
 
   void oop_iterate_objects(OopIterateClosure* cl);
   void oop_iterate_humongous(OopIterateClosure* cl);
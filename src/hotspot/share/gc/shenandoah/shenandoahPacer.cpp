@@ -182,6 +182,7 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_initial_budget, (intptr_t)initial);
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -206,7 +207,51 @@ bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
   return true;
 }
 
-void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
+intptr_t ShenandoahPacer::claim_up_to(intptr_t words) {
+  intptr_t cur = 0;
+  intptr_t claimed = 0;
+  do {
+    cur = Atomic::load(&_budget);
+    claimed = MIN2(words, cur);
+    if (claimed <= 0) {
+      // Progress depleted, nothing to claim.
+      return 0;
+    }
+  } while (Atomic::cmpxchg(&_budget, cur, cur - claimed, memory_order_relaxed) != cur);
+  return claimed;
+}
+
+/*
+ * Thread-local budgets are reserved lazily, on the first allocation of the thread in
+ * a new pacing phase. The reservation is the share of the phase budget that matches
+ * the fraction of eden the thread allocated recently, as tracked by its TLAB. Threads
+ * allocating at a low rate then run off their own reservation for most of the phase,
+ * while the allocation-heavy threads deplete theirs early and wait for GC progress.
+ */
+
+bool ShenandoahPacer::claim_thread_local(JavaThread* thread, size_t words) {
+  const intptr_t epoch = Atomic::load(&_epoch);
+  intptr_t budget = ShenandoahThreadLocalData::pacing_budget(thread);
+
+  if (ShenandoahThreadLocalData::pacing_epoch(thread) != epoch) {
+    // New phase, reserve the allocation share. Leftovers from the
+    // previous phase are dropped, like the global budget is.
+    const double share = UseTLAB ? thread->tlab().allocation_fraction() : 0.0;
+    budget = claim_up_to((intptr_t)(Atomic::load(&_initial_budget) * share));
+  }
+
+  intptr_t tax = MAX2<intptr_t>(1, words * Atomic::load(&_tax_rate));
+  if (budget < tax) {
+    // Local budget depleted, claim from the shared budget instead.
+    ShenandoahThreadLocalData::set_pacing_budget(thread, epoch, budget);
+    return false;
+  }
+
+  ShenandoahThreadLocalData::set_pacing_budget(thread, epoch, budget - tax);
+  return true;
+}
+
+void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words, bool paid_locally) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
   if (Atomic::load(&_epoch) != epoch) {
@@ -215,6 +260,16 @@ void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
   }
 
   size_t tax = MAX2<size_t>(1, words * Atomic::load(&_tax_rate));
+  if (paid_locally) {
+    // The tax came out of the thread-local budget, give it back there:
+    // the shared budget never paid it.
+    JavaThread* thread = JavaThread::current();
+    if (ShenandoahThreadLocalData::pacing_epoch(thread) == epoch) {
+      ShenandoahThreadLocalData::set_pacing_budget(thread, epoch,
+                                                   ShenandoahThreadLocalData::pacing_budget(thread) + (intptr_t)tax);
+    }
+    return;
+  }
   add_budget(tax);
 }
 
@@ -222,13 +277,18 @@ intptr_t ShenandoahPacer::epoch() {
   return Atomic::load(&_epoch);
 }
 
-void ShenandoahPacer::pace_for_alloc(size_t words) {
+bool ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
-  // Fast path: try to allocate right away
+  // Fast path: try to allocate from the thread-local budget
+  if (ShenandoahPacingThreadLocal && claim_thread_local(JavaThread::current(), words)) {
+    return true;
+  }
+
+  // Try to allocate from the shared budget right away
   bool claimed = claim_for_alloc(words, false);
   if (claimed) {
-    return;
+    return false;
   }
 
   // Forcefully claim the budget: it may go negative at this point, and
@@ -242,7 +302,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // fully initialized yet. Blocking them would be awkward.
   // This is probably the path that allocates the thread oop itself.
   if (JavaThread::current()->is_attaching_via_jni()) {
-    return;
+    return false;
   }
 
   double start = os::elapsedTime();
@@ -268,6 +328,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       break;
     }
   }
+  return false;
 }
 
 void ShenandoahPacer::wait(size_t time_ms) {
@@ -29,6 +29,7 @@
 #include "gc/shenandoah/shenandoahPadding.hpp"
 #include "memory/allocation.hpp"
 
+class JavaThread;
 class ShenandoahHeap;
 
 #define PACING_PROGRESS_UNINIT (-1)
@@ -39,6 +40,9 @@ class ShenandoahHeap;
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * With ShenandoahPacingThreadLocal, every thread first reserves a part of the phase
+ * budget proportional to its allocation share, and spends that before competing
+ * for the shared credit.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -51,6 +55,7 @@ private:
   // Set once per phase
   volatile intptr_t _epoch;
   volatile double _tax_rate;
+  volatile intptr_t _initial_budget;
 
   // Heavily updated, protect from accidental false sharing
   shenandoah_padding(0);
@@ -70,6 +75,7 @@ public:
           _wait_monitor(new Monitor(Mutex::safepoint-1, "ShenandoahWaitMonitor_lock", true)),
           _epoch(0),
           _tax_rate(1),
+          _initial_budget(0),
           _budget(0),
           _progress(PACING_PROGRESS_UNINIT) {}
 
@@ -87,8 +93,9 @@ public:
   inline void report_alloc(size_t words);
 
   bool claim_for_alloc(size_t words, bool force);
-  void pace_for_alloc(size_t words);
-  void unpace_for_alloc(intptr_t epoch, size_t words);
+  // Returns true if the allocation was paid from the thread-local budget.
+  bool pace_for_alloc(size_t words);
+  void unpace_for_alloc(intptr_t epoch, size_t words, bool paid_locally);
 
   void notify_waiters();
 
@@ -104,6 +111,9 @@ private:
   inline void add_budget(size_t words);
   void restart_with(size_t non_taxable_bytes, double tax_rate);
 
+  intptr_t claim_up_to(intptr_t words);
+  bool claim_thread_local(JavaThread* thread, size_t words);
+
   size_t update_and_get_progress_history();
 
   void wait(size_t time_ms);
@@ -46,6 +46,8 @@ private:
   size_t _gclab_size;
   int  _disarmed_value;
   double _paced_time;
+  intptr_t _pacing_epoch;
+  intptr_t _pacing_budget;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -55,7 +57,9 @@ private:
     _gclab(NULL),
     _gclab_size(0),
     _disarmed_value(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _pacing_epoch(0),
+    _pacing_budget(0) {
 
     // At least on x86_64, nmethod entry barrier encodes _disarmed_value offset
     // in instruction as disp8 immed
@@ -129,6 +133,19 @@ public:
     data(thread)->_paced_time = 0;
   }
 
+  static intptr_t pacing_epoch(Thread* thread) {
+    return data(thread)->_pacing_epoch;
+  }
+
+  static intptr_t pacing_budget(Thread* thread) {
+    return data(thread)->_pacing_budget;
+  }
+
+  static void set_pacing_budget(Thread* thread, intptr_t epoch, intptr_t budget) {
+    data(thread)->_pacing_epoch = epoch;
+    data(thread)->_pacing_budget = budget;
+  }
+
   static void set_disarmed_value(Thread* thread, int value) {
     data(thread)->_disarmed_value = value;
   }
@@ -155,6 +155,12 @@
           "Larger values give more weight to recent values.")               \
           range(0,1.0)                                                      \
                                                                             \
+  product(bool, ShenandoahAdaptiveCycleTimeModel, false, EXPERIMENTAL,      \
+          "Predict the cycle time from the live set and the heap "          \
+          "occupancy with a model learned from past cycles, instead of "    \
+          "using the average cycle time. The adaptive heuristics then "     \
+          "trigger on the predicted time to deplete the free headroom.")    \
+                                                                            \
   product(uintx, ShenandoahGuaranteedGCInterval, 5*60*1000, EXPERIMENTAL,   \
           "Many heuristics would guarantee a concurrent GC cycle at "       \
           "least with this interval. This is useful when large idle "       \
@@ -277,6 +283,13 @@
           "the beginning of it.")                                           \
           range(1.0, 100.0)                                                 \
                                                                             \
+  product(bool, ShenandoahPacingThreadLocal, true, EXPERIMENTAL,            \
+          "Give each thread a pacing budget proportional to its share of "  \
+          "recent allocations, as tracked by its TLAB, at the start of "    \
+          "each pacing phase. Threads spend their own budget before "       \
+          "claiming from the shared budget, so that allocation-heavy "      \
+          "threads take most of the pacing delays.")                        \
+                                                                            \
   product(uintx, ShenandoahCriticalFreeThreshold, 1, EXPERIMENTAL,          \
           "How much of the heap needs to be free after recovery cycles, "   \
           "either Degenerated or Full GC to be claimed successful. If this "\
@@ -293,6 +293,53 @@ static ZDriverRequest rule_allocation_rate() {
   }
 }
 
+static ZDriverRequest rule_allocation_stall_risk() {
+  if (ZAllocationStallRiskCycles == 0.0 || !ZStatCycle::is_time_trustable()) {
+    // Rule disabled
+    return GCCause::_no_gc;
+  }
+
+  // Perform GC if the projected time until we run out of memory is less
+  // than the configured number of GC cycle durations. This gives an early
+  // warning of allocation stalls to come, and starts a GC well before the
+  // allocation rate rule would, which only aims at finishing the GC just
+  // in time.
+
+  // Calculate amount of free memory available. Note that we take the
+  // relocation headroom into account to avoid in-place relocation.
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t used = ZHeap::heap()->used();
+  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
+  const size_t free = free_including_headroom - MIN2(free_including_headroom, ZHeuristics::relocation_headroom());
+
+  // Calculate time until OOM given the max allocation rate, in the same
+  // way as the static allocation rate rule.
+  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::sd() * one_in_1000);
+  const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
+
+  // Calculate the duration of a GC cycle with the number of GC workers
+  // used last time.
+  const double serial_gc_time = ZStatCycle::serial_time().davg() + (ZStatCycle::serial_time().dsd() * one_in_1000);
+  const double parallelizable_gc_time = ZStatCycle::parallelizable_time().davg() + (ZStatCycle::parallelizable_time().dsd() * one_in_1000);
+  const uint gc_workers = UseDynamicNumberOfGCThreads ? MAX2(ZStatCycle::last_active_workers(), 1u) : ConcGCThreads;
+  const double gc_duration = serial_gc_time + (parallelizable_gc_time / gc_workers);
+  const double time_until_gc = time_until_oom - (gc_duration * ZAllocationStallRiskCycles) - sample_interval;
+
+  log_debug(gc, director)("Rule: Allocation Stall Risk, MaxAllocRate: %.1fMB/s, Free: " SIZE_FORMAT "MB, "
+                          "GCDuration: %.3fs, TimeUntilOOM: %.3fs (%.1f cycles), TimeUntilGC: %.3fs",
+                          max_alloc_rate / M, free / M, gc_duration, time_until_oom,
+                          time_until_oom / MAX2(gc_duration, 0.001), time_until_gc);
+
+  if (time_until_gc > 0) {
+    return GCCause::_no_gc;
+  }
+
+  log_info(gc, director)("Allocation stall risk, time until out of memory %.3fs is less than %.1f GC cycles of %.3fs",
+                         time_until_oom, ZAllocationStallRiskCycles, gc_duration);
+
+  return GCCause::_z_allocation_stall_risk;
+}
+
 static ZDriverRequest rule_high_usage() {
   // Perform GC if the amount of free memory is 5% or less. This is a preventive
   // meassure in the case where the application has a very low allocation rate,
@@ -373,6 +420,7 @@ static ZDriverRequest make_gc_decision() {
     rule_warmup,
     rule_timer,
     rule_allocation_rate,
+    rule_allocation_stall_risk,
     rule_high_usage,
     rule_proactive,
   };
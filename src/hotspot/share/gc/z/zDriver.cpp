@@ -238,6 +238,7 @@ void ZDriver::collect(const ZDriverRequest& request) {
   case GCCause::_z_warmup:
   case GCCause::_z_allocation_rate:
   case GCCause::_z_allocation_stall:
+  case GCCause::_z_allocation_stall_risk:
   case GCCause::_z_proactive:
   case GCCause::_z_high_usage:
   case GCCause::_metadata_GC_threshold:
@@ -135,6 +135,9 @@ const size_t      ZMarkStackSlots               = (ZMarkStackSize - ZMarkStackHe
 const size_t      ZMarkStackMagazineSize        = (size_t)1 << 15; // 32K
 const size_t      ZMarkStackMagazineSlots       = (ZMarkStackMagazineSize / ZMarkStackSize) - 1;
 
+// Mark stack spill segment size
+const size_t      ZMarkStackSpillSegmentSize    = (size_t)1 << 20; // 1M
+
 // Mark stripe size
 const size_t      ZMarkStripeShift              = ZGranuleSizeShift;
 
@@ -31,6 +31,7 @@ template <typename T>
 class ZGranuleMap {
   friend class VMStructs;
   template <typename> friend class ZGranuleMapIterator;
+  template <typename> friend class ZGranuleMapParallelIterator;
 
 private:
   const size_t _size;
@@ -56,4 +57,21 @@ public:
   ZGranuleMapIterator(const ZGranuleMap<T>* granule_map);
 };
 
+template <typename T>
+class ZGranuleMapParallelIterator : public StackObj {
+private:
+  static const size_t ChunkSize = 1024;
+
+  const ZGranuleMap<T>* const _granule_map;
+  volatile size_t             _next;
+
+public:
+  ZGranuleMapParallelIterator(const ZGranuleMap<T>* granule_map);
+
+  // Calls function->do_entry(offset, value) for all entries. Entries
+  // are claimed in chunks, allowing multiple threads to share the work.
+  template <typename Function>
+  void do_entries(Function* function);
+};
+
 #endif // SHARE_GC_Z_ZGRANULEMAP_HPP
@@ -32,6 +32,7 @@
 #include "runtime/atomic.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
 
 template <typename T>
 inline ZGranuleMap<T>::ZGranuleMap(size_t max_offset) :
@@ -91,4 +92,29 @@ template <typename T>
 inline ZGranuleMapIterator<T>::ZGranuleMapIterator(const ZGranuleMap<T>* granule_map) :
     ZArrayIteratorImpl<T, false /* Parallel */>(granule_map->_map, granule_map->_size) {}
 
+template <typename T>
+inline ZGranuleMapParallelIterator<T>::ZGranuleMapParallelIterator(const ZGranuleMap<T>* granule_map) :
+    _granule_map(granule_map),
+    _next(0) {}
+
+template <typename T>
+template <typename Function>
+inline void ZGranuleMapParallelIterator<T>::do_entries(Function* function) {
+  const size_t size = _granule_map->_size;
+
+  for (;;) {
+    // Claim next chunk
+    const size_t start = Atomic::fetch_and_add(&_next, ChunkSize);
+    if (start >= size) {
+      // No more chunks
+      return;
+    }
+
+    const size_t end = MIN2(start + ChunkSize, size);
+    for (size_t index = start; index < end; index++) {
+      function->do_entry(index << ZGranuleSizeShift, _granule_map->_map[index]);
+    }
+  }
+}
+
 #endif // SHARE_GC_Z_ZGRANULEMAP_INLINE_HPP
@@ -31,6 +31,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeapIterator.hpp"
 #include "gc/z/zHeuristics.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMark.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -38,6 +39,7 @@
 #include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "gc/z/zResurrection.hpp"
 #include "gc/z/zStat.hpp"
+#include "gc/z/zTask.hpp"
 #include "gc/z/zThread.inline.hpp"
 #include "gc/z/zVerify.hpp"
 #include "gc/z/zWorkers.hpp"
@@ -337,43 +339,86 @@ void ZHeap::process_non_strong_references() {
   _reference_processor.enqueue_references();
 }
 
-void ZHeap::free_empty_pages(ZRelocationSetSelector* selector, int bulk) {
-  // Freeing empty pages in bulk is an optimization to avoid grabbing
-  // the page allocator lock, and trying to satisfy stalled allocations
-  // too frequently.
-  if (selector->should_free_empty_pages(bulk)) {
-    free_pages(selector->empty_pages(), true /* reclaimed */);
-    selector->clear_empty_pages();
+class ZSelectRelocationSetClosure : public StackObj {
+private:
+  ZHeap* const           _heap;
+  ZRelocationSetSelector _selector;
+
+  void free_empty_pages(int bulk) {
+    // Freeing empty pages in bulk is an optimization to avoid grabbing
+    // the page allocator lock, and trying to satisfy stalled allocations
+    // too frequently.
+    if (_selector.should_free_empty_pages(bulk)) {
+      _heap->free_pages(_selector.empty_pages(), true /* reclaimed */);
+      _selector.clear_empty_pages();
+    }
   }
-}
 
-void ZHeap::select_relocation_set() {
-  // Do not allow pages to be deleted
-  _page_allocator.enable_deferred_delete();
+public:
+  ZSelectRelocationSetClosure(ZHeap* heap) :
+      _heap(heap),
+      _selector() {}
 
-  // Register relocatable pages with selector
-  ZRelocationSetSelector selector;
-  ZPageTableIterator pt_iter(&_page_table);
-  for (ZPage* page; pt_iter.next(&page);) {
+  void do_page(ZPage* page) {
     if (!page->is_relocatable()) {
       // Not relocatable, don't register
-      continue;
+      return;
     }
 
     if (page->is_marked()) {
       // Register live page
-      selector.register_live_page(page);
+      _selector.register_live_page(page);
     } else {
       // Register empty page
-      selector.register_empty_page(page);
+      _selector.register_empty_page(page);
 
       // Reclaim empty pages in bulk
-      free_empty_pages(&selector, 64 /* bulk */);
+      free_empty_pages(64 /* bulk */);
     }
   }
 
-  // Reclaim remaining empty pages
-  free_empty_pages(&selector, 0 /* bulk */);
+  const ZRelocationSetSelector* finish() {
+    // Reclaim remaining empty pages
+    free_empty_pages(0 /* bulk */);
+    return &_selector;
+  }
+};
+
+class ZSelectRelocationSetTask : public ZTask {
+private:
+  ZHeap* const                  _heap;
+  ZRelocationSetSelector* const _selector;
+  ZPageTableParallelIterator    _iter;
+  ZLock                         _lock;
+
+public:
+  ZSelectRelocationSetTask(ZHeap* heap, const ZPageTable* page_table, ZRelocationSetSelector* selector) :
+      ZTask("ZSelectRelocationSetTask"),
+      _heap(heap),
+      _selector(selector),
+      _iter(page_table),
+      _lock() {}
+
+  virtual void work() {
+    // Register pages with a worker local selector
+    ZSelectRelocationSetClosure cl(_heap);
+    _iter.do_pages(&cl);
+    const ZRelocationSetSelector* const selector = cl.finish();
+
+    // Merge into the shared selector
+    ZLocker<ZLock> locker(&_lock);
+    _selector->merge(selector);
+  }
+};
+
+void ZHeap::select_relocation_set() {
+  // Do not allow pages to be deleted
+  _page_allocator.enable_deferred_delete();
+
+  // Register relocatable pages with selector
+  ZRelocationSetSelector selector;
+  ZSelectRelocationSetTask task(this, &_page_table, &selector);
+  _workers.run(&task);
 
   // Allow pages to be deleted
   _page_allocator.disable_deferred_delete();
@@ -41,7 +41,6 @@
 
 class ThreadClosure;
 class ZPage;
-class ZRelocationSetSelector;
 
 class ZHeap {
   friend class VMStructs;
@@ -65,8 +64,6 @@ private:
   void flip_to_marked();
   void flip_to_remapped();
 
-  void free_empty_pages(ZRelocationSetSelector* selector, int bulk);
-
   void out_of_memory();
 
 public:
@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/z/zMarkStack.inline.hpp"
 #include "gc/z/zMarkStackAllocator.hpp"
 #include "logging/log.hpp"
@@ -30,7 +31,38 @@
 
 ZMarkStripe::ZMarkStripe() :
     _published(),
-    _overflowed() {}
+    _overflowed(),
+    _spilled() {}
+
+void ZMarkStripe::spill_stack(ZMarkStack* stack) {
+  // Entries are spilled in push order, which keeps the
+  // deltas between consecutive entries small.
+  ZMarkStackEntry entries[ZMarkStackSlots];
+  size_t nentries = ZMarkStackSlots;
+  while (nentries > 0 && stack->pop(entries[nentries - 1])) {
+    nentries--;
+  }
+
+  _spilled.spill(entries + nentries, ZMarkStackSlots - nentries);
+}
+
+bool ZMarkStripe::unspill_stack(ZMarkStack* stack) {
+  assert(stack->is_empty(), "Should be empty");
+
+  if (!has_spilled_stacks()) {
+    // Nothing spilled
+    return false;
+  }
+
+  ZMarkStackEntry entries[ZMarkStackSlots];
+  const size_t nentries = _spilled.unspill(entries, ZMarkStackSlots);
+  for (size_t i = 0; i < nentries; i++) {
+    const bool success = stack->push(entries[i]);
+    assert(success, "Stack should never get full");
+  }
+
+  return nentries > 0;
+}
 
 ZMarkStripeSet::ZMarkStripeSet() :
     _nstripes(0),
@@ -149,8 +181,18 @@ bool ZMarkThreadLocalStacks::push_slow(ZMarkStackAllocator* allocator,
       // Allocate and install new stack
       *stackp = stack = allocate_stack(allocator);
       if (stack == NULL) {
-        // Out of mark stack memory
-        return false;
+        // Out of mark stack memory, reuse a published stack
+        // by spilling its entries.
+        *stackp = stack = stripe->steal_stack();
+        if (stack == NULL) {
+          // Nothing to reuse. This is a fatal error since we can't
+          // recover from running out of mark stacks altogether.
+          fatal("Mark stack space exhausted. Use -XX:ZMarkStackSpaceLimit=<size> to increase the "
+                "maximum number of bytes allocated for mark stacks. Current limit is " SIZE_FORMAT "M.",
+                ZMarkStackSpaceLimit / M);
+        }
+
+        stripe->spill_stack(stack);
       }
     }
 
@@ -159,9 +201,16 @@ bool ZMarkThreadLocalStacks::push_slow(ZMarkStackAllocator* allocator,
       return true;
     }
 
-    // Publish/Overflow and uninstall stack
+    ZMarkStack* const new_stack = allocate_stack(allocator);
+    if (new_stack == NULL) {
+      // Out of mark stack memory, spill and keep the stack
+      stripe->spill_stack(stack);
+      continue;
+    }
+
+    // Publish/Overflow and install new stack
     stripe->publish_stack(stack, publish);
-    *stackp = stack = NULL;
+    *stackp = stack = new_stack;
   }
 }
 
@@ -176,8 +225,25 @@ bool ZMarkThreadLocalStacks::pop_slow(ZMarkStackAllocator* allocator,
       // Try steal and install stack
       *stackp = stack = stripe->steal_stack();
       if (stack == NULL) {
-        // Nothing to steal
-        return false;
+        if (!stripe->has_spilled_stacks()) {
+          // Nothing to steal
+          return false;
+        }
+
+        // Nothing to steal, unspill into a new stack
+        stack = allocate_stack(allocator);
+        if (stack == NULL) {
+          // Out of mark stack memory
+          return false;
+        }
+
+        if (!stripe->unspill_stack(stack)) {
+          // Nothing to unspill
+          free_stack(allocator, stack);
+          return false;
+        }
+
+        *stackp = stack;
       }
     }
 
@@ -186,6 +252,11 @@ bool ZMarkThreadLocalStacks::pop_slow(ZMarkStackAllocator* allocator,
       return true;
     }
 
+    if (stripe->unspill_stack(stack)) {
+      // Reuse stack for spilled entries
+      continue;
+    }
+
     // Free and uninstall stack
     free_stack(allocator, stack);
     *stackp = stack = NULL;
@@ -26,6 +26,7 @@
 
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zMarkStackEntry.hpp"
+#include "gc/z/zMarkStackSpill.hpp"
 #include "utilities/globalDefinitions.hpp"
 
 template <typename T, size_t S>
@@ -80,6 +81,7 @@ class ZMarkStripe {
 private:
   ZCACHE_ALIGNED ZMarkStackList _published;
   ZCACHE_ALIGNED ZMarkStackList _overflowed;
+  ZCACHE_ALIGNED ZMarkStackSpill _spilled;
 
 public:
   ZMarkStripe();
@@ -88,6 +90,10 @@ public:
 
   void publish_stack(ZMarkStack* stack, bool publish = true);
   ZMarkStack* steal_stack();
+
+  bool has_spilled_stacks() const;
+  void spill_stack(ZMarkStack* stack);
+  bool unspill_stack(ZMarkStack* stack);
 };
 
 class ZMarkStripeSet {
@@ -163,7 +163,7 @@ inline void ZStackList<T>::clear() {
 }
 
 inline bool ZMarkStripe::is_empty() const {
-  return _published.is_empty() && _overflowed.is_empty();
+  return _published.is_empty() && _overflowed.is_empty() && _spilled.is_empty();
 }
 
 inline void ZMarkStripe::publish_stack(ZMarkStack* stack, bool publish) {
@@ -180,6 +180,10 @@ inline void ZMarkStripe::publish_stack(ZMarkStack* stack, bool publish) {
   }
 }
 
+inline bool ZMarkStripe::has_spilled_stacks() const {
+  return !_spilled.is_empty();
+}
+
 inline ZMarkStack* ZMarkStripe::steal_stack() {
   // Steal overflowed stacks first, then published stacks
   ZMarkStack* const stack = _overflowed.pop();
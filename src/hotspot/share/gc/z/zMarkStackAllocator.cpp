@@ -77,11 +77,11 @@ size_t ZMarkStackSpace::expand_space() {
   const size_t new_size = old_size + expand_size;
 
   if (new_size > ZMarkStackSpaceLimit) {
-    // Expansion limit reached. This is a fatal error since we
-    // currently can't recover from running out of mark stack space.
-    fatal("Mark stack space exhausted. Use -XX:ZMarkStackSpaceLimit=<size> to increase the "
-          "maximum number of bytes allocated for mark stacks. Current limit is " SIZE_FORMAT "M.",
-          ZMarkStackSpaceLimit / M);
+    // Expansion limit reached. Full mark stacks will be spilled
+    // until stacks are freed again.
+    log_debug(gc, marking)("Mark stack space exhausted: " SIZE_FORMAT "M, spilling mark stacks",
+                           old_size / M);
+    return 0;
   }
 
   log_debug(gc, marking)("Expanding mark stack space: " SIZE_FORMAT "M->" SIZE_FORMAT "M",
@@ -144,6 +144,10 @@ uintptr_t ZMarkStackSpace::expand_and_alloc_space(size_t size) {
 
   // Expand
   const size_t expand_size = expand_space();
+  if (expand_size == 0) {
+    // Expansion limit reached
+    return 0;
+  }
 
   // Increment top before end to make sure another
   // thread can't steal out newly expanded space.
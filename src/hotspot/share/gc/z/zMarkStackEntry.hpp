@@ -72,6 +72,8 @@
 //
 
 class ZMarkStackEntry  {
+  friend class ZMarkStackSpill;
+
 private:
   typedef ZBitField<uint64_t, bool,      0,  1>  field_finalizable;
   typedef ZBitField<uint64_t, bool,      1,  1>  field_partial_array;
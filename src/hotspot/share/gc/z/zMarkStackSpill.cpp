@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zMarkStackSpill.hpp"
+#include "logging/log.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/debug.hpp"
+
+// Each spilled chunk of entries is followed by a trailer, which
+// allows chunks to be unspilled in the reverse order of spilling.
+struct ZMarkStackSpillTrailer {
+  uint32_t _nbytes;
+  uint32_t _nentries;
+};
+
+// A variable length encoded 64-bit value needs at most 10 bytes
+const size_t ZMarkStackSpillMaxEncodedSize = 10;
+
+class ZMarkStackSpillSegment {
+private:
+  ZMarkStackSpillSegment* _next;
+  size_t                  _top;
+
+public:
+  ZMarkStackSpillSegment(ZMarkStackSpillSegment* next) :
+      _next(next),
+      _top(0) {}
+
+  ZMarkStackSpillSegment* next() const {
+    return _next;
+  }
+
+  bool is_empty() const {
+    return _top == 0;
+  }
+
+  size_t available() const {
+    return ZMarkStackSpillSegmentSize - sizeof(ZMarkStackSpillSegment) - _top;
+  }
+
+  uint8_t* top() {
+    return (uint8_t*)(this + 1) + _top;
+  }
+
+  void set_top(uint8_t* top) {
+    const size_t new_top = top - (uint8_t*)(this + 1);
+    assert(new_top <= ZMarkStackSpillSegmentSize - sizeof(ZMarkStackSpillSegment), "Invalid top");
+    _top = new_top;
+  }
+};
+
+static uint8_t* encode_delta(uint8_t* dst, uint64_t prev, uint64_t value) {
+  // Zig-zag encode the signed delta, so that small negative
+  // deltas also become small unsigned values.
+  const int64_t delta = (int64_t)(value - prev);
+  uint64_t encoded = ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+
+  while (encoded >= 0x80) {
+    *dst++ = (uint8_t)(encoded | 0x80);
+    encoded >>= 7;
+  }
+  *dst++ = (uint8_t)encoded;
+
+  return dst;
+}
+
+static const uint8_t* decode_delta(const uint8_t* src, uint64_t prev, uint64_t* value) {
+  uint64_t encoded = 0;
+
+  for (size_t shift = 0;; shift += 7) {
+    const uint8_t byte = *src++;
+    encoded |= (uint64_t)(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      break;
+    }
+  }
+
+  const int64_t delta = (int64_t)(encoded >> 1) ^ -(int64_t)(encoded & 1);
+  *value = prev + (uint64_t)delta;
+
+  return src;
+}
+
+ZMarkStackSpill::ZMarkStackSpill() :
+    _lock(),
+    _segments(NULL),
+    _nchunks(0) {}
+
+bool ZMarkStackSpill::is_empty() const {
+  return Atomic::load(&_nchunks) == 0;
+}
+
+ZMarkStackSpillSegment* ZMarkStackSpill::alloc_segment() {
+  char* const addr = os::reserve_memory(ZMarkStackSpillSegmentSize, !ExecMem, mtGC);
+  if (addr == NULL) {
+    fatal("Failed to reserve address space for mark stack spill segment");
+  }
+
+  os::commit_memory_or_exit(addr, ZMarkStackSpillSegmentSize, false /* executable */, "Mark stack spill segment");
+
+  log_debug(gc, marking)("Mapped mark stack spill segment: " PTR_FORMAT, p2i(addr));
+
+  return new ((void*)addr) ZMarkStackSpillSegment(_segments);
+}
+
+void ZMarkStackSpill::free_segment(ZMarkStackSpillSegment* segment) {
+  log_debug(gc, marking)("Unmapped mark stack spill segment: " PTR_FORMAT, p2i(segment));
+
+  segment->~ZMarkStackSpillSegment();
+  os::release_memory((char*)segment, ZMarkStackSpillSegmentSize);
+}
+
+void ZMarkStackSpill::spill(const ZMarkStackEntry* entries, size_t nentries) {
+  assert(nentries > 0, "Nothing to spill");
+
+  const size_t max_size = nentries * ZMarkStackSpillMaxEncodedSize + sizeof(ZMarkStackSpillTrailer);
+
+  ZLocker<ZLock> locker(&_lock);
+
+  if (_segments == NULL || _segments->available() < max_size) {
+    // Map new segment
+    _segments = alloc_segment();
+  }
+
+  // Encode entries
+  uint8_t* const start = _segments->top();
+  uint8_t* dst = start;
+  uint64_t prev = 0;
+  for (size_t i = 0; i < nentries; i++) {
+    dst = encode_delta(dst, prev, entries[i]._entry);
+    prev = entries[i]._entry;
+  }
+
+  // Encode trailer
+  ZMarkStackSpillTrailer trailer;
+  trailer._nbytes = (uint32_t)(dst - start);
+  trailer._nentries = (uint32_t)nentries;
+  memcpy(dst, &trailer, sizeof(trailer));
+  dst += sizeof(trailer);
+
+  _segments->set_top(dst);
+  Atomic::store(&_nchunks, _nchunks + 1);
+
+  log_trace(gc, marking)("Spilled mark stack: " SIZE_FORMAT " entries, " SIZE_FORMAT "B",
+                         nentries, (size_t)(dst - start));
+}
+
+size_t ZMarkStackSpill::unspill(ZMarkStackEntry* entries, size_t max_nentries) {
+  ZLocker<ZLock> locker(&_lock);
+
+  if (_segments == NULL) {
+    // Nothing spilled
+    return 0;
+  }
+
+  // Decode trailer
+  uint8_t* const end = _segments->top() - sizeof(ZMarkStackSpillTrailer);
+  ZMarkStackSpillTrailer trailer;
+  memcpy(&trailer, end, sizeof(trailer));
+  assert(trailer._nentries <= max_nentries, "Too many entries");
+
+  // Decode entries
+  uint8_t* const start = end - trailer._nbytes;
+  const uint8_t* src = start;
+  uint64_t prev = 0;
+  for (size_t i = 0; i < trailer._nentries; i++) {
+    src = decode_delta(src, prev, &entries[i]._entry);
+    prev = entries[i]._entry;
+  }
+  assert(src == end, "Invalid chunk");
+
+  _segments->set_top(start);
+  Atomic::store(&_nchunks, _nchunks - 1);
+
+  if (_segments->is_empty()) {
+    // Unmap drained segment
+    ZMarkStackSpillSegment* const segment = _segments;
+    _segments = segment->next();
+    free_segment(segment);
+  }
+
+  return trailer._nentries;
+}
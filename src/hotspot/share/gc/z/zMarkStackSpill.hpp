@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_Z_ZMARKSTACKSPILL_HPP
+#define SHARE_GC_Z_ZMARKSTACKSPILL_HPP
+
+#include "gc/z/zLock.hpp"
+#include "gc/z/zMarkStackEntry.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ZMarkStackSpillSegment;
+
+//
+// When the mark stack space has been exhausted, the entries of full mark
+// stacks are spilled into segments that are mapped on demand, and are
+// unmapped again as soon as they have been drained. Entries are stored
+// as delta encoded variable length integers. Objects pushed together are
+// typically located close to each other, so most entries only need one or
+// two bytes instead of eight.
+//
+class ZMarkStackSpill {
+private:
+  ZLock                   _lock;
+  ZMarkStackSpillSegment* _segments;
+  volatile size_t         _nchunks;
+
+  ZMarkStackSpillSegment* alloc_segment();
+  void free_segment(ZMarkStackSpillSegment* segment);
+
+public:
+  ZMarkStackSpill();
+
+  bool is_empty() const;
+
+  void spill(const ZMarkStackEntry* entries, size_t nentries);
+  size_t unspill(ZMarkStackEntry* entries, size_t max_nentries);
+};
+
+#endif // SHARE_GC_Z_ZMARKSTACKSPILL_HPP
@@ -35,6 +35,7 @@
 #include "gc/z/zSafeDelete.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
+#include "gc/z/zThreadLocalData.hpp"
 #include "gc/z/zUncommitter.hpp"
 #include "gc/z/zUnmapper.hpp"
 #include "gc/z/zWorkers.hpp"
@@ -446,6 +447,7 @@ static void check_out_of_memory_during_initialization() {
 bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
   ZStatTimer timer(ZCriticalPhaseAllocationStall);
   EventZAllocationStall event;
+  const Ticks start = Ticks::now();
   ZPageAllocationStall result;
 
   // We can only block if the VM is fully initialized
@@ -480,8 +482,15 @@ bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
     _satisfied.remove(allocation);
   }
 
+  // Update per-thread stall statistics
+  Thread* const thread = Thread::current();
+  ZThreadLocalData::record_alloc_stall(thread, (uint64_t)(Ticks::now() - start).nanoseconds());
+
   // Send event
-  event.commit(allocation->type(), allocation->size());
+  event.commit(allocation->type(),
+               allocation->size(),
+               ZThreadLocalData::alloc_stall_count(thread),
+               ZThreadLocalData::alloc_stall_time_ns(thread));
 
   return (result == ZPageAllocationStallSuccess);
 }
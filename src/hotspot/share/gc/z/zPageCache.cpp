@@ -58,14 +58,15 @@ ZPageCache::ZPageCache() :
     _small(),
     _medium(),
     _large(),
-    _last_commit(0) {}
+    _last_commit(0),
+    _recent_demand() {}
 
-ZPage* ZPageCache::alloc_small_page() {
+ZPage* ZPageCache::alloc_numa_page(ZPerNUMA<ZList<ZPage> >* lists) {
   const uint32_t numa_id = ZNUMA::id();
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
-  ZPage* const l1_page = _small.get(numa_id).remove_first();
+  ZPage* const l1_page = lists->get(numa_id).remove_first();
   if (l1_page != NULL) {
     ZStatInc(ZCounterPageCacheHitL1);
     return l1_page;
@@ -79,7 +80,7 @@ ZPage* ZPageCache::alloc_small_page() {
       remote_numa_id = 0;
     }
 
-    ZPage* const l2_page = _small.get(remote_numa_id).remove_first();
+    ZPage* const l2_page = lists->get(remote_numa_id).remove_first();
     if (l2_page != NULL) {
       ZStatInc(ZCounterPageCacheHitL2);
       return l2_page;
@@ -91,14 +92,12 @@ ZPage* ZPageCache::alloc_small_page() {
   return NULL;
 }
 
-ZPage* ZPageCache::alloc_medium_page() {
-  ZPage* const page = _medium.remove_first();
-  if (page != NULL) {
-    ZStatInc(ZCounterPageCacheHitL1);
-    return page;
-  }
+ZPage* ZPageCache::alloc_small_page() {
+  return alloc_numa_page(&_small);
+}
 
-  return NULL;
+ZPage* ZPageCache::alloc_medium_page() {
+  return alloc_numa_page(&_medium);
 }
 
 ZPage* ZPageCache::alloc_large_page(size_t size) {
@@ -117,8 +116,18 @@ ZPage* ZPageCache::alloc_large_page(size_t size) {
 }
 
 ZPage* ZPageCache::alloc_oversized_medium_page(size_t size) {
-  if (size <= ZPageSizeMedium) {
-    return _medium.remove_first();
+  if (size > ZPageSizeMedium) {
+    return NULL;
+  }
+
+  // Prefer a NUMA local page
+  const uint32_t numa_id = ZNUMA::id();
+  const uint32_t numa_count = ZNUMA::count();
+  for (uint32_t i = 0; i < numa_count; i++) {
+    ZPage* const page = _medium.get((numa_id + i) % numa_count).remove_first();
+    if (page != NULL) {
+      return page;
+    }
   }
 
   return NULL;
@@ -154,6 +163,9 @@ ZPage* ZPageCache::alloc_oversized_page(size_t size) {
 ZPage* ZPageCache::alloc_page(uint8_t type, size_t size) {
   ZPage* page;
 
+  // Record demand, used to decide which pages to keep cached
+  _recent_demand[type] += size;
+
   // Try allocate exact page
   if (type == ZPageTypeSmall) {
     page = alloc_small_page();
@@ -192,7 +204,7 @@ void ZPageCache::free_page(ZPage* page) {
   if (type == ZPageTypeSmall) {
     _small.get(page->numa_id()).insert_first(page);
   } else if (type == ZPageTypeMedium) {
-    _medium.insert_first(page);
+    _medium.get(page->numa_id()).insert_first(page);
   } else {
     _large.insert_first(page);
   }
@@ -237,11 +249,29 @@ void ZPageCache::flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList
   }
 }
 
+void ZPageCache::flush_type(ZPageCacheFlushClosure* cl, uint8_t type, ZList<ZPage>* to) {
+  if (type == ZPageTypeSmall) {
+    flush_per_numa_lists(cl, &_small, to);
+  } else if (type == ZPageTypeMedium) {
+    flush_per_numa_lists(cl, &_medium, to);
+  } else {
+    flush_list(cl, &_large, to);
+  }
+}
+
 void ZPageCache::flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to) {
-  // Prefer flushing large, then medium and last small pages
-  flush_list(cl, &_large, to);
-  flush_list(cl, &_medium, to);
-  flush_per_numa_lists(cl, &_small, to);
+  // Flush the page types with the least recent demand first. With equal
+  // demand, prefer flushing large, then medium and last small pages.
+  uint8_t types[NumPageTypes] = { ZPageTypeLarge, ZPageTypeMedium, ZPageTypeSmall };
+  for (uint i = 1; i < NumPageTypes; i++) {
+    for (uint j = i; j > 0 && _recent_demand[types[j]] < _recent_demand[types[j - 1]]; j--) {
+      swap(types[j], types[j - 1]);
+    }
+  }
+
+  for (uint i = 0; i < NumPageTypes; i++) {
+    flush_type(cl, types[i], to);
+  }
 
   if (cl->_flushed > cl->_requested) {
     // Overflushed, re-insert part of last page into the cache
@@ -278,12 +308,17 @@ class ZPageCacheFlushForUncommitClosure : public ZPageCacheFlushClosure {
 private:
   const uint64_t _now;
   uint64_t*      _timeout;
+  // Max number of bytes to flush per page type, retaining the rest
+  const size_t*  _flushable;
+  size_t         _flushed_per_type[ZPageTypeLarge + 1];
 
 public:
-  ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t now, uint64_t* timeout) :
+  ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t now, uint64_t* timeout, const size_t* flushable) :
       ZPageCacheFlushClosure(requested),
       _now(now),
-      _timeout(timeout) {
+      _timeout(timeout),
+      _flushable(flushable),
+      _flushed_per_type() {
     // Set initial timeout
     *_timeout = ZUncommitDelay;
   }
@@ -301,6 +336,13 @@ public:
       return false;
     }
 
+    const uint8_t type = page->type();
+    if (_flushed_per_type[type] + page->size() > _flushable[type]) {
+      // Don't flush page, retained for the recent demand of this type
+      return false;
+    }
+    _flushed_per_type[type] += page->size();
+
     // Flush page
     _flushed += page->size();
     return true;
@@ -322,12 +364,42 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
     return 0;
   }
 
-  ZPageCacheFlushForUncommitClosure cl(requested, now, timeout);
+  // Retain as many cached bytes of each page type as were recently
+  // requested, and decay the demand, so that pages of types that are no
+  // longer requested are eventually uncommitted.
+  size_t flushable[NumPageTypes];
+  for (uint8_t type = 0; type < NumPageTypes; type++) {
+    const size_t cached = cached_bytes(type);
+    flushable[type] = cached - MIN2(cached, _recent_demand[type]);
+    _recent_demand[type] /= 2;
+  }
+
+  ZPageCacheFlushForUncommitClosure cl(requested, now, timeout, flushable);
   flush(&cl, to);
 
   return cl._flushed;
 }
 
+size_t ZPageCache::cached_bytes(uint8_t type) const {
+  size_t cached = 0;
+  if (type == ZPageTypeLarge) {
+    ZListIterator<ZPage> iter(&_large);
+    for (ZPage* page; iter.next(&page);) {
+      cached += page->size();
+    }
+  } else {
+    const ZPerNUMA<ZList<ZPage> >* const lists = (type == ZPageTypeSmall) ? &_small : &_medium;
+    ZPerNUMAConstIterator<ZList<ZPage> > iter_numa(lists);
+    for (const ZList<ZPage>* list; iter_numa.next(&list);) {
+      ZListIterator<ZPage> iter(list);
+      for (ZPage* page; iter.next(&page);) {
+        cached += page->size();
+      }
+    }
+  }
+  return cached;
+}
+
 void ZPageCache::set_last_commit() {
   _last_commit = ceil(os::elapsedTime());
 }
@@ -343,9 +415,12 @@ void ZPageCache::pages_do(ZPageClosure* cl) const {
   }
 
   // Medium
-  ZListIterator<ZPage> iter_medium(&_medium);
-  for (ZPage* page; iter_medium.next(&page);) {
-    cl->do_page(page);
+  ZPerNUMAConstIterator<ZList<ZPage> > iter_numa_medium(&_medium);
+  for (const ZList<ZPage>* list; iter_numa_medium.next(&list);) {
+    ZListIterator<ZPage> iter_medium(list);
+    for (ZPage* page; iter_medium.next(&page);) {
+      cl->do_page(page);
+    }
   }
 
   // Large
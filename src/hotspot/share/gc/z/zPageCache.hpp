@@ -32,11 +32,16 @@ class ZPageCacheFlushClosure;
 
 class ZPageCache {
 private:
+  static const uint NumPageTypes = ZPageTypeLarge + 1;
+
   ZPerNUMA<ZList<ZPage> > _small;
-  ZList<ZPage>            _medium;
+  ZPerNUMA<ZList<ZPage> > _medium;
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
+  // Bytes recently requested per page type, decayed on every uncommit.
+  size_t                  _recent_demand[NumPageTypes];
 
+  ZPage* alloc_numa_page(ZPerNUMA<ZList<ZPage> >* lists);
   ZPage* alloc_small_page();
   ZPage* alloc_medium_page();
   ZPage* alloc_large_page(size_t size);
@@ -48,8 +53,11 @@ private:
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
+  void flush_type(ZPageCacheFlushClosure* cl, uint8_t type, ZList<ZPage>* to);
   void flush(ZPageCacheFlushClosure* cl, ZList<ZPage>* to);
 
+  size_t cached_bytes(uint8_t type) const;
+
 public:
   ZPageCache();
 
@@ -32,6 +32,7 @@ class ZPage;
 class ZPageTable {
   friend class VMStructs;
   friend class ZPageTableIterator;
+  friend class ZPageTableParallelIterator;
 
 private:
   ZGranuleMap<ZPage*> _map;
@@ -56,4 +57,16 @@ public:
   bool next(ZPage** page);
 };
 
+class ZPageTableParallelIterator : public StackObj {
+private:
+  ZGranuleMapParallelIterator<ZPage*> _iter;
+
+public:
+  ZPageTableParallelIterator(const ZPageTable* page_table);
+
+  // Calls function->do_page(page) once for each page
+  template <typename Function>
+  void do_pages(Function* function);
+};
+
 #endif // SHARE_GC_Z_ZPAGETABLE_HPP
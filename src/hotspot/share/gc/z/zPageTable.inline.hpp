@@ -28,6 +28,7 @@
 
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zGranuleMap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
 
 inline ZPage* ZPageTable::get(uintptr_t addr) const {
   assert(!ZAddress::is_null(addr), "Invalid address");
@@ -51,4 +52,32 @@ inline bool ZPageTableIterator::next(ZPage** page) {
   return false;
 }
 
+template <typename Function>
+class ZPageTableParallelIteratorEntryClosure {
+private:
+  Function* const _function;
+
+public:
+  ZPageTableParallelIteratorEntryClosure(Function* function) :
+      _function(function) {}
+
+  void do_entry(uintptr_t offset, ZPage* entry) {
+    // A multi-granule page is only visited from its first
+    // granule, since its other granules can be claimed by
+    // other threads.
+    if (entry != NULL && entry->start() == offset) {
+      _function->do_page(entry);
+    }
+  }
+};
+
+inline ZPageTableParallelIterator::ZPageTableParallelIterator(const ZPageTable* page_table) :
+    _iter(&page_table->_map) {}
+
+template <typename Function>
+inline void ZPageTableParallelIterator::do_pages(Function* function) {
+  ZPageTableParallelIteratorEntryClosure<Function> cl(function);
+  _iter.do_entries(&cl);
+}
+
 #endif // SHARE_GC_Z_ZPAGETABLE_INLINE_HPP
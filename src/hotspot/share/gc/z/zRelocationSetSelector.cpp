@@ -161,6 +161,19 @@ void ZRelocationSetSelectorGroup::select_inner() {
                        _name, selected_from, selected_to, npages - selected_from, selected_forwarding_entries);
 }
 
+void ZRelocationSetSelectorGroup::merge(const ZRelocationSetSelectorGroup* other) {
+  assert(_page_type == other->_page_type, "Invalid page type");
+  assert(_forwarding_entries == 0 && other->_forwarding_entries == 0, "Already selected");
+
+  // The page order is not preserved, live pages are sorted during selection
+  _live_pages.appendAll(&other->_live_pages);
+
+  _stats._npages += other->_stats._npages;
+  _stats._total += other->_stats._total;
+  _stats._live += other->_stats._live;
+  _stats._empty += other->_stats._empty;
+}
+
 void ZRelocationSetSelectorGroup::select() {
   if (is_disabled()) {
     return;
@@ -182,6 +195,14 @@ ZRelocationSetSelector::ZRelocationSetSelector() :
     _large("Large", ZPageTypeLarge, 0 /* page_size */, 0 /* object_size_limit */),
     _empty_pages() {}
 
+void ZRelocationSetSelector::merge(const ZRelocationSetSelector* other) {
+  assert(other->_empty_pages.is_empty(), "Empty pages should have been freed");
+
+  _small.merge(&other->_small);
+  _medium.merge(&other->_medium);
+  _large.merge(&other->_large);
+}
+
 void ZRelocationSetSelector::select() {
   // Select pages to relocate. The resulting relocation set will be
   // sorted such that medium pages comes first, followed by small
@@ -87,6 +87,7 @@ public:
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
+  void merge(const ZRelocationSetSelectorGroup* other);
   void select();
 
   const ZArray<ZPage*>* selected() const;
@@ -111,6 +112,7 @@ public:
 
   void register_live_page(ZPage* page);
   void register_empty_page(ZPage* page);
+  void merge(const ZRelocationSetSelector* other);
 
   bool should_free_empty_pages(int bulk) const;
   const ZArray<ZPage*>* empty_pages() const;
@@ -35,11 +35,15 @@ private:
   uintptr_t              _address_bad_mask;
   ZMarkThreadLocalStacks _stacks;
   oop*                   _invisible_root;
+  uint64_t               _alloc_stall_count;
+  uint64_t               _alloc_stall_time_ns;
 
   ZThreadLocalData() :
       _address_bad_mask(0),
       _stacks(),
-      _invisible_root(NULL) {}
+      _invisible_root(NULL),
+      _alloc_stall_count(0),
+      _alloc_stall_time_ns(0) {}
 
   static ZThreadLocalData* data(Thread* thread) {
     return thread->gc_data<ZThreadLocalData>();
@@ -72,6 +76,19 @@ public:
     data(thread)->_invisible_root = NULL;
   }
 
+  static void record_alloc_stall(Thread* thread, uint64_t duration_ns) {
+    data(thread)->_alloc_stall_count++;
+    data(thread)->_alloc_stall_time_ns += duration_ns;
+  }
+
+  static uint64_t alloc_stall_count(Thread* thread) {
+    return data(thread)->_alloc_stall_count;
+  }
+
+  static uint64_t alloc_stall_time_ns(Thread* thread) {
+    return data(thread)->_alloc_stall_time_ns;
+  }
+
   template <typename T>
   static void do_invisible_root(Thread* thread, T f) {
     if (data(thread)->_invisible_root != NULL) {
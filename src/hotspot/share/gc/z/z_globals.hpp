@@ -35,6 +35,12 @@
   product(double, ZAllocationSpikeTolerance, 2.0,                           \
           "Allocation spike tolerance factor")                              \
                                                                             \
+  product(double, ZAllocationStallRiskCycles, 0.0,                          \
+          "Start a GC cycle if the projected time until the heap is "       \
+          "exhausted is less than this many GC cycle durations. A value "   \
+          "of zero disables this rule")                                     \
+          range(0.0, 100.0)                                                 \
+                                                                            \
   product(double, ZFragmentationLimit, 25.0,                                \
           "Maximum allowed heap fragmentation")                             \
                                                                             \
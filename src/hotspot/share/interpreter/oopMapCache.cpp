@@ -33,6 +33,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/signature.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 class OopMapCacheEntry: private InterpreterOopMap {
   friend class InterpreterOopMap;
@@ -444,8 +445,13 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
+volatile size_t OopMapCache::_lookups = 0;
+volatile size_t OopMapCache::_misses = 0;
 
-OopMapCache::OopMapCache() {
+OopMapCache::OopMapCache(int method_count) {
+  // Leave room for a couple of bcis per method before entries start to
+  // evict each other.
+  _size   = MIN2((int)_max_size, MAX2((int)_min_size, round_up_power_of_2(MAX2(method_count, 1) * 2)));
   _array  = NEW_C_HEAP_ARRAY(OopMapCacheEntry*, _size, mtClass);
   for(int i = 0; i < _size; i++) _array[i] = NULL;
 }
@@ -508,7 +514,11 @@ void OopMapCache::lookup(const methodHandle& method,
   int i;
   OopMapCacheEntry* entry = NULL;
 
-  if (log_is_enabled(Debug, interpreter, oopmap)) {
+  // The hit rate is only reported with -Xlog:interpreter+oopmap=debug, so
+  // keep the GC workers from contending on the counters otherwise.
+  const bool log = log_is_enabled(Debug, interpreter, oopmap);
+  if (log) {
+    Atomic::inc(&_lookups);
     static int count = 0;
     ResourceMark rm;
     log_debug(interpreter, oopmap)
@@ -529,6 +539,9 @@ void OopMapCache::lookup(const methodHandle& method,
 
   // Entry is not in hashtable.
   // Compute entry
+  if (log) {
+    Atomic::inc(&_misses);
+  }
 
   OopMapCacheEntry* tmp = NEW_C_HEAP_OBJ(OopMapCacheEntry, mtClass);
   tmp->initialize();
@@ -589,6 +602,12 @@ void OopMapCache::enqueue_for_cleanup(OopMapCacheEntry* entry) {
 // This is called after GC threads are done and nothing is accessing the old_entries
 // list, so no synchronization needed.
 void OopMapCache::cleanup_old_entries() {
+  size_t lookups = Atomic::xchg(&_lookups, (size_t)0);
+  size_t misses = Atomic::xchg(&_misses, (size_t)0);
+  if (lookups > 0) {
+    log_debug(interpreter, oopmap)("oop map cache lookups " SIZE_FORMAT ", misses " SIZE_FORMAT " (%.1f%%)",
+                                   lookups, misses, 100.0 * misses / lookups);
+  }
   OopMapCacheEntry* entry = _old_entries;
   _old_entries = NULL;
   while (entry != NULL) {
@@ -148,11 +148,15 @@ class InterpreterOopMap: ResourceObj {
 
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
+ static volatile size_t _lookups;
+ static volatile size_t _misses;
  private:
-  enum { _size        = 32,     // Use fixed size for now
+  enum { _min_size    = 32,     // size for classes with few methods
+         _max_size    = 1024,
          _probe_depth = 3       // probe depth in case of collisions
   };
 
+  int _size;
   OopMapCacheEntry* volatile * _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
@@ -164,7 +168,8 @@ class OopMapCache : public CHeapObj<mtClass> {
   void flush();
 
  public:
-  OopMapCache();
+  // The cache is sized by the number of methods of the holder class.
+  OopMapCache(int method_count);
   ~OopMapCache();                                // free up memory
 
   // flush cache entry is occupied by an obsolete method
@@ -157,7 +157,7 @@ void BFSClosure::dfs_fallback() {
   assert(_edge_queue->is_full(), "invariant");
   _use_dfs = true;
   _dfs_fallback_idx = _edge_queue->bottom();
-  while (!_edge_queue->is_empty()) {
+  while (!_edge_queue->is_empty() && !GranularTimer::has_expired()) {
     const Edge* edge = _edge_queue->remove();
     if (edge->pointee() != NULL) {
       DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, edge);
@@ -171,7 +171,9 @@ void BFSClosure::process_queue() {
   assert(_prev_frontier_idx == 0, "invariant");
 
   _next_frontier_idx = _edge_queue->top();
-  while (!is_complete()) {
+  // Once the cutoff is reached, the remaining edges can only be iterated
+  // without effect, so stop and keep the chains found so far.
+  while (!is_complete() && !GranularTimer::has_expired()) {
     iterate(_edge_queue->remove()); // edge_queue.remove() increments bottom
   }
 }
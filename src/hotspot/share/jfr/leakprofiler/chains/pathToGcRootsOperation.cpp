@@ -124,6 +124,9 @@ void PathToGcRootsOperation::doit() {
   }
   GranularTimer::stop();
   log_edge_queue_summary(edge_queue);
+  log_debug(jfr, system)("Path to gc roots search %s after " UINT64_FORMAT " ms",
+                         GranularTimer::has_expired() ? "reached cutoff" : "completed",
+                         (GranularTimer::end_time() - GranularTimer::start_time()).milliseconds());
 
   // Emit old objects including their reference chains as events
   EventEmitter emitter(GranularTimer::start_time(), GranularTimer::end_time());
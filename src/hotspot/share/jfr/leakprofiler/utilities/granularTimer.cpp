@@ -55,6 +55,12 @@ const JfrTicks& GranularTimer::end_time() {
   return _finish_time_ticks;
 }
 
+// Whether a previous is_finished() call found the time budget exhausted.
+// Unlike is_finished(), this does not count towards the granularity.
+bool GranularTimer::has_expired() {
+  return _finished;
+}
+
 bool GranularTimer::is_finished() {
   assert(_granularity != 0, "GranularTimer::is_finished must be called after GranularTimer::start");
   if (--_counter == 0) {
@@ -41,6 +41,7 @@ class GranularTimer : public AllStatic {
   static const JfrTicks& start_time();
   static const JfrTicks& end_time();
   static bool is_finished();
+  static bool has_expired();
 };
 
 #endif // SHARE_JFR_LEAKPROFILER_UTILITIES_GRANULARTIMER_HPP
@@ -52,6 +52,7 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/continuationStats.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -607,6 +608,35 @@ TRACE_REQUEST_FUNC(CodeCacheStatistics) {
   }
 }
 
+TRACE_REQUEST_FUNC(ContinuationStatistics) {
+  if (!ContinuationStatistics) {
+    return;
+  }
+  ContinuationStats* total = new ContinuationStats();
+  ContinuationStats::collect(total);
+  const double ns_per_tick = (double)NANOSECS_PER_SEC / os::elapsed_frequency();
+  for (int o = 0; o < ContinuationStats::num_ops; o++) {
+    for (int p = 0; p < ContinuationStats::num_paths; p++) {
+      const ContinuationStats::Op op = (ContinuationStats::Op)o;
+      const ContinuationStats::Path path = (ContinuationStats::Path)p;
+      const uint64_t n = total->count(op, path);
+      if (n == 0) {
+        continue;
+      }
+      EventContinuationStatistics event;
+      event.set_operation(ContinuationStats::op_name(op));
+      event.set_fastPath(path == ContinuationStats::fast_path);
+      event.set_count(n);
+      event.set_averageTime((s8)(total->total_ticks(op, path) * ns_per_tick / n));
+      event.set_p50Time((s8)(total->percentile_ticks(op, path, 0.50) * ns_per_tick));
+      event.set_p99Time((s8)(total->percentile_ticks(op, path, 0.99) * ns_per_tick));
+      event.set_maxTime((s8)(total->percentile_ticks(op, path, 1.00) * ns_per_tick));
+      event.commit();
+    }
+  }
+  delete total;
+}
+
 TRACE_REQUEST_FUNC(CodeCacheConfiguration) {
   EventCodeCacheConfiguration event;
   event.set_initialSize(InitialCodeCacheSize);
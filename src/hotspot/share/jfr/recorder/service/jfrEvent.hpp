@@ -232,19 +232,24 @@ class JfrEvent {
   bool write_sized_event(JfrBuffer* buffer, Thread* thread, traceid tid, traceid sid, bool large_size) {
     JfrNativeEventWriter writer(buffer, thread);
     writer.begin_event_write(large_size);
-    writer.write<u8>(T::eventId);
+    // The header fields share their encoding, so they are
+    // written as one array, with a single bounds check.
+    u8 header[5];
+    size_t header_len = 0;
+    header[header_len++] = T::eventId;
     assert(_start_time != 0, "invariant");
-    writer.write(_start_time);
+    header[header_len++] = _start_time;
     if (!(T::isInstant || T::isRequestable) || T::hasCutoff) {
       assert(_end_time != 0, "invariant");
-      writer.write(_end_time - _start_time);
+      header[header_len++] = _end_time - _start_time;
     }
     if (T::hasThread) {
-      writer.write(tid);
+      header[header_len++] = tid;
     }
     if (T::hasStackTrace) {
-      writer.write(sid);
+      header[header_len++] = sid;
     }
+    writer.write(header, header_len);
     // Payload.
     static_cast<T*>(this)->writeData(writer);
     return writer.end_event_write(large_size) > 0;
@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 #include "jfr/recorder/service/jfrEventThrottler.hpp"
+#include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/utilities/jfrSpinlockHelper.hpp"
 #include "logging/log.hpp"
 
@@ -40,10 +41,12 @@ static JfrEventThrottler* _throttler = NULL;
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
   _last_params(),
+  _pressure_params(),
   _sample_size(0),
   _period_ms(0),
   _sample_size_ewma(0),
   _event_id(event_id),
+  _pressure_shift(0),
   _disabled(false),
   _update(false) {}
 
@@ -206,11 +209,43 @@ const JfrSamplerParams& JfrEventThrottler::update_params(const JfrSamplerWindow*
   set_sample_points_and_window_duration(_last_params, _sample_size, _period_ms);
   set_window_lookback(_last_params);
   _sample_size_ewma = 0;
+  _pressure_shift = 0;
   _last_params.reconfigure = true;
   _update = false;
   return _last_params;
 }
 
+// Largest reduction of the set point under storage pressure, as a shift (1/64).
+constexpr static const int max_pressure_shift = 6;
+
+/*
+ * While more than half of the global JFR buffers are full, the set point is
+ * halved for every expired window, down to 1/64 of the configured rate, to
+ * give the recorder thread a chance to catch up before JfrStorage has to
+ * discard data. Once the pressure is gone, the rate is doubled back per window.
+ */
+const JfrSamplerParams& JfrEventThrottler::pressure_adjusted_params() {
+  const int old_shift = _pressure_shift;
+  if (JfrStorage::control().is_under_pressure()) {
+    _pressure_shift = MIN2(_pressure_shift + 1, max_pressure_shift);
+  } else if (_pressure_shift > 0) {
+    _pressure_shift--;
+  }
+  if (_pressure_shift != old_shift) {
+    log_info(jfr, system, throttle)("Event id %u: storage %s, window set point reduced to 1/%d of " SIZE_FORMAT,
+                                    (unsigned)_event_id, _pressure_shift > old_shift ? "under pressure" : "recovering",
+                                    1 << _pressure_shift, _last_params.sample_points_per_window);
+  }
+  if (_pressure_shift == 0) {
+    return _last_params;
+  }
+  _pressure_params = _last_params;
+  // Keep at least one sample point, unless the configured rate is zero.
+  const size_t points = _last_params.sample_points_per_window;
+  _pressure_params.sample_points_per_window = points == 0 ? 0 : MAX2((size_t)1, points >> _pressure_shift);
+  return _pressure_params;
+}
+
 /*
  * Exponentially Weighted Moving Average (EWMA):
  *
@@ -272,5 +307,5 @@ const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWi
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
-  return _disabled ? _disabled_params : _last_params;
+  return _disabled ? _disabled_params : pressure_adjusted_params();
 }
@@ -33,10 +33,12 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
   friend class JfrRecorder;
  private:
   JfrSamplerParams _last_params;
+  JfrSamplerParams _pressure_params;
   int64_t _sample_size;
   int64_t _period_ms;
   double _sample_size_ewma;
   JfrEventId _event_id;
+  int _pressure_shift;
   bool _disabled;
   bool _update;
 
@@ -47,6 +49,7 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
 
   const JfrSamplerParams& update_params(const JfrSamplerWindow* expired);
   const JfrSamplerParams& next_window_params(const JfrSamplerWindow* expired);
+  const JfrSamplerParams& pressure_adjusted_params();
   static JfrEventThrottler* for_event(JfrEventId event_id);
 
  public:
@@ -28,9 +28,17 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
+ * Lookups walk the hash chains without taking JfrStacktrace_lock, inside a
+ * GlobalCounter critical section. Only inserts take the lock. Entries are
+ * published at the head of a chain with a release store and are never
+ * unlinked individually; clearing a table detaches all chains and waits
+ * for concurrent readers to finish before the entries are deleted.
+ *
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
@@ -105,41 +113,49 @@ size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
   assert(_entries > 0, "invariant");
   int count = 0;
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    const JfrStackTrace* stacktrace = _table[i];
     while (stacktrace != NULL) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       if (stacktrace->should_write()) {
         stacktrace->write(sw);
         ++count;
       }
-      if (clear) {
-        delete stacktrace;
-      }
-      stacktrace = next;
+      stacktrace = stacktrace->next();
     }
   }
   if (clear) {
-    memset(_table, 0, sizeof(_table));
+    clear_table();
     _entries = 0;
   }
   _last_entries = _entries;
   return count;
 }
 
-size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
+void JfrStackTraceRepository::clear_table() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const chains = NEW_C_HEAP_ARRAY(JfrStackTrace*, TABLE_SIZE, mtTracing);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    chains[i] = _table[i];
+    Atomic::release_store(&_table[i], (JfrStackTrace*)NULL);
   }
+  // Wait for lock-free readers that may still be walking the detached chains.
+  GlobalCounter::write_synchronize();
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
+    JfrStackTrace* stacktrace = chains[i];
     while (stacktrace != NULL) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
       delete stacktrace;
       stacktrace = next;
     }
   }
-  memset(repo._table, 0, sizeof(repo._table));
+  FREE_C_HEAP_ARRAY(JfrStackTrace*, chains);
+}
+
+size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  if (repo._entries == 0) {
+    return 0;
+  }
+  repo.clear_table();
   const size_t processed = repo._entries;
   repo._entries = 0;
   repo._last_entries = 0;
@@ -199,11 +215,27 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
 }
 
 traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
   assert(stacktrace._nr_of_frames > 0, "invariant");
   const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
+  {
+    // Fast path, most traces are already in the table.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* table_entry = Atomic::load_acquire(&_table[index]);
+    while (table_entry != NULL) {
+      if (table_entry->equals(stacktrace)) {
+        return table_entry->id();
+      }
+      table_entry = table_entry->next();
+    }
+  }
 
+  if (!stacktrace.have_lineno()) {
+    return 0;
+  }
+
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  // Recheck, another thread may have added the trace in the meantime.
+  const JfrStackTrace* table_entry = _table[index];
   while (table_entry != NULL) {
     if (table_entry->equals(stacktrace)) {
       return table_entry->id();
@@ -211,12 +243,8 @@ traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
     table_entry = table_entry->next();
   }
 
-  if (!stacktrace.have_lineno()) {
-    return 0;
-  }
-
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
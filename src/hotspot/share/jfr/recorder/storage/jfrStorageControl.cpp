@@ -76,6 +76,11 @@ bool JfrStorageControl::should_discard() const {
   return !to_disk() && full_count() >= _in_memory_discard_threshold;
 }
 
+// More than half of the global buffers are full and waiting to be written.
+bool JfrStorageControl::is_under_pressure() const {
+  return full_count() > _global_count_total / 2;
+}
+
 size_t JfrStorageControl::global_lease_count() const {
   return Atomic::load(&_global_lease_count);
 }
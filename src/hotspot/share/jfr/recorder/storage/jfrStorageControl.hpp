@@ -49,6 +49,7 @@ class JfrStorageControl : public JfrCHeapObj {
   void   reset_full();
   bool should_post_buffer_full_message() const;
   bool should_discard() const;
+  bool is_under_pressure() const;
 
   size_t global_lease_count() const;
   size_t increment_leased();
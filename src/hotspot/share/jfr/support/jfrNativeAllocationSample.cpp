@@ -0,0 +1,109 @@
+/*
+* Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrNativeAllocationSample.inline.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/thread.hpp"
+#include "services/nmtCommon.hpp"
+#include "utilities/nativeCallStack.hpp"
+
+THREAD_LOCAL bool JfrNativeAllocationSample::_has_pending = false;
+
+static THREAD_LOCAL size_t _bytes_since_sample = 0;
+
+// The sample waiting to be committed by its thread. The thread is identified
+// by its JFR thread id, which unlike its address is never reused.
+static THREAD_LOCAL traceid _pending_thread_id = 0;
+static THREAD_LOCAL size_t _pending_size = 0;
+static THREAD_LOCAL size_t _pending_weight = 0;
+static THREAD_LOCAL u8 _pending_caller_pc = 0;
+static THREAD_LOCAL MEMFLAGS _pending_flags = mtNone;
+
+// Only Java threads allocating in the VM are sampled: they are the ones that
+// later leave the VM through a transition that commits the sample, with the
+// Java stack of the allocation still in place. Hidden threads, such as
+// compiler threads, rarely do. Allocations by other threads, or in other
+// states, are accumulated into the weight of the next sample.
+static JavaThread* sampling_thread() {
+  Thread* const thread = Thread::current_or_null();
+  if (thread == NULL || !thread->is_Java_thread()) {
+    return NULL;
+  }
+  JavaThread* const jt = JavaThread::cast(thread);
+  if (jt->thread_state() != _thread_in_vm || jt->is_hidden_from_external_view()) {
+    return NULL;
+  }
+  return jt->jfr_thread_local()->is_dead() ? NULL : jt;
+}
+
+void JfrNativeAllocationSample::record(size_t size, MEMFLAGS flags, const NativeCallStack& stack) {
+  // JFR's own allocations are not sampled.
+  if (flags == mtTracing) {
+    return;
+  }
+  _bytes_since_sample += size;
+  if (_bytes_since_sample < NativeAllocationSampleInterval) {
+    return;
+  }
+  JavaThread* const jt = sampling_thread();
+  if (jt == NULL) {
+    return;
+  }
+  const traceid thread_id = JfrThreadLocal::jvm_thread_id(jt);
+  // While a sample of this thread is pending, including while it is being
+  // committed, the bytes go into the weight of the next one. A sample left
+  // behind by an earlier thread on the same native thread is replaced.
+  if (_has_pending && _pending_thread_id == thread_id) {
+    return;
+  }
+  _pending_thread_id = thread_id;
+  _pending_size = size;
+  _pending_weight = _bytes_since_sample;
+  // The native caller is only known when -XX:NativeMemoryTracking=detail collects call stacks.
+  _pending_caller_pc = stack.is_empty() ? 0 : (u8)p2i(stack.get_frame(0));
+  _pending_flags = flags;
+  _bytes_since_sample = 0;
+  _has_pending = true;
+}
+
+void JfrNativeAllocationSample::commit(JavaThread* jt, bool can_commit) {
+  assert(_has_pending, "invariant");
+  // The thread-local state outlives a JavaThread if the native thread attaches
+  // again, so drop a sample left behind by an earlier thread.
+  if (can_commit && _pending_thread_id == JfrThreadLocal::jvm_thread_id(jt)) {
+    EventNativeAllocationSample event;
+    if (event.should_commit()) {
+      event.set_memoryType(NMTUtil::flag_to_name(_pending_flags));
+      event.set_size(_pending_size);
+      event.set_weight(_pending_weight);
+      event.set_callerPC(_pending_caller_pc);
+      event.commit();
+    }
+  }
+  _pending_thread_id = 0;
+  _has_pending = false;
+}
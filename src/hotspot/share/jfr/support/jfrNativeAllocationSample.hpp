@@ -0,0 +1,58 @@
+/*
+* Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#ifndef SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
+#define SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
+
+#include "memory/allStatic.hpp"
+#include "memory/allocation.hpp"
+
+class JavaThread;
+class NativeCallStack;
+
+//
+// Samples os::malloc and os::realloc, about once every NativeAllocationSampleInterval
+// bytes allocated by a thread, as NativeAllocationSample events.
+//
+// os::malloc can be called with any VM lock held, including locks ranked below the
+// ones JFR takes to record stack traces and write events. A sample is therefore only
+// recorded in thread-local storage, and committed when the allocating thread leaves
+// the VM scope it was taken in, at which point it holds no VM locks.
+//
+class JfrNativeAllocationSample : AllStatic {
+ private:
+  static THREAD_LOCAL bool _has_pending;
+  static void commit(JavaThread* jt, bool can_commit);
+ public:
+  static inline void sample(size_t size, MEMFLAGS flags, const NativeCallStack& stack);
+  static void record(size_t size, MEMFLAGS flags, const NativeCallStack& stack);
+  static bool has_pending() { return _has_pending; }
+
+  // Called by the thread state transitions that leave the VM. A sample that
+  // cannot be committed, because the thread may still hold VM locks, is
+  // dropped rather than left for a later, unrelated transition.
+  static inline void commit_pending(JavaThread* jt, bool can_commit = true);
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
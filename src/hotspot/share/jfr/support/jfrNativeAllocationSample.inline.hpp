@@ -0,0 +1,47 @@
+/*
+* Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+* DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+*
+* This code is free software; you can redistribute it and/or modify it
+* under the terms of the GNU General Public License version 2 only, as
+* published by the Free Software Foundation.
+*
+* This code is distributed in the hope that it will be useful, but WITHOUT
+* ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+* FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+* version 2 for more details (a copy is included in the LICENSE file that
+* accompanied this code).
+*
+* You should have received a copy of the GNU General Public License version
+* 2 along with this work; if not, write to the Free Software Foundation,
+* Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+*
+* Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+* or visit www.oracle.com if you need additional information or have any
+* questions.
+*
+*/
+
+#ifndef SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_INLINE_HPP
+#define SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_INLINE_HPP
+
+#include "jfr/support/jfrNativeAllocationSample.hpp"
+
+#include "jfr/recorder/jfrEventSetting.inline.hpp"
+
+// Only touches the thread-local state while the event is enabled. A sample
+// left pending when the event was disabled is committed by the first
+// transition after it is enabled again.
+inline void JfrNativeAllocationSample::commit_pending(JavaThread* jt, bool can_commit) {
+  if (JfrEventSetting::is_enabled(JfrNativeAllocationSampleEvent) && _has_pending) {
+    commit(jt, can_commit);
+  }
+}
+
+inline void JfrNativeAllocationSample::sample(size_t size, MEMFLAGS flags, const NativeCallStack& stack) {
+  if (JfrEventSetting::is_enabled(JfrNativeAllocationSampleEvent)) {
+    record(size, flags, stack);
+  }
+}
+
+#endif // SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_INLINE_HPP
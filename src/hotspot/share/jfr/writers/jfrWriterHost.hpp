@@ -51,8 +51,6 @@ class WriterHost : public WriterPolicyImpl {
   template <typename T>
   u1* write_padded(const T* value, size_t len, u1* pos);
   template <typename T>
-  void write(const T* value, size_t len);
-  template <typename T>
   u1* write(const T* value, size_t len, u1* pos);
   void write_utf8(const char* value);
   void write_utf16(const jchar* value, jint len);
@@ -72,6 +70,9 @@ class WriterHost : public WriterPolicyImpl {
  public:
   template <typename T>
   void write(T value);
+  // Writes len values with a single bounds check for their worst case size.
+  template <typename T>
+  void write(const T* value, size_t len);
   void write(bool value);
   void write(float value);
   void write(double value);
@@ -42,38 +42,51 @@ class AsyncLogWriter::AsyncLogLocker : public StackObj {
   }
 };
 
-void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
+// The message and its list node are allocated by the caller before taking
+// the lock, so the critical section is only the linking of the node.
+void AsyncLogWriter::enqueue_locked(LinkedListNode<AsyncLogMessage>* node) {
   if (_buffer.size() >= _buffer_max_size) {
     bool p_created;
-    uint32_t* counter = _stats.put_if_absent(msg.output(), 0, &p_created);
+    uint32_t* counter = _stats.put_if_absent(node->peek()->output(), 0, &p_created);
     *counter = *counter + 1;
     // drop the enqueueing message.
-    os::free(msg.message());
+    os::free(node->peek()->message());
+    _buffer.delete_node(node);
     return;
   }
 
-  _buffer.push_back(msg);
-  _data_available = true;
-  _lock.notify();
+  _buffer.link_back(node);
+  // The AsyncLog thread re-checks _data_available under the lock before
+  // waiting, so it only needs a wakeup when the buffer becomes non-empty.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
   AsyncLogMessage m(&output, decorations, os::strdup(msg));
+  LinkedListNode<AsyncLogMessage>* node = _buffer.new_node(m);
 
   { // critical area
     AsyncLogLocker locker;
-    enqueue_locked(m);
+    enqueue_locked(node);
   }
 }
 
 // LogMessageBuffer consists of a multiple-part/multiple-line messsage.
 // The lock here guarantees its integrity.
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iterator msg_iterator) {
-  AsyncLogLocker locker;
-
+  AsyncLogBuffer parts;
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
     AsyncLogMessage m(&output, msg_iterator.decorations(), os::strdup(msg_iterator.message()));
-    enqueue_locked(m);
+    parts.link_back(parts.new_node(m));
+  }
+
+  AsyncLogLocker locker;
+  LinkedListNode<AsyncLogMessage>* node;
+  while ((node = parts.unlink_front()) != NULL) {
+    enqueue_locked(node);
   }
 }
 
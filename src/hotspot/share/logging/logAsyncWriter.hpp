@@ -50,6 +50,43 @@ class LinkedListDeque : private LinkedListImpl<E, ResourceObj::C_HEAP, F> {
     ++_size;
   }
 
+  // Allocate a node for e without linking it, so that the allocation can
+  // happen outside of the lock protecting the deque.
+  LinkedListNode<E>* new_node(const E& e) const {
+    return LinkedListImpl<E, ResourceObj::C_HEAP, F>::new_node(e);
+  }
+
+  void delete_node(LinkedListNode<E>* node) {
+    LinkedListImpl<E, ResourceObj::C_HEAP, F>::delete_node(node);
+  }
+
+  // Link a node obtained from new_node() at the tail.
+  void link_back(LinkedListNode<E>* node) {
+    assert(node->next() == NULL, "must be unlinked");
+    if (!_tail) {
+      this->add(node);
+    } else {
+      _tail->set_next(node);
+    }
+    _tail = node;
+
+    ++_size;
+  }
+
+  // Unlink the head node without deleting it.
+  LinkedListNode<E>* unlink_front() {
+    LinkedListNode<E>* h = this->unlink_head();
+    if (h == _tail) {
+      _tail = NULL;
+    }
+
+    if (h != NULL) {
+      --_size;
+      h->set_next(NULL);
+    }
+    return h;
+  }
+
   // pop all elements to logs.
   void pop_all(LinkedList<E>* logs) {
     logs->move(static_cast<LinkedList<E>* >(this));
@@ -155,7 +192,7 @@ class AsyncLogWriter : public NonJavaThread {
   const size_t _buffer_max_size = {AsyncLogBufferSize / (sizeof(AsyncLogMessage) + vwrite_buffer_size)};
 
   AsyncLogWriter();
-  void enqueue_locked(const AsyncLogMessage& msg);
+  void enqueue_locked(LinkedListNode<AsyncLogMessage>* node);
   void write();
   void run() override;
   void pre_run() override {
@@ -67,6 +67,7 @@ class outputStream;
   LOG_TAG(dcmd) \
   LOG_TAG(decoder) \
   LOG_TAG(defaultmethods) \
+  LOG_TAG(deoptimization) \
   LOG_TAG(director) \
   LOG_TAG(dump) \
   LOG_TAG(dynamic) \
@@ -104,6 +105,7 @@ class outputStream;
   LOG_TAG(liveness) \
   LOG_TAG(load) /* Trace all classes loaded */ \
   LOG_TAG(loader) \
+  LOG_TAG(lock) \
   LOG_TAG(logging) \
   LOG_TAG(malloc) \
   LOG_TAG(map) \
@@ -143,6 +145,7 @@ class outputStream;
   LOG_TAG(phases) \
   LOG_TAG(plab) \
   LOG_TAG(placeholders) \
+  LOG_TAG(predict) \
   LOG_TAG(preempt) \
   LOG_TAG(preorder)  /* Trace all classes loaded in order referenced (not loaded) */ \
   LOG_TAG(preview)   /* Trace loading of preview feature types */ \
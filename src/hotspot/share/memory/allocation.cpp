@@ -49,14 +49,14 @@ char* AllocateHeap(size_t size,
 char* AllocateHeap(size_t size,
                    MEMFLAGS flags,
                    AllocFailType alloc_failmode /* = AllocFailStrategy::EXIT_OOM*/) {
-  return AllocateHeap(size, flags, CALLER_PC);
+  return AllocateHeap(size, flags, MALLOC_CALLER_PC);
 }
 
 char* ReallocateHeap(char *old,
                      size_t size,
                      MEMFLAGS flag,
                      AllocFailType alloc_failmode) {
-  char* p = (char*) os::realloc(old, size, flag, CALLER_PC);
+  char* p = (char*) os::realloc(old, size, flag, MALLOC_CALLER_PC);
   if (p == NULL && alloc_failmode == AllocFailStrategy::EXIT_OOM) {
     vm_exit_out_of_memory(size, OOM_MALLOC_ERROR, "ReallocateHeap");
   }
@@ -114,7 +114,7 @@ void* ResourceObj::operator new(size_t size, allocation_type type, MEMFLAGS flag
   address res = NULL;
   switch (type) {
    case C_HEAP:
-    res = (address)AllocateHeap(size, flags, CALLER_PC);
+    res = (address)AllocateHeap(size, flags, MALLOC_CALLER_PC);
     DEBUG_ONLY(set_allocation_type(res, C_HEAP);)
     break;
    case RESOURCE_AREA:
@@ -133,7 +133,7 @@ void* ResourceObj::operator new(size_t size, const std::nothrow_t&  nothrow_cons
   address res = NULL;
   switch (type) {
    case C_HEAP:
-    res = (address)AllocateHeap(size, flags, CALLER_PC, AllocFailStrategy::RETURN_NULL);
+    res = (address)AllocateHeap(size, flags, MALLOC_CALLER_PC, AllocFailStrategy::RETURN_NULL);
     DEBUG_ONLY(if (res!= NULL) set_allocation_type(res, C_HEAP);)
     break;
    case RESOURCE_AREA:
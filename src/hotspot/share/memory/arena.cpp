@@ -28,11 +28,13 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/os.hpp"
 #include "runtime/task.hpp"
+#include "runtime/thread.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/memTracker.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
+#include "utilities/vmError.hpp"
 
 // Pre-defined default chunk sizes must be arena-aligned, see Chunk::operator new()
 STATIC_ASSERT(is_aligned((int)Chunk::tiny_size, ARENA_AMALLOC_ALIGNMENT));
@@ -46,21 +48,35 @@ STATIC_ASSERT(is_aligned((int)Chunk::non_pool_size, ARENA_AMALLOC_ALIGNMENT));
 
 // MT-safe pool of same-sized chunks to reduce malloc/free thrashing
 // NB: not using Mutex because pools are used before Threads are initialized
+//
+// Each pool has its own spin lock rather than using ThreadCritical, which
+// is a single global lock shared with many unrelated users. The critical
+// sections only push or pop a list element, and the lock is a leaf lock.
+// Unlike ThreadCritical it is not re-entrant, so the thread reporting a
+// fatal error, which may have crashed while holding it, bypasses the pools.
 class ChunkPool {
   Chunk*       _first;        // first cached Chunk; its first word points to next chunk
   size_t       _num_chunks;   // number of unused chunks in pool
   const size_t _size;         // (inner payload) size of the chunks this pool serves
+  volatile int _lock;         // guards _first and _num_chunks
 
   // Our four static pools
   static const int _num_pools = 4;
   static ChunkPool _pools[_num_pools];
 
+  class Locker : public StackObj {
+    ChunkPool* const _pool;
+   public:
+    Locker(ChunkPool* pool) : _pool(pool) { Thread::SpinAcquire(&_pool->_lock, "ChunkPool"); }
+    ~Locker()                             { Thread::SpinRelease(&_pool->_lock); }
+  };
+
  public:
-  ChunkPool(size_t size) : _first(NULL), _num_chunks(0), _size(size) {}
+  ChunkPool(size_t size) : _first(NULL), _num_chunks(0), _size(size), _lock(0) {}
 
   // Allocate a chunk from the pool; returns NULL if pool is empty.
   Chunk* allocate() {
-    ThreadCritical tc;
+    Locker ml(this);
     Chunk* c = _first;
     if (_first != nullptr) {
       _first = _first->next();
@@ -72,7 +88,7 @@ class ChunkPool {
   // Return a chunk to the pool
   void free(Chunk* chunk) {
     assert(chunk->length() == _size, "wrong pool for this chunk");
-    ThreadCritical tc;
+    Locker ml(this);
     chunk->set_next(_first);
     _first = chunk;
     _num_chunks++;
@@ -84,26 +100,32 @@ class ChunkPool {
     Chunk* cur = NULL;
     Chunk* next;
     // if we have more than n chunks, free all of them
-    ThreadCritical tc;
-    if (_num_chunks > blocksToKeep) {
-      // free chunks at end of queue, for better locality
-      cur = _first;
-      for (size_t i = 0; i < (blocksToKeep - 1); i++) {
+    {
+      Locker ml(this);
+      if (_num_chunks > blocksToKeep) {
+        // free chunks at end of queue, for better locality
+        cur = _first;
+        for (size_t i = 0; i < (blocksToKeep - 1); i++) {
+          assert(cur != NULL, "counter out of sync?");
+          cur = cur->next();
+        }
         assert(cur != NULL, "counter out of sync?");
-        cur = cur->next();
-      }
-      assert(cur != NULL, "counter out of sync?");
 
-      next = cur->next();
-      cur->set_next(NULL);
-      cur = next;
+        next = cur->next();
+        cur->set_next(NULL);
+        cur = next;
+        _num_chunks = blocksToKeep;
+      }
+    }
 
+    if (cur != NULL) {
       // Free all remaining chunks while in ThreadCritical lock
-      // so NMT adjustment is stable.
+      // so NMT adjustment is stable. The pool lock is not held here,
+      // so that it stays a leaf lock.
+      ThreadCritical tc;
       while(cur != NULL) {
         next = cur->next();
         os::free(cur);
-        _num_chunks--;
         cur = next;
       }
     }
@@ -117,6 +139,9 @@ class ChunkPool {
 
   // Given a (inner payload) size, return the pool responsible for it, or NULL if the size is non-standard
   static ChunkPool* get_pool_for_size(size_t size) {
+    if (VMError::is_error_reported() && VMError::is_error_reported_in_current_thread()) {
+      return NULL;
+    }
     for (int i = 0; i < _num_pools; i++) {
       if (_pools[i]._size == size) {
         return _pools + i;
@@ -87,6 +87,21 @@ void ChunkManagerStats::print_on(outputStream* st, size_t scale) const {
   st->print(", committed: ");
   print_scaled_words_and_percentage(st, total_committed_size, total_size, scale);
   st->cr();
+  // Free space that sits in chunks smaller than a root chunk could only
+  // be handed out as a root chunk again after buddies are merged.
+  if (total_size > 0) {
+    const size_t root_size = _num_chunks[chunklevel::ROOT_CHUNK_LEVEL] *
+                             chunklevel::word_size_for_level(chunklevel::ROOT_CHUNK_LEVEL);
+    chunklevel_t largest = chunklevel::LOWEST_CHUNK_LEVEL;
+    while (_num_chunks[largest] == 0) {
+      largest++;
+    }
+    st->print("Largest free chunk: ");
+    chunklevel::print_chunk_size(st, largest);
+    st->print(", fragmented (below root chunk size): ");
+    print_scaled_words_and_percentage(st, total_size - root_size, total_size, scale);
+    st->cr();
+  }
 }
 
 #ifdef ASSERT
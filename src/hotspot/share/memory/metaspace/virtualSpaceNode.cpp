@@ -105,8 +105,14 @@ bool VirtualSpaceNode::commit_range(MetaWord* p, size_t word_size) {
     return false;
   }
 
-  // Commit...
-  if (os::commit_memory((char*)p, word_size * BytesPerWord, false) == false) {
+  // Commit... With large pages this passes a hint so that the OS can back
+  // the range with transparent huge pages. The large page size is only
+  // known after os::init_2(), so it is not cached in Settings.
+  const size_t alignment_hint = (MetaspaceUseLargePages && UseLargePages) ? os::large_page_size() : 0;
+  const bool committed = alignment_hint > 0 ?
+    os::commit_memory((char*)p, word_size * BytesPerWord, alignment_hint, false) :
+    os::commit_memory((char*)p, word_size * BytesPerWord, false);
+  if (committed == false) {
     vm_exit_out_of_memory(word_size * BytesPerWord, OOM_MMAP_ERROR, "Failed to commit metaspace.");
   }
 
@@ -370,6 +370,35 @@ void ConstantPool::restore_unshareable_info(TRAPS) {
   }
 }
 
+// A class entry can stay resolved in the archive if the resolved class is
+// guaranteed to be loaded, and to be the same class, whenever the pool
+// holder is loaded from the archive: that is the holder itself and its
+// super types, which are checked by SystemDictionary::load_shared_class.
+// Resolving such an entry has no side effects (no initialization), so
+// skipping the runtime resolution is not observable. This is limited to
+// boot classes, whose resolution does not involve Java code.
+bool ConstantPool::can_archive_resolved_klass(int cp_index) {
+  assert(tag_at(cp_index).is_klass(), "must be resolved");
+  InstanceKlass* holder = pool_holder();
+  if (!holder->is_shared_boot_class()) {
+    return false;
+  }
+  CPKlassSlot kslot = klass_slot_at(cp_index);
+  Klass* k = resolved_klasses()->at(kslot.resolved_klass_index());
+  if (k == NULL) {
+    return false;
+  }
+  if (holder->is_subclass_of(k) || (k->is_interface() && holder->implements_interface(k))) {
+    if (log_is_enabled(Trace, cds, resolve)) {
+      ResourceMark rm;
+      log_trace(cds, resolve)("Archived resolved class entry #%d in %s: %s",
+                              cp_index, holder->external_name(), k->external_name());
+    }
+    return true;
+  }
+  return false;
+}
+
 void ConstantPool::remove_unshareable_info() {
   // Shared ConstantPools are in the RO region, so the _flags cannot be modified.
   // The _on_stack flag is used to prevent ConstantPools from deallocation during
@@ -410,6 +439,8 @@ void ConstantPool::remove_unshareable_info() {
         // All references to a hidden class's own field/methods are through this
         // index. We cannot clear it. See comments in ClassFileParser::fill_instance_klass.
         clear_it = false;
+      } else if (ArchiveResolvedSuperTypes && can_archive_resolved_klass(index)) {
+        clear_it = false;
       }
       if (clear_it) {
         CPKlassSlot kslot = klass_slot_at(index);
@@ -1544,7 +1544,7 @@ void InstanceKlass::mask_for(const methodHandle& method, int bci,
     MutexLocker x(OopMapCacheAlloc_lock);
     // Check if _oop_map_cache was allocated while we were waiting for this lock
     if ((oop_map_cache = _oop_map_cache) == NULL) {
-      oop_map_cache = new OopMapCache();
+      oop_map_cache = new OopMapCache(methods()->length());
       // Ensure _oop_map_cache is stable, since it is examined without a lock
       Atomic::release_store(&_oop_map_cache, oop_map_cache);
     }
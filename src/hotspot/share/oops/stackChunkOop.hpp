@@ -82,6 +82,10 @@ public:
   inline int max_size() const;
   inline void set_max_size(int value);
 
+  // number of monitors held by the continuation's frames when it was last frozen (see YieldWithMonitors)
+  inline int locked_monitors() const;
+  inline void set_locked_monitors(int value);
+
   inline oop cont() const;
   template<typename P> inline oop cont() const;
   inline void set_cont(oop value);
@@ -72,6 +72,9 @@ inline void stackChunkOopDesc::set_max_size(int value)  {
   jdk_internal_vm_StackChunk::set_maxSize(this, (jint)value);
 }
 
+inline int stackChunkOopDesc::locked_monitors() const          { return jdk_internal_vm_StackChunk::lockedMonitors(as_oop()); }
+inline void stackChunkOopDesc::set_locked_monitors(int value)  { jdk_internal_vm_StackChunk::set_lockedMonitors(as_oop(), value); }
+
 inline oop stackChunkOopDesc::cont() const              { return UseCompressedOops ? cont<narrowOop>() : cont<oop>(); /* jdk_internal_vm_StackChunk::cont(as_oop()); */ }
 template<typename P>
 inline oop stackChunkOopDesc::cont() const              {
@@ -26,6 +26,7 @@
 #include "libadt/vectset.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
+#include "compiler/compileLog.hpp"
 #include "compiler/compilerDirectives.hpp"
 #include "opto/block.hpp"
 #include "opto/cfgnode.hpp"
@@ -1722,6 +1723,41 @@ PhaseBlockLayout::PhaseBlockLayout(PhaseCFG &cfg)
   reorder_traces(size);
 
   assert(_cfg.number_of_blocks() >= (uint) (size - 1), "number of blocks can not shrink");
+
+  log_fall_through_frequency(size);
+}
+
+// Record in the compile log how much of the frequency of the edges that
+// could fall through actually does so in the final block order.  Taken
+// branches on hot paths show up as a low percentage.
+void PhaseBlockLayout::log_fall_through_frequency(int count) {
+  CompileLog* log = C->log();
+  if (log == NULL) {
+    return;
+  }
+  // Position of each block in the final order, ignoring connector
+  // blocks, which do not emit any code.
+  ResourceArea *area = Thread::current()->resource_area();
+  int* position = NEW_ARENA_ARRAY(area, int, count);
+  int pos = 0;
+  for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+    Block* b = _cfg.get_block(i);
+    if (!b->is_connector()) {
+      position[b->_pre_order] = pos++;
+    }
+  }
+  double total_freq = 0.0;
+  double fall_through_freq = 0.0;
+  for (int i = 0; i < edges->length(); i++) {
+    CFGEdge* e = edges->at(i);
+    total_freq += e->freq();
+    if (position[e->to()->_pre_order] == position[e->from()->_pre_order] + 1) {
+      fall_through_freq += e->freq();
+    }
+  }
+  double pct = total_freq > 0.0 ? (100.0 * fall_through_freq) / total_freq : 100.0;
+  log->elem("block_layout blocks='%d' edges='%d' fall_through_pct='%.1f'",
+            pos, edges->length(), pct);
 }
 
 
@@ -901,6 +901,7 @@ class PhaseBlockLayout : public Phase {
   void merge_traces(bool loose_connections);
   void reorder_traces(int count);
   void union_traces(Trace* from, Trace* to);
+  void log_fall_through_frequency(int count);
 };
 
 #endif // SHARE_OPTO_BLOCK_HPP
@@ -90,6 +90,11 @@
   product(bool, AlignVector, true,                                          \
           "Perform vector store/load alignment in loop")                    \
                                                                             \
+  product(bool, SuperWordPreLoopAlignment, true, DIAGNOSTIC,                \
+          "Run extra pre-loop iterations to align the vector memory "       \
+          "accesses of the main loop. Turning this off only has an "        \
+          "effect with -XX:-AlignVector")                                   \
+                                                                            \
   product(intx, NumberOfLoopInstrToAlign, 4,                                \
           "Number of first instructions in a loop to align")                \
           range(0, max_jint)                                                \
@@ -265,6 +270,10 @@
   product(bool, ReduceBulkZeroing, true,                                    \
           "When bulk-initializing, try to avoid needless zeroing")          \
                                                                             \
+  product(bool, MergeStores, false, EXPERIMENTAL,                           \
+          "Merge adjacent array stores of the parts of a value, or of "     \
+          "constants, into a single wider store")                           \
+                                                                            \
   product(bool, UseFPUForSpilling, false,                                   \
           "Spill integer registers to FPU instead of stack when possible")  \
                                                                             \
@@ -394,6 +403,15 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false, EXPERIMENTAL,                \
+          "Profiling based inlining for more than two receivers, with a "   \
+          "virtual call for the others. Needs TypeProfileWidth > 2")        \
+                                                                            \
+  product(uintx, PolymorphicInliningMinPercent, 5, EXPERIMENTAL,            \
+          "Share of the calls at a site a receiver needs to get its own "   \
+          "type check with polymorphic inlining")                           \
+          range(0, 100)                                                     \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -411,6 +429,12 @@
           "Set level of loop optimization for tier 1 compiles")             \
           range(5, 43)                                                      \
                                                                             \
+  product(intx, LoopOptsTimeBudget, 0, DIAGNOSTIC,                          \
+          "Milliseconds a compilation may spend optimizing before no "      \
+          "further rounds of loop optimizations are started "               \
+          "(0 means no limit)")                                             \
+          range(0, max_jint)                                                \
+                                                                            \
   /* controls for heat-based inlining */                                    \
                                                                             \
   develop(intx, NodeCountInliningCutoff, 18000,                             \
@@ -71,6 +71,7 @@
 #include "opto/vector.hpp"
 #include "opto/vectornode.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -990,6 +991,7 @@ void Compile::Init(int aliaslevel) {
 
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   _loop_opts_cnt = LoopOptsCount;
+  _optimize_start_ns = 0;
   set_do_inlining(Inline);
   set_max_inline_size(MaxInlineSize);
   set_freq_inline_size(FreqInlineSize);
@@ -2032,6 +2034,7 @@ void Compile::process_late_inline_calls_no_inline(PhaseIterGVN& igvn) {
 }
 
 bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
+  check_loop_opts_time_budget();
   if (_loop_opts_cnt > 0) {
     debug_only( int cnt = 0; );
     while (major_progress() && (_loop_opts_cnt > 0)) {
@@ -2041,11 +2044,27 @@ bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
       _loop_opts_cnt--;
       if (failing())  return false;
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP_ITERATIONS, 2);
+      check_loop_opts_time_budget();
     }
   }
   return true;
 }
 
+void Compile::check_loop_opts_time_budget() {
+  if (LoopOptsTimeBudget == 0 || _loop_opts_cnt == 0) {
+    return;
+  }
+  jlong elapsed_ms = (os::javaTimeNanos() - _optimize_start_ns) / NANOSECS_PER_MILLISEC;
+  if (elapsed_ms >= LoopOptsTimeBudget) {
+    if (log() != NULL) {
+      log()->elem("loop_opts_time_budget elapsed_ms='" JLONG_FORMAT "' skipped_rounds='%d'",
+                  elapsed_ms, _loop_opts_cnt);
+    }
+    // Later phases only run loop opts while rounds are left.
+    _loop_opts_cnt = 0;
+  }
+}
+
 // Remove edges from "root" to each SafePoint at a backward branch.
 // They were inserted during parsing (see add_safepoint()) to make
 // infinite loops without calls or exceptions visible to root, i.e.,
@@ -2075,6 +2094,7 @@ void Compile::remove_root_to_sfpts_edges(PhaseIterGVN& igvn) {
 // Given a graph, optimize it.
 void Compile::Optimize() {
   TracePhase tp("optimizer", &timers[_t_optimizer]);
+  _optimize_start_ns = os::javaTimeNanos();
 
 #ifndef PRODUCT
   if (env()->break_at_compile()) {
@@ -2226,6 +2246,7 @@ void Compile::Optimize() {
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP1, 2);
       if (failing())  return;
     }
+    check_loop_opts_time_budget();
     // Loop opts pass if partial peeling occurred in previous pass
     if(PartialPeelLoop && major_progress() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
@@ -2234,6 +2255,7 @@ void Compile::Optimize() {
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP2, 2);
       if (failing())  return;
     }
+    check_loop_opts_time_budget();
     // Loop opts pass for loop-unrolling before CCP
     if(major_progress() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
@@ -4150,12 +4172,19 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
     _log = NULL;
   }
   if (_log != NULL) {
-    _log->begin_head("phase name='%s' nodes='%d' live='%d'", _phase_name, C->unique(), C->live_nodes());
+    _log->begin_head("phase name='%s' nodes='%d' live='%d' arena='" SIZE_FORMAT "'",
+                     _phase_name, C->unique(), C->live_nodes(), C->arena_bytes());
     _log->stamp();
     _log->end_head();
   }
 }
 
+size_t Compile::arena_bytes() {
+  return comp_arena()->size_in_bytes() +
+         node_arena()->size_in_bytes() +
+         Thread::current()->resource_area()->size_in_bytes();
+}
+
 Compile::TracePhase::~TracePhase() {
 
   C = Compile::current();
@@ -4177,7 +4206,8 @@ Compile::TracePhase::~TracePhase() {
 #endif
 
   if (_log != NULL) {
-    _log->done("phase name='%s' nodes='%d' live='%d'", _phase_name, C->unique(), C->live_nodes());
+    _log->done("phase name='%s' nodes='%d' live='%d' arena='" SIZE_FORMAT "'",
+               _phase_name, C->unique(), C->live_nodes(), C->arena_bytes());
   }
 }
 
@@ -335,6 +335,7 @@ class Compile : public Phase {
   bool                  _has_monitors;          // Metadata transfered to nmethod to enable Continuations lock-detection fastpath
   RTMState              _rtm_state;             // State of Restricted Transactional Memory usage
   int                   _loop_opts_cnt;         // loop opts round
+  jlong                 _optimize_start_ns;     // Start of Optimize(), for LoopOptsTimeBudget
   bool                  _clinit_barrier_on_entry; // True if clinit barrier is needed on nmethod entry
   uint                  _stress_seed;           // Seed for stress testing
 
@@ -777,6 +778,9 @@ class Compile : public Phase {
   static int   debug_idx()                 { return debug_only(_debug_idx)+0; }
   static void  set_debug_idx(int i)        { debug_only(_debug_idx = i); }
   Arena*       node_arena()                { return &_node_arena; }
+  // Bytes held by the compilation's arenas and the compiler thread's
+  // resource area, for per-phase memory accounting.
+  size_t       arena_bytes();
   Arena*       old_arena()                 { return &_old_arena; }
   RootNode*    root() const                { return _root; }
   void         set_root(RootNode* r)       { _root = r; }
@@ -885,6 +889,11 @@ class Compile : public Phase {
   CallGenerator*    call_generator(ciMethod* call_method, int vtable_index, bool call_does_dispatch,
                                    JVMState* jvms, bool allow_inline, float profile_factor, ciKlass* speculative_receiver_type = NULL,
                                    bool allow_intrinsics = true);
+  // Type check and inline the most frequent profiled receivers of a
+  // megamorphic call site, falling back to a virtual call.
+  CallGenerator*    polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                               bool allow_inline, float prof_factor,
+                                               ciCallProfile& profile);
   bool should_delay_inlining(ciMethod* call_method, JVMState* jvms) {
     return should_delay_string_inlining(call_method, jvms) ||
            should_delay_boxing_inlining(call_method, jvms) ||
@@ -1003,6 +1012,8 @@ class Compile : public Phase {
   void inline_string_calls(bool parse_time);
   void inline_boxing_calls(PhaseIterGVN& igvn);
   bool optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode);
+  // Stop further loop opts rounds once LoopOptsTimeBudget is used up.
+  void check_loop_opts_time_budget();
   void remove_root_to_sfpts_edges(PhaseIterGVN& igvn);
 
   void inline_vector_reboxing_calls();
@@ -228,6 +228,16 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = NULL;
         }
       }
+      if (receiver_method == NULL && speculative_receiver_type == NULL &&
+          !have_major_receiver && UsePolymorphicInlining && profile.has_receiver(2)) {
+        // No single receiver dominates, but a few may still carry most of
+        // the calls.
+        CallGenerator* cg = polymorphic_call_generator(callee, vtable_index, jvms,
+                                                       allow_inline, prof_factor, profile);
+        if (cg != NULL) {
+          return cg;
+        }
+      }
       if (receiver_method == NULL &&
           (have_major_receiver || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
@@ -378,6 +388,62 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   }
 }
 
+CallGenerator* Compile::polymorphic_call_generator(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                                   bool allow_inline, float prof_factor,
+                                                   ciCallProfile& profile) {
+  // Only receivers that carry enough of the calls and whose target can be
+  // inlined are worth a type check; the rest go through the virtual call.
+  // The receivers are ordered by decreasing call count.
+  CallGenerator* hit_cgs[ciCallProfile::MorphismLimit];
+  ciMethod* receiver_methods[ciCallProfile::MorphismLimit];
+  int receivers[ciCallProfile::MorphismLimit];
+  int num_hits = 0;
+  for (int i = 0; i < ciCallProfile::MorphismLimit && profile.has_receiver(i); i++) {
+    if (100.0 * profile.receiver_prob(i) < (double)PolymorphicInliningMinPercent) {
+      break;
+    }
+    ciMethod* receiver_method = callee->resolve_invoke(jvms->method()->holder(),
+                                                       profile.receiver(i));
+    if (receiver_method == NULL) {
+      continue;
+    }
+    CallGenerator* hit_cg = call_generator(receiver_method, vtable_index, false /* call_does_dispatch */,
+                                           jvms, allow_inline, prof_factor);
+    if (hit_cg == NULL || !hit_cg->is_inline()) {
+      continue;
+    }
+    hit_cgs[num_hits] = hit_cg;
+    receiver_methods[num_hits] = receiver_method;
+    receivers[num_hits] = i;
+    num_hits++;
+  }
+  // A single checked receiver is left to the major receiver heuristics.
+  if (num_hits < 2) {
+    return NULL;
+  }
+
+  CallGenerator* miss_cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                                     : CallGenerator::for_virtual_call(callee, vtable_index));
+  // Build the type checks from the least frequent receiver outwards; the
+  // probability of each check is conditional on the earlier ones failing.
+  float earlier_prob = 0.0f;
+  for (int i = 0; i < num_hits - 1; i++) {
+    earlier_prob += profile.receiver_prob(receivers[i]);
+  }
+  for (int i = num_hits - 1; i >= 0 && miss_cg != NULL; i--) {
+    int r = receivers[i];
+    trace_type_profile(this, jvms->method(), jvms->depth() - 1, jvms->bci(), receiver_methods[i],
+                       profile.receiver(r), profile.count(), profile.receiver_count(r));
+    float remaining_prob = MAX2(1.0f - earlier_prob, profile.receiver_prob(r));
+    float hit_prob = MIN2(profile.receiver_prob(r) / remaining_prob, PROB_MAX);
+    miss_cg = CallGenerator::for_predicted_call(profile.receiver(r), miss_cg, hit_cgs[i], hit_prob);
+    if (i > 0) {
+      earlier_prob -= profile.receiver_prob(receivers[i - 1]);
+    }
+  }
+  return miss_cg;
+}
+
 // Return true for methods that shouldn't be inlined early so that
 // they are easier to analyze and optimize as intrinsics.
 bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms) {
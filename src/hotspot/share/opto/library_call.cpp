@@ -143,6 +143,12 @@ JVMState* LibraryIntrinsic::generate(JVMState* jvms) {
       msg = is_virtual() ? "failed to inline (intrinsic, virtual), method not annotated"
                          : "failed to inline (intrinsic), method not annotated";
     }
+    ResourceMark rm;
+    if (kit.failure_reason() != NULL) {
+      stringStream reason_stream;
+      reason_stream.print("%s: %s", msg, kit.failure_reason());
+      msg = reason_stream.as_string();
+    }
     CompileTask::print_inlining_ul(callee, jvms->depth() - 1, bci, msg);
     if (C->print_intrinsics() || C->print_inlining()) {
       C->print_inlining(callee, jvms->depth() - 1, bci, msg);
@@ -156,10 +162,18 @@ JVMState* LibraryIntrinsic::generate(JVMState* jvms) {
                      is_virtual() ? " (virtual)" : "", bci);
     const char *msg = msg_stream.as_string();
     log_debug(jit, inlining)("%s", msg);
+    if (kit.failure_reason() != NULL) {
+      log_debug(jit, inlining)("  reason: %s", kit.failure_reason());
+    }
     if (C->print_intrinsics() || C->print_inlining()) {
       tty->print("%s", msg);
     }
   }
+  if (C->log() && kit.failure_reason() != NULL) {
+    C->log()->begin_elem("intrinsic_failed id='%s' reason='", vmIntrinsics::name_at(intrinsic_id()));
+    C->log()->text("%s", kit.failure_reason());
+    C->log()->end_elem("'");
+  }
   C->gather_intrinsic_statistics(intrinsic_id(), is_virtual(), Compile::_intrinsic_failed);
   C->print_inlining_update(this);
 
@@ -68,6 +68,7 @@ class LibraryCallKit : public GraphKit {
   LibraryIntrinsic* _intrinsic;     // the library intrinsic being called
   Node*             _result;        // the result node, if any
   int               _reexecute_sp;  // the stack pointer when bytecode needs to be reexecuted
+  const char*       _failure_reason; // why the intrinsic was not generated, if known
 
   const TypeOopPtr* sharpen_unsafe_type(Compile::AliasType* alias_type, const TypePtr *adr_type);
 
@@ -75,7 +76,8 @@ class LibraryCallKit : public GraphKit {
   LibraryCallKit(JVMState* jvms, LibraryIntrinsic* intrinsic)
     : GraphKit(jvms),
       _intrinsic(intrinsic),
-      _result(NULL)
+      _result(NULL),
+      _failure_reason(NULL)
   {
     // Check if this is a root compile.  In that case we don't have a caller.
     if (!jvms->has_method()) {
@@ -100,6 +102,8 @@ class LibraryCallKit : public GraphKit {
   vmIntrinsics::ID  intrinsic_id() const { return _intrinsic->intrinsic_id(); }
   ciMethod*         callee()    const    { return _intrinsic->method(); }
 
+  const char* failure_reason() const    { return _failure_reason; }
+
   bool  try_to_inline(int predicate);
   Node* try_to_predicate(int predicate);
 
@@ -327,6 +331,8 @@ class LibraryCallKit : public GraphKit {
   bool inline_continuation_do_yield();
 
   // Vector API support
+  void log_if_needed(const char* format, ...) ATTRIBUTE_PRINTF(2, 3);
+  void log_failure(const char* format, ...) ATTRIBUTE_PRINTF(2, 3);
   bool inline_vector_nary_operation(int n);
   bool inline_vector_frombits_coerced();
   bool inline_vector_shuffle_to_vector();
@@ -47,6 +47,7 @@
 #include "opto/phaseX.hpp"
 #include "opto/regmask.hpp"
 #include "opto/rootnode.hpp"
+#include "opto/subnode.hpp"
 #include "opto/vectornode.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
@@ -2743,9 +2744,214 @@ Node *StoreNode::Ideal(PhaseGVN *phase, bool can_reshape) {
     }
   }
 
+  // Merge with an adjacent store of the other half of a wider value.
+  // Wait until loop opts are over, so that SuperWord sees the original
+  // stores and range check smearing has put the stores under one control.
+  if (MergeStores && can_reshape &&
+      (Opcode() == Op_StoreB || Opcode() == Op_StoreC || Opcode() == Op_StoreI)) {
+    if (phase->C->post_loop_opts_phase()) {
+      Node* merged = Ideal_merge_adjacent_store(phase);
+      if (merged != NULL) {
+        return merged;
+      }
+    } else {
+      phase->C->record_for_post_loop_opts_igvn(this);
+    }
+  }
+
   return NULL;                  // No further progress
 }
 
+// The bits of a value written by a store: the store writes bits
+// [shift, shift + store size) of base, in little-endian byte order or, if
+// reversed, in big-endian byte order.
+class StoredBits : public StackObj {
+ public:
+  Node* _value;      // the stored value without the ReverseBytes
+  Node* _wide_value; // _value without the ConvL2I
+  Node* _base;
+  jint  _shift;
+  bool  _reversed;
+  int   _width;      // size of base in bits
+
+  StoredBits(PhaseGVN* phase, Node* n, int store_opcode) {
+    // Only a reversal of exactly the stored bytes changes their order.
+    _reversed = (store_opcode == Op_StoreC && n->Opcode() == Op_ReverseBytesUS) ||
+                (store_opcode == Op_StoreI && n->Opcode() == Op_ReverseBytesI);
+    if (_reversed) {
+      n = n->in(1);
+    }
+    _value = n;
+    bool is_long = (n->Opcode() == Op_ConvL2I);
+    if (is_long) {
+      n = n->in(1);
+    }
+    _wide_value = n;
+    _width = is_long ? BitsPerLong : BitsPerInt;
+    _base = n;
+    _shift = 0;
+    int op = n->Opcode();
+    bool is_shift = is_long ? (op == Op_RShiftL || op == Op_URShiftL)
+                            : (op == Op_RShiftI || op == Op_URShiftI);
+    if (is_shift) {
+      jint con = phase->find_int_con(n->in(2), -1);
+      if (con > 0 && con < _width) {
+        _base = n->in(1);
+        _shift = con;
+      }
+    }
+  }
+};
+
+//------------------------------Ideal_merge_adjacent_store---------------------
+// Merge this store and the store it directly follows in the memory chain
+// into a single store of twice the size, if they store to adjacent array
+// elements under the same control and the stored values are two constants
+// or adjacent parts of the same value, in either byte order:
+//
+//   (StoreB (StoreB mem (AddP base adr off) x) (AddP base adr off+1) (RShiftI x 8))
+//     => (StoreC mem (AddP base adr off) x)
+//
+//   (StoreB (StoreB mem (AddP base adr off) (RShiftI x 8)) (AddP base adr off+1) x)
+//     => (StoreC mem (AddP base adr off) (ReverseBytesUS x))
+//
+// The parts of a long are matched through their ConvL2I, as in
+// (ConvL2I (RShiftL x 8)).  Applied repeatedly, this turns the byte-wise
+// stores of an int or long into a single StoreI or StoreL.  The merged store
+// is a mismatched access, so loads of the original sizes do not pick up its
+// value.
+Node* StoreNode::Ideal_merge_adjacent_store(PhaseGVN* phase) {
+#ifdef VM_LITTLE_ENDIAN
+  if (!UseUnalignedAccesses) {
+    return NULL;
+  }
+  BasicType merged_bt;
+  switch (Opcode()) {
+  case Op_StoreB: merged_bt = T_CHAR; break;
+  case Op_StoreC: merged_bt = T_INT;  break;
+#ifdef _LP64
+  case Op_StoreI: merged_bt = T_LONG; break;
+#endif
+  default:
+    return NULL;
+  }
+
+  // The previous store must be of the same kind and only feed this one,
+  // so that no other memory user can observe it on its own.
+  Node* mem = in(MemNode::Memory);
+  if (mem->Opcode() != Opcode() || mem->outcnt() != 1 || mem->in(0) != in(0)) {
+    return NULL;
+  }
+  StoreNode* prev = mem->as_Store();
+  if (!is_unordered() || !prev->is_unordered()) {
+    return NULL;
+  }
+  const TypePtr* at = adr_type();
+  if (at == NULL || at->isa_aryptr() == NULL ||
+      phase->C->get_alias_index(at) != phase->C->get_alias_index(prev->adr_type())) {
+    return NULL;
+  }
+
+  // Both addresses must differ only in their constant offsets.
+  Node* adr = in(MemNode::Address);
+  Node* prev_adr = prev->in(MemNode::Address);
+  if (!adr->is_AddP() || !prev_adr->is_AddP() ||
+      adr->in(AddPNode::Base) != prev_adr->in(AddPNode::Base) ||
+      adr->in(AddPNode::Address) != prev_adr->in(AddPNode::Address)) {
+    return NULL;
+  }
+  const intptr_t unknown = min_intx;
+  intptr_t off = phase->find_intptr_t_con(adr->in(AddPNode::Offset), unknown);
+  intptr_t prev_off = phase->find_intptr_t_con(prev_adr->in(AddPNode::Offset), unknown);
+  if (off == unknown || prev_off == unknown) {
+    return NULL;
+  }
+  int size = memory_size();
+  StoreNode* lo;
+  StoreNode* hi;
+  intptr_t lo_off;
+  if (off == prev_off + size) {
+    lo = prev;
+    hi = this;
+    lo_off = prev_off;
+  } else if (prev_off == off + size) {
+    lo = this;
+    hi = prev;
+    lo_off = off;
+  } else {
+    return NULL;
+  }
+
+  bool is_long = (merged_bt == T_LONG);
+  int bits = size * BitsPerByte;
+  Node* lo_val = lo->in(MemNode::ValueIn);
+  Node* hi_val = hi->in(MemNode::ValueIn);
+  Node* merged_val = NULL;
+  const jint unknown_con = min_jint;
+  jint lo_con = phase->find_int_con(lo_val, unknown_con);
+  jint hi_con = phase->find_int_con(hi_val, unknown_con);
+  if (lo_con != unknown_con && hi_con != unknown_con) {
+    // Pair up constant stores at offsets aligned to the merged size, so
+    // that longer runs merge all the way up.
+    if (lo_off % (2 * size) != 0) {
+      return NULL;
+    }
+    julong mask = right_n_bits(bits);
+    julong merged = ((julong)lo_con & mask) | (((julong)hi_con & mask) << bits);
+    merged_val = is_long ? (Node*)phase->longcon((jlong)merged)
+                         : (Node*)phase->intcon((jint)merged);
+  } else {
+    StoredBits lo_bits(phase, lo_val, Opcode());
+    StoredBits hi_bits(phase, hi_val, Opcode());
+    if (lo_bits._base != hi_bits._base) {
+      return NULL;
+    }
+    int width = lo_bits._width;
+    // Both halves must come from the bits of the same value, and the
+    // merged part must start at a multiple of its size, which also pairs
+    // up the parts of longer runs so that they merge all the way up.
+    if (!lo_bits._reversed && !hi_bits._reversed &&
+        hi_bits._shift == lo_bits._shift + bits &&
+        lo_bits._shift % (2 * bits) == 0 &&
+        lo_bits._shift + 2 * bits <= width) {
+      // Little-endian: the merged store truncates the low half's value to
+      // its own size.
+      merged_val = is_long ? lo_bits._wide_value : lo_bits._value;
+    } else if (lo_bits._reversed == hi_bits._reversed &&
+               (size == 1 || lo_bits._reversed) &&
+               lo_bits._shift == hi_bits._shift + bits &&
+               hi_bits._shift % (2 * bits) == 0 &&
+               hi_bits._shift + 2 * bits <= width) {
+      // Big-endian: the lower address holds the upper part, so store the
+      // bytes of the part at the higher address in reverse order.
+      Node* val = is_long ? hi_bits._wide_value : hi_bits._value;
+      int rev_opc = is_long ? Op_ReverseBytesL :
+                    (merged_bt == T_INT ? Op_ReverseBytesI : Op_ReverseBytesUS);
+      if (!Matcher::match_rule_supported(rev_opc)) {
+        return NULL;
+      }
+      Node* rev;
+      switch (rev_opc) {
+      case Op_ReverseBytesL:  rev = new ReverseBytesLNode(NULL, val);  break;
+      case Op_ReverseBytesI:  rev = new ReverseBytesINode(NULL, val);  break;
+      default:                rev = new ReverseBytesUSNode(NULL, val); break;
+      }
+      merged_val = phase->transform(rev);
+    } else {
+      return NULL;
+    }
+  }
+
+  StoreNode* st = StoreNode::make(*phase, in(0), prev->in(MemNode::Memory),
+                                  lo->in(MemNode::Address), at, merged_val,
+                                  merged_bt, MemNode::unordered);
+  st->set_mismatched_access();
+  return st;
+#else
+  return NULL;
+#endif // VM_LITTLE_ENDIAN
+}
+
 //------------------------------Value-----------------------------------------
 const Type* StoreNode::Value(PhaseGVN* phase) const {
   // Either input is TOP ==> the result is TOP
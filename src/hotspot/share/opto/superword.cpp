@@ -2398,8 +2398,12 @@ bool SuperWord::output() {
   if (cl->is_main_loop()) {
     // MUST ENSURE main loop's initial value is properly aligned:
     //  (iv_initial_value + min_iv_offset) % vector_width_in_bytes() == 0
-
-    align_initial_loop_index(align_to_ref());
+    // unless the platform supports misaligned vector accesses and we were
+    // asked not to spend up to a full vector of scalar pre-loop iterations
+    // on alignment, which dominates for short trip counts.
+    if (AlignVector || SuperWordPreLoopAlignment) {
+      align_initial_loop_index(align_to_ref());
+    }
 
     // Insert extract (unpack) operations for scalar uses
     for (int i = 0; i < _packset.length(); i++) {
@@ -67,6 +67,41 @@ static bool is_vector_shuffle(ciKlass* klass) {
   return klass->is_subclass_of(ciEnv::current()->vector_VectorShuffle_klass());
 }
 
+// Print a diagnostic when -XX:+PrintIntrinsics is on. Used both for checks
+// that reject the intrinsic and for probes with a fallback.
+void LibraryCallKit::log_if_needed(const char* format, ...) {
+  if (C->print_intrinsics()) {
+    va_list ap;
+    va_start(ap, format);
+    tty->vprint_cr(format, ap);
+    va_end(ap);
+  }
+}
+
+// Like log_if_needed, but for a check that makes the intrinsic fail. The
+// message is kept so that it can be reported with the inlining decision
+// (-Xlog:jit+inlining=debug) and in the compile log.
+void LibraryCallKit::log_failure(const char* format, ...) {
+  ResourceMark rm;
+  stringStream ss;
+  va_list ap;
+  va_start(ap, format);
+  ss.vprint(format, ap);
+  va_end(ap);
+  const char* msg = ss.as_string();
+  if (C->print_intrinsics()) {
+    tty->print_cr("%s", msg);
+  }
+  // Drop the "  ** " prefix used to indent the PrintIntrinsics output.
+  while (*msg == ' ' || *msg == '*') {
+    msg++;
+  }
+  size_t len = strlen(msg);
+  char* reason = NEW_ARENA_ARRAY(C->comp_arena(), char, len + 1);
+  memcpy(reason, msg, len + 1);
+  _failure_reason = reason;
+}
+
 bool LibraryCallKit::arch_supports_vector_rotate(int opc, int num_elem, BasicType elem_bt,
                                                  VectorMaskUseType mask_use_type, bool has_scalar_args) {
   bool is_supported = true;
@@ -83,12 +118,8 @@ bool LibraryCallKit::arch_supports_vector_rotate(int opc, int num_elem, BasicTyp
     // Check whether mask unboxing is supported.
     if ((mask_use_type & VecMaskUseLoad) != 0) {
       if (!Matcher::match_rule_supported_vector(Op_VectorLoadMask, num_elem, elem_bt)) {
-      #ifndef PRODUCT
-        if (C->print_intrinsics()) {
-          tty->print_cr("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
-                        NodeClassNames[Op_VectorLoadMask], type2name(elem_bt), num_elem);
-        }
-      #endif
+        log_if_needed("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
+                      NodeClassNames[Op_VectorLoadMask], type2name(elem_bt), num_elem);
         return false;
       }
     }
@@ -96,12 +127,8 @@ bool LibraryCallKit::arch_supports_vector_rotate(int opc, int num_elem, BasicTyp
     if ((mask_use_type & VecMaskUsePred) != 0) {
       if (!Matcher::has_predicated_vectors() ||
           !Matcher::match_rule_supported_vector_masked(opc, num_elem, elem_bt)) {
-      #ifndef PRODUCT
-        if (C->print_intrinsics()) {
-          tty->print_cr("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
-                        NodeClassNames[opc], type2name(elem_bt), num_elem);
-        }
-      #endif
+        log_if_needed("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
+                      NodeClassNames[opc], type2name(elem_bt), num_elem);
         return false;
       }
     }
@@ -184,43 +211,27 @@ Node* GraphKit::vector_shift_count(Node* cnt, int shift_op, BasicType bt, int nu
 bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type, VectorMaskUseType mask_use_type, bool has_scalar_args) {
   // Check that the operation is valid.
   if (sopc <= 0) {
-#ifndef PRODUCT
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** Rejected intrinsification because no valid vector op could be extracted");
-    }
-#endif
+    log_if_needed("  ** Rejected intrinsification because no valid vector op could be extracted");
     return false;
   }
 
   if (VectorNode::is_vector_rotate(sopc)) {
     if(!arch_supports_vector_rotate(sopc, num_elem, type, mask_use_type, has_scalar_args)) {
-#ifndef PRODUCT
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** Rejected vector op (%s,%s,%d) because architecture does not support variable vector shifts",
-                      NodeClassNames[sopc], type2name(type), num_elem);
-      }
-#endif
+      log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support variable vector shifts",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
   } else if (VectorNode::is_vector_integral_negate(sopc)) {
     if (!VectorNode::is_vector_integral_negate_supported(sopc, num_elem, type, false)) {
-#ifndef PRODUCT
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** Rejected vector op (%s,%s,%d) because architecture does not support integral vector negate",
-                      NodeClassNames[sopc], type2name(type), num_elem);
-      }
-#endif
+      log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support integral vector negate",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
   } else {
     // Check that architecture supports this op-size-type combination.
     if (!Matcher::match_rule_supported_vector(sopc, num_elem, type)) {
-#ifndef PRODUCT
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** Rejected vector op (%s,%s,%d) because architecture does not support it",
-                      NodeClassNames[sopc], type2name(type), num_elem);
-      }
-#endif
+      log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     } else {
       assert(Matcher::match_rule_supported(sopc), "must be supported");
@@ -229,23 +240,15 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
 
   if (num_elem == 1) {
     if (mask_use_type != VecMaskNotUsed) {
-#ifndef PRODUCT
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** Rejected vector mask op (%s,%s,%d) because architecture does not support it",
-                      NodeClassNames[sopc], type2name(type), num_elem);
-      }
-#endif
+      log_if_needed("  ** Rejected vector mask op (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
 
     if (sopc != 0) {
       if (sopc != Op_LoadVector && sopc != Op_StoreVector) {
-#ifndef PRODUCT
-        if (C->print_intrinsics()) {
-          tty->print_cr("  ** Not a svml call or load/store vector op (%s,%s,%d)",
-                        NodeClassNames[sopc], type2name(type), num_elem);
-        }
-#endif
+        log_if_needed("  ** Not a svml call or load/store vector op (%s,%s,%d)",
+                      NodeClassNames[sopc], type2name(type), num_elem);
         return false;
       }
     }
@@ -253,22 +256,16 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
 
   if (!has_scalar_args && VectorNode::is_vector_shift(sopc) &&
       Matcher::supports_vector_variable_shifts() == false) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** Rejected vector op (%s,%s,%d) because architecture does not support variable vector shifts",
-                    NodeClassNames[sopc], type2name(type), num_elem);
-    }
+    log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support variable vector shifts",
+                  NodeClassNames[sopc], type2name(type), num_elem);
     return false;
   }
 
   // Check whether mask unboxing is supported.
   if ((mask_use_type & VecMaskUseLoad) != 0) {
     if (!Matcher::match_rule_supported_vector(Op_VectorLoadMask, num_elem, type)) {
-    #ifndef PRODUCT
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
-                      NodeClassNames[Op_VectorLoadMask], type2name(type), num_elem);
-      }
-    #endif
+      log_if_needed("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[Op_VectorLoadMask], type2name(type), num_elem);
       return false;
     }
   }
@@ -276,12 +273,8 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
   // Check whether mask boxing is supported.
   if ((mask_use_type & VecMaskUseStore) != 0) {
     if (!Matcher::match_rule_supported_vector(Op_VectorStoreMask, num_elem, type)) {
-    #ifndef PRODUCT
-      if (C->print_intrinsics()) {
-        tty->print_cr("Rejected vector mask storing (%s,%s,%d) because architecture does not support it",
-                      NodeClassNames[Op_VectorStoreMask], type2name(type), num_elem);
-      }
-    #endif
+      log_if_needed("Rejected vector mask storing (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[Op_VectorStoreMask], type2name(type), num_elem);
       return false;
     }
   }
@@ -297,12 +290,8 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
     }
 
     if (!is_supported) {
-    #ifndef PRODUCT
-      if (C->print_intrinsics()) {
-        tty->print_cr("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
-                      NodeClassNames[sopc], type2name(type), num_elem);
-      }
-    #endif
+      log_if_needed("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
   }
@@ -352,27 +341,21 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
 
   if (opr == NULL || vector_klass == NULL || elem_klass == NULL || vlen == NULL ||
       !opr->is_con() || vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: opr=%s vclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: opr=%s vclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
 
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
@@ -382,23 +365,17 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
   bool is_masked_op = vmask_type != TypePtr::NULL_PTR;
   if (is_masked_op) {
     if (mask_klass == NULL || mask_klass->const_oop() == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** missing constant: maskclass=%s", NodeClassNames[argument(2)->Opcode()]);
-      }
+      log_failure("  ** missing constant: maskclass=%s", NodeClassNames[argument(2)->Opcode()]);
       return false; // not enough info for intrinsification
     }
 
     if (!is_klass_initialized(mask_klass)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** mask klass argument not initialized");
-      }
+      log_failure("  ** mask klass argument not initialized");
       return false;
     }
 
     if (vmask_type->maybe_null()) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** null mask values are not allowed for masked op");
-      }
+      log_failure("  ** null mask values are not allowed for masked op");
       return false;
     }
   }
@@ -408,17 +385,13 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
   int opc = VectorSupport::vop2ideal(opr->get_con(), elem_bt);
   int sopc = VectorNode::opcode(opc, elem_bt);
   if ((opc != Op_CallLeafVector) && (sopc == 0)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** operation not supported: opc=%s bt=%s", NodeClassNames[opc], type2name(elem_bt));
-    }
+    log_failure("  ** operation not supported: opc=%s bt=%s", NodeClassNames[opc], type2name(elem_bt));
     return false; // operation not supported
   }
   if (num_elem == 1) {
     if (opc != Op_CallLeafVector || elem_bt != T_DOUBLE) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not a svml call: arity=%d opc=%d vlen=%d etype=%s",
-                      n, opc, num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not a svml call: arity=%d opc=%d vlen=%d etype=%s",
+                  n, opc, num_elem, type2name(elem_bt));
       return false;
     }
   }
@@ -431,22 +404,16 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
 
   if (opc == Op_CallLeafVector) {
     if (!UseVectorStubs) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** vector stubs support is disabled");
-      }
+      log_failure("  ** vector stubs support is disabled");
       return false;
     }
     if (!Matcher::supports_vector_calling_convention()) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** no vector calling conventions supported");
-      }
+      log_failure("  ** no vector calling conventions supported");
       return false;
     }
     if (!Matcher::vector_size_supported(elem_bt, num_elem)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** vector size (vlen=%d, etype=%s) is not supported",
-                      num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** vector size (vlen=%d, etype=%s) is not supported",
+                  num_elem, type2name(elem_bt));
       return false;
     }
   }
@@ -455,21 +422,17 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
   VectorMaskUseType mask_use_type = is_vector_mask(vbox_klass) ? VecMaskUseAll
                                       : is_masked_op ? VecMaskUseLoad : VecMaskNotUsed;
   if ((sopc != 0) && !arch_supports_vector(sopc, num_elem, elem_bt, mask_use_type)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=%d opc=%d vlen=%d etype=%s ismask=%d is_masked_op=%d",
-                    n, sopc, num_elem, type2name(elem_bt),
-                    is_vector_mask(vbox_klass) ? 1 : 0, is_masked_op ? 1 : 0);
-    }
+    log_failure("  ** not supported: arity=%d opc=%d vlen=%d etype=%s ismask=%d is_masked_op=%d",
+                n, sopc, num_elem, type2name(elem_bt),
+                is_vector_mask(vbox_klass) ? 1 : 0, is_masked_op ? 1 : 0);
     return false; // not supported
   }
 
   // Return true if current platform has implemented the masked operation with predicate feature.
   bool use_predicate = is_masked_op && sopc != 0 && arch_supports_vector(sopc, num_elem, elem_bt, VecMaskUsePred);
   if (is_masked_op && !use_predicate && !arch_supports_vector(Op_VectorBlend, num_elem, elem_bt, VecMaskUseLoad)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=%d opc=%d vlen=%d etype=%s ismask=0 is_masked_op=1",
-                    n, sopc, num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=%d opc=%d vlen=%d etype=%s ismask=0 is_masked_op=1",
+                n, sopc, num_elem, type2name(elem_bt));
     return false;
   }
 
@@ -478,10 +441,8 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
     case 3: {
       opd3 = unbox_vector(argument(7), vbox_type, elem_bt, num_elem);
       if (opd3 == NULL) {
-        if (C->print_intrinsics()) {
-          tty->print_cr("  ** unbox failed v3=%s",
-                        NodeClassNames[argument(7)->Opcode()]);
-        }
+        log_failure("  ** unbox failed v3=%s",
+                    NodeClassNames[argument(7)->Opcode()]);
         return false;
       }
       // fall-through
@@ -489,10 +450,8 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
     case 2: {
       opd2 = unbox_vector(argument(6), vbox_type, elem_bt, num_elem);
       if (opd2 == NULL) {
-        if (C->print_intrinsics()) {
-          tty->print_cr("  ** unbox failed v2=%s",
-                        NodeClassNames[argument(6)->Opcode()]);
-        }
+        log_failure("  ** unbox failed v2=%s",
+                    NodeClassNames[argument(6)->Opcode()]);
         return false;
       }
       // fall-through
@@ -500,10 +459,8 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
     case 1: {
       opd1 = unbox_vector(argument(5), vbox_type, elem_bt, num_elem);
       if (opd1 == NULL) {
-        if (C->print_intrinsics()) {
-          tty->print_cr("  ** unbox failed v1=%s",
-                        NodeClassNames[argument(5)->Opcode()]);
-        }
+        log_failure("  ** unbox failed v1=%s",
+                    NodeClassNames[argument(5)->Opcode()]);
         return false;
       }
       break;
@@ -518,10 +475,8 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
     const TypeInstPtr* mbox_type = TypeInstPtr::make_exact(TypePtr::NotNull, mbox_klass);
     mask = unbox_vector(argument(n + 5), mbox_type, elem_bt, num_elem);
     if (mask == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** unbox failed mask=%s",
-                      NodeClassNames[argument(n + 5)->Opcode()]);
-      }
+      log_failure("  ** unbox failed mask=%s",
+                  NodeClassNames[argument(n + 5)->Opcode()]);
       return false;
     }
   }
@@ -531,12 +486,10 @@ bool LibraryCallKit::inline_vector_nary_operation(int n) {
     assert(UseVectorStubs, "sanity");
     operation = gen_call_to_svml(opr->get_con(), elem_bt, num_elem, opd1, opd2);
     if (operation == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** svml call failed for %s_%s_%d",
-                         (elem_bt == T_FLOAT)?"float":"double",
-                         VectorSupport::svmlname[opr->get_con() - VectorSupport::VECTOR_OP_SVML_START],
-                         num_elem * type2aelembytes(elem_bt));
-      }
+      log_failure("  ** svml call failed for %s_%s_%d",
+                     (elem_bt == T_FLOAT)?"float":"double",
+                     VectorSupport::svmlname[opr->get_con() - VectorSupport::VECTOR_OP_SVML_START],
+                     num_elem * type2aelembytes(elem_bt));
       return false;
      }
   } else {
@@ -594,9 +547,7 @@ bool LibraryCallKit::inline_vector_shuffle_iota() {
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(shuffle_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
@@ -685,9 +636,7 @@ bool LibraryCallKit::inline_vector_mask_operation() {
   }
 
   if (!is_klass_initialized(mask_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
@@ -696,19 +645,15 @@ bool LibraryCallKit::inline_vector_mask_operation() {
   BasicType elem_bt = elem_type->basic_type();
 
   if (!arch_supports_vector(Op_LoadVector, num_elem, T_BOOLEAN, VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s",
-                    Op_LoadVector, num_elem, type2name(T_BOOLEAN));
-    }
+    log_failure("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s",
+                Op_LoadVector, num_elem, type2name(T_BOOLEAN));
     return false; // not supported
   }
 
   int mopc = VectorSupport::vop2ideal(oper->get_con(), elem_bt);
   if (!arch_supports_vector(mopc, num_elem, elem_bt, VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s",
-                    mopc, num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s",
+                mopc, num_elem, type2name(elem_bt));
     return false; // not supported
   }
 
@@ -717,10 +662,8 @@ bool LibraryCallKit::inline_vector_mask_operation() {
   const TypeInstPtr* mask_box_type = TypeInstPtr::make_exact(TypePtr::NotNull, mbox_klass);
   Node* mask_vec = unbox_vector(mask, mask_box_type, elem_bt, num_elem, true);
   if (mask_vec == NULL) {
-    if (C->print_intrinsics()) {
-        tty->print_cr("  ** unbox failed mask=%s",
-                      NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** unbox failed mask=%s",
+                  NodeClassNames[argument(4)->Opcode()]);
     return false;
   }
 
@@ -759,9 +702,7 @@ bool LibraryCallKit::inline_vector_shuffle_to_vector() {
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(shuffle_klass) || !is_klass_initialized(vector_klass) ) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
@@ -776,10 +717,8 @@ bool LibraryCallKit::inline_vector_shuffle_to_vector() {
   int cast_vopc = VectorCastNode::opcode(T_BYTE); // from shuffle of type T_BYTE
   // Make sure that cast is implemented to particular type/size combination.
   if (!arch_supports_vector(cast_vopc, num_elem, elem_bt, VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s",
-        cast_vopc, num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s",
+    cast_vopc, num_elem, type2name(elem_bt));
     return false;
   }
 
@@ -823,27 +762,21 @@ bool LibraryCallKit::inline_vector_frombits_coerced() {
   if (vector_klass == NULL || elem_klass == NULL || vlen == NULL || mode == NULL ||
       bits_type == NULL || vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL ||
       !vlen->is_con() || !mode->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s etype=%s vlen=%s bitwise=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(5)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s etype=%s vlen=%s bitwise=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(5)->Opcode()]);
     return false; // not enough info for intrinsification
   }
 
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   BasicType elem_bt = elem_type->basic_type();
@@ -857,12 +790,10 @@ bool LibraryCallKit::inline_vector_frombits_coerced() {
   int opc = bcast_mode == VectorSupport::MODE_BITS_COERCED_LONG_TO_MASK ? Op_VectorLongToMask : VectorNode::replicate_opcode(elem_bt);
 
   if (!arch_supports_vector(opc, num_elem, elem_bt, checkFlags, true /*has_scalar_args*/)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=0 op=broadcast vlen=%d etype=%s ismask=%d bcast_mode=%d",
-                    num_elem, type2name(elem_bt),
-                    is_mask ? 1 : 0,
-                    bcast_mode);
-    }
+    log_failure("  ** not supported: arity=0 op=broadcast vlen=%d etype=%s ismask=%d bcast_mode=%d",
+                num_elem, type2name(elem_bt),
+                is_mask ? 1 : 0,
+                bcast_mode);
     return false; // not supported
   }
 
@@ -956,26 +887,20 @@ bool LibraryCallKit::inline_vector_mem_operation(bool is_store) {
 
   if (vector_klass == NULL || elem_klass == NULL || vlen == NULL ||
       vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   BasicType elem_bt = elem_type->basic_type();
@@ -983,11 +908,9 @@ bool LibraryCallKit::inline_vector_mem_operation(bool is_store) {
 
   // TODO When mask usage is supported, VecMaskNotUsed needs to be VecMaskUseLoad.
   if (!arch_supports_vector(is_store ? Op_StoreVector : Op_LoadVector, num_elem, elem_bt, VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s ismask=no",
-                    is_store, is_store ? "store" : "load",
-                    num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s ismask=no",
+                is_store, is_store ? "store" : "load",
+                num_elem, type2name(elem_bt));
     return false; // not supported
   }
 
@@ -1024,11 +947,9 @@ bool LibraryCallKit::inline_vector_mem_operation(bool is_store) {
   // Handle loading masks.
   // If there is no consistency between array and vector element types, it must be special byte array case or loading masks
   if (arr_type != NULL && !using_byte_array && !is_mask && !elem_consistent_with_arr(elem_bt, arr_type)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s atype=%s ismask=no",
-                    is_store, is_store ? "store" : "load",
-                    num_elem, type2name(elem_bt), type2name(arr_type->elem()->array_element_basic_type()));
-    }
+    log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s atype=%s ismask=no",
+                is_store, is_store ? "store" : "load",
+                num_elem, type2name(elem_bt), type2name(arr_type->elem()->array_element_basic_type()));
     set_map(old_map);
     set_sp(old_sp);
     return false;
@@ -1038,11 +959,9 @@ bool LibraryCallKit::inline_vector_mem_operation(bool is_store) {
     int byte_num_elem = num_elem * type2aelembytes(elem_bt);
     if (!arch_supports_vector(is_store ? Op_StoreVector : Op_LoadVector, byte_num_elem, T_BYTE, VecMaskNotUsed)
         || !arch_supports_vector(Op_VectorReinterpret, byte_num_elem, T_BYTE, VecMaskNotUsed)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d*8 etype=%s/8 ismask=no",
-                      is_store, is_store ? "store" : "load",
-                      byte_num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not supported: arity=%d op=%s vlen=%d*8 etype=%s/8 ismask=no",
+                  is_store, is_store ? "store" : "load",
+                  byte_num_elem, type2name(elem_bt));
       set_map(old_map);
       set_sp(old_sp);
       return false; // not supported
@@ -1050,11 +969,9 @@ bool LibraryCallKit::inline_vector_mem_operation(bool is_store) {
   }
   if (is_mask) {
     if (!arch_supports_vector(Op_LoadVector, num_elem, T_BOOLEAN, VecMaskNotUsed)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=%d op=%s/mask vlen=%d etype=bit ismask=no",
-                      is_store, is_store ? "store" : "load",
-                      num_elem);
-      }
+      log_failure("  ** not supported: arity=%d op=%s/mask vlen=%d etype=bit ismask=no",
+                  is_store, is_store ? "store" : "load",
+                  num_elem);
       set_map(old_map);
       set_sp(old_sp);
       return false; // not supported
@@ -1161,34 +1078,26 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
   if (vector_klass == NULL || mask_klass == NULL || elem_klass == NULL || vlen == NULL ||
       vector_klass->const_oop() == NULL || mask_klass->const_oop() == NULL ||
       elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s mclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s mclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
   if (!is_klass_initialized(mask_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** mask klass argument not initialized");
-    }
+    log_failure("  ** mask klass argument not initialized");
     return false;
   }
 
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
 
@@ -1210,11 +1119,9 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
   bool using_byte_array = arr_type != NULL && arr_type->elem()->array_element_basic_type() == T_BYTE && elem_bt != T_BYTE;
   // If there is no consistency between array and vector element types, it must be special byte array case
   if (arr_type != NULL && !using_byte_array && !elem_consistent_with_arr(elem_bt, arr_type)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s atype=%s",
-                    is_store, is_store ? "storeMasked" : "loadMasked",
-                    num_elem, type2name(elem_bt), type2name(arr_type->elem()->array_element_basic_type()));
-    }
+    log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s atype=%s",
+                is_store, is_store ? "storeMasked" : "loadMasked",
+                num_elem, type2name(elem_bt), type2name(arr_type->elem()->array_element_basic_type()));
     set_map(old_map);
     set_sp(old_sp);
     return false;
@@ -1228,10 +1135,8 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
   // Masked vector store operation needs the architecture predicate feature. We need to check
   // whether the predicated vector operation is supported by backend.
   if (is_store && !use_predicate) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: op=storeMasked vlen=%d etype=%s using_byte_array=%d",
-                    num_elem, type2name(elem_bt), using_byte_array ? 1 : 0);
-    }
+    log_failure("  ** not supported: op=storeMasked vlen=%d etype=%s using_byte_array=%d",
+                num_elem, type2name(elem_bt), using_byte_array ? 1 : 0);
     set_map(old_map);
     set_sp(old_sp);
     return false;
@@ -1241,10 +1146,8 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
   // the normal vector load and blend operations are supported by backend.
   if (!use_predicate && (!arch_supports_vector(Op_LoadVector, mem_num_elem, mem_elem_bt, VecMaskNotUsed) ||
       !arch_supports_vector(Op_VectorBlend, mem_num_elem, mem_elem_bt, VecMaskUseLoad))) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: op=loadMasked vlen=%d etype=%s using_byte_array=%d",
-                    num_elem, type2name(elem_bt), using_byte_array ? 1 : 0);
-    }
+    log_failure("  ** not supported: op=loadMasked vlen=%d etype=%s using_byte_array=%d",
+                num_elem, type2name(elem_bt), using_byte_array ? 1 : 0);
     set_map(old_map);
     set_sp(old_sp);
     return false;
@@ -1254,11 +1157,9 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
   // with byte type is supported by backend.
   if (using_byte_array) {
     if (!arch_supports_vector(Op_VectorReinterpret, mem_num_elem, T_BYTE, VecMaskNotUsed)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s using_byte_array=1",
-                      is_store, is_store ? "storeMasked" : "loadMasked",
-                      num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s using_byte_array=1",
+                  is_store, is_store ? "storeMasked" : "loadMasked",
+                  num_elem, type2name(elem_bt));
       set_map(old_map);
       set_sp(old_sp);
       return false;
@@ -1268,11 +1169,9 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
   // Since it needs to unbox the mask, we need to double check that the related load operations
   // for mask are supported by backend.
   if (!arch_supports_vector(Op_LoadVector, num_elem, elem_bt, VecMaskUseLoad)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s",
-                      is_store, is_store ? "storeMasked" : "loadMasked",
-                      num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s",
+                  is_store, is_store ? "storeMasked" : "loadMasked",
+                  num_elem, type2name(elem_bt));
     set_map(old_map);
     set_sp(old_sp);
     return false;
@@ -1292,11 +1191,9 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
 
   Node* mask = unbox_vector(is_store ? argument(8) : argument(7), mbox_type, elem_bt, num_elem);
   if (mask == NULL) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** unbox failed mask=%s",
-                    is_store ? NodeClassNames[argument(8)->Opcode()]
-                             : NodeClassNames[argument(7)->Opcode()]);
-    }
+    log_failure("  ** unbox failed mask=%s",
+                is_store ? NodeClassNames[argument(8)->Opcode()]
+                         : NodeClassNames[argument(7)->Opcode()]);
     set_map(old_map);
     set_sp(old_sp);
     return false;
@@ -1305,10 +1202,8 @@ bool LibraryCallKit::inline_vector_mem_masked_operation(bool is_store) {
   if (is_store) {
     Node* val = unbox_vector(argument(7), vbox_type, elem_bt, num_elem);
     if (val == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** unbox failed vector=%s",
-                      NodeClassNames[argument(7)->Opcode()]);
-      }
+      log_failure("  ** unbox failed vector=%s",
+                  NodeClassNames[argument(7)->Opcode()]);
       set_map(old_map);
       set_sp(old_sp);
       return false; // operand unboxing failed
@@ -1400,28 +1295,22 @@ bool LibraryCallKit::inline_vector_gather_scatter(bool is_scatter) {
 
   if (vector_klass == NULL || elem_klass == NULL || vector_idx_klass == NULL || vlen == NULL ||
       vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || vector_idx_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s etype=%s vlen=%s viclass=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s etype=%s vlen=%s viclass=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
 
   if (!is_klass_initialized(vector_klass) || !is_klass_initialized(vector_idx_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
 
@@ -1432,55 +1321,43 @@ bool LibraryCallKit::inline_vector_gather_scatter(bool is_scatter) {
   bool is_masked_op = vmask_type != TypePtr::NULL_PTR;
   if (is_masked_op) {
     if (mask_klass == NULL || mask_klass->const_oop() == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** missing constant: maskclass=%s", NodeClassNames[argument(1)->Opcode()]);
-      }
+      log_failure("  ** missing constant: maskclass=%s", NodeClassNames[argument(1)->Opcode()]);
       return false; // not enough info for intrinsification
     }
 
     if (!is_klass_initialized(mask_klass)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** mask klass argument not initialized");
-      }
+      log_failure("  ** mask klass argument not initialized");
       return false;
     }
 
     if (vmask_type->maybe_null()) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** null mask values are not allowed for masked op");
-      }
+      log_failure("  ** null mask values are not allowed for masked op");
       return false;
     }
 
     // Check whether the predicated gather/scatter node is supported by architecture.
     if (!arch_supports_vector(is_scatter ? Op_StoreVectorScatterMasked : Op_LoadVectorGatherMasked, num_elem, elem_bt,
                               (VectorMaskUseType) (VecMaskUseLoad | VecMaskUsePred))) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s is_masked_op=1",
-                      is_scatter, is_scatter ? "scatterMasked" : "gatherMasked",
-                      num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s is_masked_op=1",
+                  is_scatter, is_scatter ? "scatterMasked" : "gatherMasked",
+                  num_elem, type2name(elem_bt));
       return false; // not supported
     }
   } else {
     // Check whether the normal gather/scatter node is supported for non-masked operation.
     if (!arch_supports_vector(is_scatter ? Op_StoreVectorScatter : Op_LoadVectorGather, num_elem, elem_bt, VecMaskNotUsed)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s is_masked_op=0",
-                      is_scatter, is_scatter ? "scatter" : "gather",
-                      num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s is_masked_op=0",
+                  is_scatter, is_scatter ? "scatter" : "gather",
+                  num_elem, type2name(elem_bt));
       return false; // not supported
     }
   }
 
   // Check that the vector holding indices is supported by architecture
   if (!arch_supports_vector(Op_LoadVector, num_elem, T_INT, VecMaskNotUsed)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=%d op=%s/loadindex vlen=%d etype=int is_masked_op=%d",
-                      is_scatter, is_scatter ? "scatter" : "gather",
-                      num_elem, is_masked_op ? 1 : 0);
-      }
+      log_failure("  ** not supported: arity=%d op=%s/loadindex vlen=%d etype=int is_masked_op=%d",
+                  is_scatter, is_scatter ? "scatter" : "gather",
+                  num_elem, is_masked_op ? 1 : 0);
       return false; // not supported
   }
 
@@ -1498,11 +1375,9 @@ bool LibraryCallKit::inline_vector_gather_scatter(bool is_scatter) {
 
   // The array must be consistent with vector type
   if (arr_type == NULL || (arr_type != NULL && !elem_consistent_with_arr(elem_bt, arr_type))) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=%d op=%s vlen=%d etype=%s atype=%s ismask=no",
-                    is_scatter, is_scatter ? "scatter" : "gather",
-                    num_elem, type2name(elem_bt), type2name(arr_type->elem()->array_element_basic_type()));
-    }
+    log_failure("  ** not supported: arity=%d op=%s vlen=%d etype=%s atype=%s ismask=no",
+                is_scatter, is_scatter ? "scatter" : "gather",
+                num_elem, type2name(elem_bt), type2name(arr_type->elem()->array_element_basic_type()));
     set_map(old_map);
     set_sp(old_sp);
     return false;
@@ -1531,11 +1406,9 @@ bool LibraryCallKit::inline_vector_gather_scatter(bool is_scatter) {
     const TypeInstPtr* mbox_type = TypeInstPtr::make_exact(TypePtr::NotNull, mbox_klass);
     mask = unbox_vector(is_scatter ? argument(10) : argument(9), mbox_type, elem_bt, num_elem);
     if (mask == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** unbox failed mask=%s",
-                    is_scatter ? NodeClassNames[argument(10)->Opcode()]
-                               : NodeClassNames[argument(9)->Opcode()]);
-      }
+      log_failure("  ** unbox failed mask=%s",
+                is_scatter ? NodeClassNames[argument(10)->Opcode()]
+                           : NodeClassNames[argument(9)->Opcode()]);
       set_map(old_map);
       set_sp(old_sp);
       return false;
@@ -1592,26 +1465,20 @@ bool LibraryCallKit::inline_vector_reduction() {
 
   if (opr == NULL || vector_klass == NULL || elem_klass == NULL || vlen == NULL ||
       !opr->is_con() || vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: opr=%s vclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: opr=%s vclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
 
@@ -1619,23 +1486,17 @@ bool LibraryCallKit::inline_vector_reduction() {
   bool is_masked_op = vmask_type != TypePtr::NULL_PTR;
   if (is_masked_op) {
     if (mask_klass == NULL || mask_klass->const_oop() == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** missing constant: maskclass=%s", NodeClassNames[argument(2)->Opcode()]);
-      }
+      log_failure("  ** missing constant: maskclass=%s", NodeClassNames[argument(2)->Opcode()]);
       return false; // not enough info for intrinsification
     }
 
     if (!is_klass_initialized(mask_klass)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** mask klass argument not initialized");
-      }
+      log_failure("  ** mask klass argument not initialized");
       return false;
     }
 
     if (vmask_type->maybe_null()) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** null mask values are not allowed for masked op");
-      }
+      log_failure("  ** null mask values are not allowed for masked op");
       return false;
     }
   }
@@ -1647,20 +1508,16 @@ bool LibraryCallKit::inline_vector_reduction() {
 
   // When using mask, mask use type needs to be VecMaskUseLoad.
   if (!arch_supports_vector(sopc, num_elem, elem_bt, is_masked_op ? VecMaskUseLoad : VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=%d/reduce vlen=%d etype=%s is_masked_op=%d",
-                    sopc, num_elem, type2name(elem_bt), is_masked_op ? 1 : 0);
-    }
+    log_failure("  ** not supported: arity=1 op=%d/reduce vlen=%d etype=%s is_masked_op=%d",
+                sopc, num_elem, type2name(elem_bt), is_masked_op ? 1 : 0);
     return false;
   }
 
   // Return true if current platform has implemented the masked operation with predicate feature.
   bool use_predicate = is_masked_op && arch_supports_vector(sopc, num_elem, elem_bt, VecMaskUsePred);
   if (is_masked_op && !use_predicate && !arch_supports_vector(Op_VectorBlend, num_elem, elem_bt, VecMaskUseLoad)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=%d/reduce vlen=%d etype=%s is_masked_op=1",
-                    sopc, num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=1 op=%d/reduce vlen=%d etype=%s is_masked_op=1",
+                sopc, num_elem, type2name(elem_bt));
     return false;
   }
 
@@ -1679,10 +1536,8 @@ bool LibraryCallKit::inline_vector_reduction() {
     const TypeInstPtr* mbox_type = TypeInstPtr::make_exact(TypePtr::NotNull, mbox_klass);
     mask = unbox_vector(argument(6), mbox_type, elem_bt, num_elem);
     if (mask == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** unbox failed mask=%s",
-                      NodeClassNames[argument(6)->Opcode()]);
-      }
+      log_failure("  ** unbox failed mask=%s",
+                  NodeClassNames[argument(6)->Opcode()]);
       return false;
     }
   }
@@ -1745,26 +1600,20 @@ bool LibraryCallKit::inline_vector_test() {
 
   if (cond == NULL || vector_klass == NULL || elem_klass == NULL || vlen == NULL ||
       !cond->is_con() || vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: cond=%s vclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()]);
-    }
+    log_failure("  ** missing constant: cond=%s vclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   BasicType elem_bt = elem_type->basic_type();
@@ -1774,11 +1623,9 @@ bool LibraryCallKit::inline_vector_test() {
   const TypeInstPtr* vbox_type = TypeInstPtr::make_exact(TypePtr::NotNull, vbox_klass);
 
   if (!arch_supports_vector(Op_VectorTest, num_elem, elem_bt, is_vector_mask(vbox_klass) ? VecMaskUseLoad : VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=2 op=test/%d vlen=%d etype=%s ismask=%d",
-                    cond->get_con(), num_elem, type2name(elem_bt),
-                    is_vector_mask(vbox_klass));
-    }
+    log_failure("  ** not supported: arity=2 op=test/%d vlen=%d etype=%s ismask=%d",
+                cond->get_con(), num_elem, type2name(elem_bt),
+                is_vector_mask(vbox_klass));
     return false;
   }
 
@@ -1813,26 +1660,20 @@ bool LibraryCallKit::inline_vector_blend() {
   }
   if (mask_klass->const_oop() == NULL || vector_klass->const_oop() == NULL ||
       elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s mclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s mclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass) || !is_klass_initialized(mask_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   BasicType elem_bt = elem_type->basic_type();
@@ -1840,10 +1681,8 @@ bool LibraryCallKit::inline_vector_blend() {
   int num_elem = vlen->get_con();
 
   if (!arch_supports_vector(Op_VectorBlend, num_elem, elem_bt, VecMaskUseLoad)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=2 op=blend vlen=%d etype=%s ismask=useload",
-                    num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=2 op=blend vlen=%d etype=%s ismask=useload",
+                num_elem, type2name(elem_bt));
     return false; // not supported
   }
   ciKlass* vbox_klass = vector_klass->const_oop()->as_instance()->java_lang_Class_klass();
@@ -1887,27 +1726,21 @@ bool LibraryCallKit::inline_vector_compare() {
   }
   if (!cond->is_con() || vector_klass->const_oop() == NULL || mask_klass->const_oop() == NULL ||
       elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: cond=%s vclass=%s mclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: cond=%s vclass=%s mclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass) || !is_klass_initialized(mask_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
 
@@ -1917,19 +1750,15 @@ bool LibraryCallKit::inline_vector_compare() {
 
   if ((cond->get_con() & BoolTest::unsigned_compare) != 0) {
     if (!Matcher::supports_vector_comparison_unsigned(num_elem, elem_bt)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: unsigned comparison op=comp/%d vlen=%d etype=%s ismask=usestore",
-                      cond->get_con() & (BoolTest::unsigned_compare - 1), num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not supported: unsigned comparison op=comp/%d vlen=%d etype=%s ismask=usestore",
+                  cond->get_con() & (BoolTest::unsigned_compare - 1), num_elem, type2name(elem_bt));
       return false;
     }
   }
 
   if (!arch_supports_vector(Op_VectorMaskCmp, num_elem, elem_bt, VecMaskUseStore)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=2 op=comp/%d vlen=%d etype=%s ismask=usestore",
-                    cond->get_con(), num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=2 op=comp/%d vlen=%d etype=%s ismask=usestore",
+                cond->get_con(), num_elem, type2name(elem_bt));
     return false;
   }
 
@@ -1945,19 +1774,15 @@ bool LibraryCallKit::inline_vector_compare() {
   bool is_masked_op = argument(7)->bottom_type() != TypePtr::NULL_PTR;
   Node* mask = is_masked_op ? unbox_vector(argument(7), mbox_type, elem_bt, num_elem) : NULL;
   if (is_masked_op && mask == NULL) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: mask = null arity=2 op=comp/%d vlen=%d etype=%s ismask=usestore is_masked_op=1",
-                    cond->get_con(), num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: mask = null arity=2 op=comp/%d vlen=%d etype=%s ismask=usestore is_masked_op=1",
+                cond->get_con(), num_elem, type2name(elem_bt));
     return false;
   }
 
   bool use_predicate = is_masked_op && arch_supports_vector(Op_VectorMaskCmp, num_elem, elem_bt, VecMaskUsePred);
   if (is_masked_op && !use_predicate && !arch_supports_vector(Op_AndV, num_elem, elem_bt, VecMaskUseLoad)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=2 op=comp/%d vlen=%d etype=%s ismask=usestore is_masked_op=1",
-                    cond->get_con(), num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=2 op=comp/%d vlen=%d etype=%s ismask=usestore is_masked_op=1",
+                cond->get_con(), num_elem, type2name(elem_bt));
     return false;
   }
 
@@ -2010,27 +1835,21 @@ bool LibraryCallKit::inline_vector_rearrange() {
       vector_klass->const_oop()  == NULL ||
       elem_klass->const_oop()    == NULL ||
       !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s sclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s sclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)  ||
       !is_klass_initialized(shuffle_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   BasicType elem_bt = elem_type->basic_type();
@@ -2038,10 +1857,8 @@ bool LibraryCallKit::inline_vector_rearrange() {
   int num_elem = vlen->get_con();
 
   if (!arch_supports_vector(Op_VectorLoadShuffle, num_elem, elem_bt, VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=0 op=load/shuffle vlen=%d etype=%s ismask=no",
-                    num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=0 op=load/shuffle vlen=%d etype=%s ismask=no",
+                num_elem, type2name(elem_bt));
     return false; // not supported
   }
 
@@ -2051,9 +1868,7 @@ bool LibraryCallKit::inline_vector_rearrange() {
       (mask_klass == NULL ||
        mask_klass->const_oop() == NULL ||
        !is_klass_initialized(mask_klass))) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** mask_klass argument not initialized");
-    }
+    log_if_needed("  ** mask_klass argument not initialized");
   }
   VectorMaskUseType checkFlags = (VectorMaskUseType)(is_masked_op ? (VecMaskUseLoad | VecMaskUsePred) : VecMaskNotUsed);
   if (!arch_supports_vector(Op_VectorRearrange, num_elem, elem_bt, checkFlags)) {
@@ -2062,10 +1877,8 @@ bool LibraryCallKit::inline_vector_rearrange() {
        (!arch_supports_vector(Op_VectorRearrange, num_elem, elem_bt, VecMaskNotUsed) ||
         !arch_supports_vector(Op_VectorBlend, num_elem, elem_bt, VecMaskUseLoad)     ||
         !arch_supports_vector(VectorNode::replicate_opcode(elem_bt), num_elem, elem_bt, VecMaskNotUsed))) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=2 op=shuffle/rearrange vlen=%d etype=%s ismask=no",
-                      num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not supported: arity=2 op=shuffle/rearrange vlen=%d etype=%s ismask=no",
+                  num_elem, type2name(elem_bt));
       return false; // not supported
     }
   }
@@ -2088,10 +1901,8 @@ bool LibraryCallKit::inline_vector_rearrange() {
     const TypeInstPtr* mbox_type = TypeInstPtr::make_exact(TypePtr::NotNull, mbox_klass);
     mask = unbox_vector(argument(7), mbox_type, elem_bt, num_elem);
     if (mask == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=3 op=shuffle/rearrange vlen=%d etype=%s ismask=useload is_masked_op=1",
-                      num_elem, type2name(elem_bt));
-      }
+      log_failure("  ** not supported: arity=3 op=shuffle/rearrange vlen=%d etype=%s ismask=useload is_masked_op=1",
+                  num_elem, type2name(elem_bt));
       return false;
     }
   }
@@ -2193,19 +2004,15 @@ bool LibraryCallKit::inline_vector_broadcast_int() {
     return false; // dead code
   }
   if (!opr->is_con() || vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || !vlen->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: opr=%s vclass=%s etype=%s vlen=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: opr=%s vclass=%s etype=%s vlen=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
@@ -2213,32 +2020,24 @@ bool LibraryCallKit::inline_vector_broadcast_int() {
   bool is_masked_op = vmask_type != TypePtr::NULL_PTR;
   if (is_masked_op) {
     if (mask_klass == NULL || mask_klass->const_oop() == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** missing constant: maskclass=%s", NodeClassNames[argument(2)->Opcode()]);
-      }
+      log_failure("  ** missing constant: maskclass=%s", NodeClassNames[argument(2)->Opcode()]);
       return false; // not enough info for intrinsification
     }
 
     if (!is_klass_initialized(mask_klass)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** mask klass argument not initialized");
-      }
+      log_failure("  ** mask klass argument not initialized");
       return false;
     }
 
     if (vmask_type->maybe_null()) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** null mask values are not allowed for masked op");
-      }
+      log_failure("  ** null mask values are not allowed for masked op");
       return false;
     }
   }
 
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
 
@@ -2250,17 +2049,13 @@ bool LibraryCallKit::inline_vector_broadcast_int() {
   bool is_rotate = VectorNode::is_rotate_opcode(opc);
 
   if (opc == 0 || (!is_shift && !is_rotate)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** operation not supported: op=%d bt=%s", opr->get_con(), type2name(elem_bt));
-    }
+    log_failure("  ** operation not supported: op=%d bt=%s", opr->get_con(), type2name(elem_bt));
     return false; // operation not supported
   }
 
   int sopc = VectorNode::opcode(opc, elem_bt);
   if (sopc == 0) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** operation not supported: opc=%s bt=%s", NodeClassNames[opc], type2name(elem_bt));
-    }
+    log_failure("  ** operation not supported: opc=%s bt=%s", NodeClassNames[opc], type2name(elem_bt));
     return false; // operation not supported
   }
 
@@ -2283,10 +2078,8 @@ bool LibraryCallKit::inline_vector_broadcast_int() {
         (!arch_supports_vector(sopc, num_elem, elem_bt, VecMaskNotUsed, has_scalar_args) ||
          !arch_supports_vector(Op_VectorBlend, num_elem, elem_bt, VecMaskUseLoad))) {
 
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=0 op=int/%d vlen=%d etype=%s is_masked_op=%d",
-                      sopc, num_elem, type2name(elem_bt), is_masked_op ? 1 : 0);
-      }
+      log_failure("  ** not supported: arity=0 op=int/%d vlen=%d etype=%s is_masked_op=%d",
+                  sopc, num_elem, type2name(elem_bt), is_masked_op ? 1 : 0);
       return false; // not supported
     }
   }
@@ -2317,9 +2110,7 @@ bool LibraryCallKit::inline_vector_broadcast_int() {
     const TypeInstPtr* mbox_type = TypeInstPtr::make_exact(TypePtr::NotNull, mbox_klass);
     mask = unbox_vector(argument(7), mbox_type, elem_bt, num_elem);
     if (mask == NULL) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** unbox failed mask=%s", NodeClassNames[argument(7)->Opcode()]);
-      }
+      log_failure("  ** unbox failed mask=%s", NodeClassNames[argument(7)->Opcode()]);
       return false;
     }
   }
@@ -2369,22 +2160,18 @@ bool LibraryCallKit::inline_vector_convert() {
   if (!opr->is_con() ||
       vector_klass_from->const_oop() == NULL || elem_klass_from->const_oop() == NULL || !vlen_from->is_con() ||
       vector_klass_to->const_oop() == NULL || elem_klass_to->const_oop() == NULL || !vlen_to->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: opr=%s vclass_from=%s etype_from=%s vlen_from=%s vclass_to=%s etype_to=%s vlen_to=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(3)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()],
-                    NodeClassNames[argument(5)->Opcode()],
-                    NodeClassNames[argument(6)->Opcode()]);
-    }
+    log_failure("  ** missing constant: opr=%s vclass_from=%s etype_from=%s vlen_from=%s vclass_to=%s etype_to=%s vlen_to=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(3)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()],
+                NodeClassNames[argument(5)->Opcode()],
+                NodeClassNames[argument(6)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass_from) || !is_klass_initialized(vector_klass_to)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
 
@@ -2421,11 +2208,9 @@ bool LibraryCallKit::inline_vector_convert() {
                             num_elem_from,
                             elem_bt_from,
                             is_mask ? VecMaskUseAll : VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=%s/1 vlen1=%d etype1=%s ismask=%d",
-                    is_cast ? "cast" : "reinterpret",
-                    num_elem_from, type2name(elem_bt_from), is_mask);
-    }
+    log_failure("  ** not supported: arity=1 op=%s/1 vlen1=%d etype1=%s ismask=%d",
+                is_cast ? "cast" : "reinterpret",
+                num_elem_from, type2name(elem_bt_from), is_mask);
     return false;
   }
 
@@ -2434,11 +2219,9 @@ bool LibraryCallKit::inline_vector_convert() {
                             num_elem_to,
                             elem_bt_to,
                             is_mask ? VecMaskUseAll : VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=%s/2 vlen2=%d etype2=%s ismask=%d",
-                    is_cast ? "cast" : "reinterpret",
-                    num_elem_to, type2name(elem_bt_to), is_mask);
-    }
+    log_failure("  ** not supported: arity=1 op=%s/2 vlen2=%d etype2=%s ismask=%d",
+                is_cast ? "cast" : "reinterpret",
+                num_elem_to, type2name(elem_bt_to), is_mask);
     return false;
   }
 
@@ -2480,11 +2263,9 @@ bool LibraryCallKit::inline_vector_convert() {
     int cast_vopc = VectorCastNode::opcode(new_elem_bt_from, !is_ucast);
     // Make sure that cast is implemented to particular type/size combination.
     if (!arch_supports_vector(cast_vopc, num_elem_to, elem_bt_to, VecMaskNotUsed)) {
-      if (C->print_intrinsics()) {
-        tty->print_cr("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s ismask=%d",
-                      cast_vopc,
-                      num_elem_to, type2name(elem_bt_to), is_mask);
-      }
+      log_failure("  ** not supported: arity=1 op=cast#%d/3 vlen2=%d etype2=%s ismask=%d",
+                  cast_vopc,
+                  num_elem_to, type2name(elem_bt_to), is_mask);
       return false;
     }
 
@@ -2496,11 +2277,9 @@ bool LibraryCallKit::inline_vector_convert() {
       // It is possible that arch does not support this intermediate vector size
       // TODO More complex logic required here to handle this corner case for the sizes.
       if (!arch_supports_vector(cast_vopc, num_elem_for_cast, elem_bt_to, VecMaskNotUsed)) {
-        if (C->print_intrinsics()) {
-          tty->print_cr("  ** not supported: arity=1 op=cast#%d/4 vlen1=%d etype2=%s ismask=%d",
-                        cast_vopc,
-                        num_elem_for_cast, type2name(elem_bt_to), is_mask);
-        }
+        log_failure("  ** not supported: arity=1 op=cast#%d/4 vlen1=%d etype2=%s ismask=%d",
+                    cast_vopc,
+                    num_elem_for_cast, type2name(elem_bt_to), is_mask);
         return false;
       }
 
@@ -2518,10 +2297,8 @@ bool LibraryCallKit::inline_vector_convert() {
                                 num_elem_for_resize,
                                 elem_bt_from,
                                 VecMaskNotUsed)) {
-        if (C->print_intrinsics()) {
-          tty->print_cr("  ** not supported: arity=1 op=cast/5 vlen2=%d etype1=%s ismask=%d",
-                        num_elem_for_resize, type2name(elem_bt_from), is_mask);
-        }
+        log_failure("  ** not supported: arity=1 op=cast/5 vlen2=%d etype1=%s ismask=%d",
+                    num_elem_for_resize, type2name(elem_bt_from), is_mask);
         return false;
       }
 
@@ -2572,35 +2349,27 @@ bool LibraryCallKit::inline_vector_insert() {
     return false; // dead code
   }
   if (vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || !vlen->is_con() || !idx->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s etype=%s vlen=%s idx=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s etype=%s vlen=%s idx=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   BasicType elem_bt = elem_type->basic_type();
   int num_elem = vlen->get_con();
   if (!arch_supports_vector(Op_VectorInsert, num_elem, elem_bt, VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=insert vlen=%d etype=%s ismask=no",
-                    num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=1 op=insert vlen=%d etype=%s ismask=no",
+                num_elem, type2name(elem_bt));
     return false; // not supported
   }
 
@@ -2665,36 +2434,28 @@ bool LibraryCallKit::inline_vector_extract() {
     return false; // dead code
   }
   if (vector_klass->const_oop() == NULL || elem_klass->const_oop() == NULL || !vlen->is_con() || !idx->is_con()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** missing constant: vclass=%s etype=%s vlen=%s idx=%s",
-                    NodeClassNames[argument(0)->Opcode()],
-                    NodeClassNames[argument(1)->Opcode()],
-                    NodeClassNames[argument(2)->Opcode()],
-                    NodeClassNames[argument(4)->Opcode()]);
-    }
+    log_failure("  ** missing constant: vclass=%s etype=%s vlen=%s idx=%s",
+                NodeClassNames[argument(0)->Opcode()],
+                NodeClassNames[argument(1)->Opcode()],
+                NodeClassNames[argument(2)->Opcode()],
+                NodeClassNames[argument(4)->Opcode()]);
     return false; // not enough info for intrinsification
   }
   if (!is_klass_initialized(vector_klass)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** klass argument not initialized");
-    }
+    log_failure("  ** klass argument not initialized");
     return false;
   }
   ciType* elem_type = elem_klass->const_oop()->as_instance()->java_mirror_type();
   if (!elem_type->is_primitive_type()) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not a primitive bt=%d", elem_type->basic_type());
-    }
+    log_failure("  ** not a primitive bt=%d", elem_type->basic_type());
     return false; // should be primitive type
   }
   BasicType elem_bt = elem_type->basic_type();
   int num_elem = vlen->get_con();
   int vopc = ExtractNode::opcode(elem_bt);
   if (!arch_supports_vector(vopc, num_elem, elem_bt, VecMaskNotUsed)) {
-    if (C->print_intrinsics()) {
-      tty->print_cr("  ** not supported: arity=1 op=extract vlen=%d etype=%s ismask=no",
-                    num_elem, type2name(elem_bt));
-    }
+    log_failure("  ** not supported: arity=1 op=extract vlen=%d etype=%s ismask=no",
+                num_elem, type2name(elem_bt));
     return false; // not supported
   }
 
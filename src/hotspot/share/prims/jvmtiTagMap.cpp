@@ -144,9 +144,18 @@ void JvmtiTagMap::check_hashmap(bool post_events) {
 
   if (is_empty()) { return; }
 
-  if (_needs_cleaning &&
-      post_events &&
-      env()->is_enabled(JVMTI_EVENT_OBJECT_FREE)) {
+  bool needs_posting = _needs_cleaning &&
+                       post_events &&
+                       env()->is_enabled(JVMTI_EVENT_OBJECT_FREE);
+  if (needs_posting && _needs_rehashing) {
+    // Both are needed after a GC that moved objects; do them in one pass.
+    log_info(jvmti, table)("TagMap table needs cleaning and posting and rehashing");
+    hashmap()->remove_dead_entries_and_rehash(env(), true /* post_object_free */);
+    _needs_cleaning = false;
+    _needs_rehashing = false;
+    return;
+  }
+  if (needs_posting) {
     remove_dead_entries_locked(true /* post_object_free */);
   }
   if (_needs_rehashing) {
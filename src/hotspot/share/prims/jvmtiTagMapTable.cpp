@@ -186,46 +186,13 @@ void JvmtiTagMapTable::resize_if_needed() {
   }
 }
 
-// Serially remove entries for dead oops from the table, and notify jvmti.
-void JvmtiTagMapTable::remove_dead_entries(JvmtiEnv* env, bool post_object_free) {
-  int oops_removed = 0;
-  int oops_counted = 0;
-  for (int i = 0; i < table_size(); ++i) {
-    JvmtiTagMapEntry** p = bucket_addr(i);
-    JvmtiTagMapEntry* entry = bucket(i);
-    while (entry != NULL) {
-      oops_counted++;
-      oop l = entry->object_no_keepalive();
-      if (l != NULL) {
-        p = entry->next_addr();
-      } else {
-        // Entry has been removed.
-        oops_removed++;
-        log_trace(jvmti, table)("JvmtiTagMap entry removed for index %d", i);
-        jlong tag = entry->tag();
-        *p = entry->next();
-        free_entry(entry);
-
-        // post the event to the profiler
-        if (post_object_free) {
-          JvmtiExport::post_object_free(env, tag);
-        }
-
-      }
-      // get next entry
-      entry = *p;
-    }
-  }
-
-  log_info(jvmti, table) ("JvmtiTagMap entries counted %d removed %d; %s",
-                          oops_counted, oops_removed, post_object_free ? "free object posted" : "no posting");
-}
-
-// Rehash oops in the table
-void JvmtiTagMapTable::rehash() {
+// Walk the table once, removing entries for dead oops (and notifying jvmti)
+// and/or re-inserting entries whose oop has moved, as requested.
+void JvmtiTagMapTable::clean_and_rehash(JvmtiEnv* env, bool remove_dead, bool post_object_free, bool rehash) {
   ResourceMark rm;
   GrowableArray<JvmtiTagMapEntry*> moved_entries;
 
+  int oops_removed = 0;
   int oops_counted = 0;
   for (int i = 0; i < table_size(); ++i) {
     JvmtiTagMapEntry** p = bucket_addr(i);
@@ -233,7 +200,24 @@ void JvmtiTagMapTable::rehash() {
     while (entry != NULL) {
       oops_counted++;
       oop l = entry->object_no_keepalive();
-      if (l != NULL) {
+      if (l == NULL) {
+        if (remove_dead) {
+          // Entry has been removed.
+          oops_removed++;
+          log_trace(jvmti, table)("JvmtiTagMap entry removed for index %d", i);
+          jlong tag = entry->tag();
+          *p = entry->next();
+          free_entry(entry);
+
+          // post the event to the profiler
+          if (post_object_free) {
+            JvmtiExport::post_object_free(env, tag);
+          }
+        } else {
+          // Skip removed oops. They may still have to be posted.
+          p = entry->next_addr();
+        }
+      } else if (rehash) {
         // Check if oop has moved, ie its hashcode is different
         // than the one entered in the table.
         unsigned int new_hash = compute_hash(l);
@@ -246,7 +230,6 @@ void JvmtiTagMapTable::rehash() {
           p = entry->next_addr();
         }
       } else {
-        // Skip removed oops. They may still have to be posted.
         p = entry->next_addr();
       }
       // get next entry
@@ -262,6 +245,27 @@ void JvmtiTagMapTable::rehash() {
     Hashtable<WeakHandle, mtServiceability>::add_entry(index, moved_entry);
   }
 
-  log_info(jvmti, table) ("JvmtiTagMap entries counted %d rehashed %d",
-                          oops_counted, rehash_len);
+  if (remove_dead) {
+    log_info(jvmti, table) ("JvmtiTagMap entries counted %d removed %d; %s",
+                            oops_counted, oops_removed, post_object_free ? "free object posted" : "no posting");
+  }
+  if (rehash) {
+    log_info(jvmti, table) ("JvmtiTagMap entries counted %d rehashed %d",
+                            oops_counted, rehash_len);
+  }
+}
+
+// Serially remove entries for dead oops from the table, and notify jvmti.
+void JvmtiTagMapTable::remove_dead_entries(JvmtiEnv* env, bool post_object_free) {
+  clean_and_rehash(env, true /* remove_dead */, post_object_free, false /* rehash */);
+}
+
+// Rehash oops in the table
+void JvmtiTagMapTable::rehash() {
+  clean_and_rehash(NULL, false /* remove_dead */, false /* post_object_free */, true /* rehash */);
+}
+
+// Remove dead entries and rehash moved ones in a single pass over the table.
+void JvmtiTagMapTable::remove_dead_entries_and_rehash(JvmtiEnv* env, bool post_object_free) {
+  clean_and_rehash(env, true /* remove_dead */, post_object_free, true /* rehash */);
 }
@@ -73,6 +73,8 @@ private:
 
   void resize_if_needed();
 
+  void clean_and_rehash(JvmtiEnv* env, bool remove_dead, bool post_object_free, bool rehash);
+
 public:
   JvmtiTagMapTable();
   ~JvmtiTagMapTable();
@@ -90,6 +92,7 @@ public:
   // Cleanup cleared entries and post
   void remove_dead_entries(JvmtiEnv* env, bool post_object_free);
   void rehash();
+  void remove_dead_entries_and_rehash(JvmtiEnv* env, bool post_object_free);
   void clear();
 };
 
@@ -64,6 +64,11 @@ JavaThread* ProgrammableUpcallHandler::maybe_attach_and_get_thread(bool* should_
   } else {
     *should_detach = false;
   }
+  // Downcalls that need no thread state transition (see
+  // NativeEntryPoint::need_transition) leave the thread _thread_in_Java.
+  // Such native functions must not call back into Java.
+  guarantee(thread->thread_state() == _thread_in_native,
+            "Upcall from a native function called without a thread state transition");
   return thread;
 }
 
@@ -35,6 +35,7 @@
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "metaprogramming/conditional.hpp"
@@ -46,18 +47,21 @@
 #include "runtime/arguments.hpp"
 #include "runtime/continuationEntry.inline.hpp"
 #include "runtime/continuationHelper.inline.hpp"
+#include "runtime/continuationStats.hpp"
 #include "runtime/continuationWrapper.inline.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/keepStackGCProcessed.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/prefetch.inline.hpp"
 #include "runtime/smallRegisterMap.inline.hpp"
 #include "runtime/stackChunkFrameStream.inline.hpp"
 #include "runtime/stackFrameStream.inline.hpp"
 #include "runtime/stackOverflow.hpp"
 #include "runtime/stackWatermarkSet.inline.hpp"
+#include "runtime/synchronizer.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/exceptions.hpp"
 #include "utilities/macros.hpp"
@@ -240,6 +244,93 @@ JVM_ENTRY(jint, CONT_isPinned0(JNIEnv* env, jobject cont_scope)) {
 }
 JVM_END
 
+// A single empty stack chunk is kept per carrier thread, so that a virtual thread
+// that yields right after its last chunk was emptied by a thaw (or that outgrew its
+// empty tail) does not need a fresh allocation. Only chunks that are not in GC mode
+// and do not require barriers are kept, as those are the chunks freeze would
+// otherwise have allocated.
+class StackChunkCache : AllStatic {
+  static PerfCounter* _hits;
+  static PerfCounter* _misses;
+  static PerfCounter* _bytes_saved;
+
+  static inline bool is_reusable(stackChunkOop chunk) {
+    return chunk->is_empty() && !chunk->is_gc_mode() && !chunk->has_bitmap() && !chunk->requires_barriers();
+  }
+
+public:
+  static void init();
+
+  // Returns a cached chunk with room for stack_size words, or nullptr.
+  // The chunk is removed from the cache and reset to the state of a freshly allocated one.
+  static stackChunkOop take(JavaThread* thread, size_t stack_size);
+
+  // Offers an empty chunk that is about to be dropped by its continuation.
+  static void put(JavaThread* thread, stackChunkOop chunk);
+};
+
+PerfCounter* StackChunkCache::_hits = nullptr;
+PerfCounter* StackChunkCache::_misses = nullptr;
+PerfCounter* StackChunkCache::_bytes_saved = nullptr;
+
+void StackChunkCache::init() {
+  if (UseStackChunkCache && UsePerfData) {
+    EXCEPTION_MARK;
+    _hits        = PerfDataManager::create_counter(SUN_RT, "contChunkCacheHits", PerfData::U_Events, CHECK);
+    _misses      = PerfDataManager::create_counter(SUN_RT, "contChunkCacheMisses", PerfData::U_Events, CHECK);
+    _bytes_saved = PerfDataManager::create_counter(SUN_RT, "contChunkCacheBytesSaved", PerfData::U_Bytes, CHECK);
+  }
+}
+
+stackChunkOop StackChunkCache::take(JavaThread* thread, size_t stack_size) {
+  assert(UseStackChunkCache, "");
+  oop obj = thread->cont_chunk_cache();
+  if (obj == nullptr) {
+    if (_misses != nullptr) _misses->inc();
+    return nullptr;
+  }
+  thread->set_cont_chunk_cache(nullptr);
+
+  stackChunkOop chunk = stackChunkOopDesc::cast(obj);
+  // The chunk may have been promoted or visited by the GC since it was cached.
+  // Don't take chunks that are much larger than needed, to not waste space.
+  if (!is_reusable(chunk) || (size_t)chunk->stack_size() < stack_size || (size_t)chunk->stack_size() > 2 * stack_size) {
+    log_develop_trace(continuations)("StackChunkCache::take: dropping chunk " INTPTR_FORMAT " stack_size: %d requested: " SIZE_FORMAT,
+                                     p2i((oopDesc*)chunk), chunk->stack_size(), stack_size);
+    if (_misses != nullptr) _misses->inc();
+    return nullptr;
+  }
+
+  chunk->set_sp(chunk->stack_size());
+  chunk->set_argsize(0);
+  chunk->set_max_size(0);
+  chunk->set_pc(nullptr);
+  chunk->set_flags(0);
+  chunk->set_locked_monitors(0);
+
+  log_develop_trace(continuations)("StackChunkCache::take: reusing chunk " INTPTR_FORMAT " stack_size: %d requested: " SIZE_FORMAT,
+                                   p2i((oopDesc*)chunk), chunk->stack_size(), stack_size);
+  if (_hits != nullptr) {
+    _hits->inc();
+    _bytes_saved->inc(chunk->size() * HeapWordSize);
+  }
+  return chunk;
+}
+
+void StackChunkCache::put(JavaThread* thread, stackChunkOop chunk) {
+  assert(UseStackChunkCache, "");
+  assert(chunk != nullptr, "");
+  if (!is_reusable(chunk)) {
+    return;
+  }
+  // Don't keep the old continuation and its chunks alive through the cache
+  chunk->set_parent(nullptr);
+  chunk->set_cont(nullptr);
+  thread->set_cont_chunk_cache(chunk);
+  log_develop_trace(continuations)("StackChunkCache::put: chunk " INTPTR_FORMAT " stack_size: %d",
+                                   p2i((oopDesc*)chunk), chunk->stack_size());
+}
+
 ///////////
 
 enum class oop_kind { NARROW, WIDE };
@@ -336,12 +427,18 @@ protected:
   CONT_JFR_ONLY(FreezeThawJfrInfo _jfr_info;)
   bool _barriers;
   const bool _preempt; // used only on the slow path
+  bool _slow_path; // for ContinuationStatistics
 
   intptr_t *_bottom_address;
 
   int _size; // total size of all frames plus metadata in words.
   int _align_size;
 
+  // Objects locked by the frames being frozen. Only non-null when those frames
+  // may be frozen while holding monitors (see YieldWithMonitors); otherwise
+  // owning a monitor pins the continuation.
+  GrowableArray<Handle>* _monitors;
+
   JvmtiSampledObjectAllocEventCollector* _jvmti_event_collector;
 
   NOT_PRODUCT(int _frames;)
@@ -351,6 +448,7 @@ protected:
 
 public:
   NOINLINE freeze_result freeze_slow();
+  bool took_slow_path() const { return _slow_path; }
 
   CONT_JFR_ONLY(FreezeThawJfrInfo& jfr_info() { return _jfr_info; })
   void set_jvmti_event_collector(JvmtiSampledObjectAllocEventCollector* jsoaec) { _jvmti_event_collector = jsoaec; }
@@ -385,6 +483,8 @@ private:
   NOINLINE void finish_freeze(const frame& f, const frame& top);
 
   inline bool stack_overflow();
+  inline bool can_transfer_monitors() const;
+  void transfer_monitors();
 
   static frame sender(const frame& f) { return f.is_interpreted_frame() ? sender<ContinuationHelper::InterpretedFrame>(f)
                                                                         : sender<ContinuationHelper::NonInterpretedUnknownFrame>(f); }
@@ -418,7 +518,7 @@ protected:
 };
 
 FreezeBase::FreezeBase(JavaThread* thread, ContinuationWrapper& cont, bool preempt) :
-    _thread(thread), _cont(cont), _barriers(false), _preempt(preempt) {
+    _thread(thread), _cont(cont), _barriers(false), _preempt(preempt), _slow_path(false), _monitors(nullptr) {
   DEBUG_ONLY(_jvmti_event_collector = nullptr;)
 
   assert(_thread != nullptr, "");
@@ -493,6 +593,17 @@ freeze_result Freeze<ConfigT>::try_freeze_fast(intptr_t* sp) {
 }
 
 // returns true iff there's room in the chunk for a fast, compiled-frame-only freeze
+// An empty chunk that is much larger than the frames frozen into it keeps the unused
+// space alive for as long as the continuation stays unmounted; when that happens a
+// right-sized chunk is allocated instead (see StackChunkMaxOversize).
+static inline bool is_oversized_for(stackChunkOop chunk, int size) {
+  const int min_waste = 512; // words; don't churn small chunks
+  return StackChunkMaxOversize > 0
+      && chunk->is_empty()
+      && chunk->stack_size() - size >= min_waste
+      && chunk->stack_size() / StackChunkMaxOversize > size;
+}
+
 template <typename ConfigT>
 bool Freeze<ConfigT>::is_chunk_available_for_fast_freeze(intptr_t* frame_sp
 #ifdef ASSERT
@@ -518,7 +629,7 @@ bool Freeze<ConfigT>::is_chunk_available_for_fast_freeze(intptr_t* frame_sp
   }
   assert(size > 0, "");
 
-  bool available = chunk_sp - frame::metadata_words >= size;
+  bool available = chunk_sp - frame::metadata_words >= size && !is_oversized_for(chunk, size);
   log_develop_trace(continuations)("chunk available: %d size: %d argsize: %d top: " INTPTR_FORMAT " bottom: " INTPTR_FORMAT,
     available, _cont.argsize(), size, p2i(stack_top), p2i(stack_bottom));
   DEBUG_ONLY(if (out_size != nullptr) *out_size = size;)
@@ -602,8 +713,9 @@ bool Freeze<ConfigT>::freeze_fast(intptr_t* frame_sp) {
 
     // in a fresh chunk, we freeze *with* the bottom-most frame's stack arguments.
     // They'll then be stored twice: in the chunk and in the parent chunk's top frame
-    chunk_start_sp = cont_size + frame::metadata_words;
-    assert(chunk_start_sp == chunk->stack_size(), "");
+    // A chunk taken from the StackChunkCache may be larger than requested.
+    chunk_start_sp = chunk->stack_size();
+    assert(chunk_start_sp == cont_size + frame::metadata_words || UseStackChunkCache, "");
 
     DEBUG_ONLY(CONT_JFR_ONLY(chunk_is_allocated = true;))
     DEBUG_ONLY(orig_chunk_sp = chunk->start_address() + chunk_start_sp;)
@@ -681,12 +793,17 @@ NOINLINE freeze_result FreezeBase::freeze_slow() {
 #endif
 
   log_develop_trace(continuations)("freeze_slow  #" INTPTR_FORMAT, _cont.hash());
+  _slow_path = true;
   assert(_thread->thread_state() == _thread_in_vm || _thread->thread_state() == _thread_blocked, "");
 
   init_rest();
 
   HandleMark hm(Thread::current());
 
+  if (UNLIKELY(_thread->held_monitor_count() > 0 && can_transfer_monitors())) {
+    _monitors = new (ResourceObj::C_HEAP, mtThread) GrowableArray<Handle>(4, mtThread);
+  }
+
   frame f = freeze_start_frame();
 
   LogTarget(Debug, continuations) lt;
@@ -700,12 +817,41 @@ NOINLINE freeze_result FreezeBase::freeze_slow() {
 
   if (res == freeze_ok) {
     finish_freeze(f, caller);
+    if (_monitors != nullptr) {
+      transfer_monitors();
+    }
+    // The carrier's held monitor count is saved in the chunk and restored on thaw,
+    // which sets it unconditionally
+    _cont.tail()->set_locked_monitors(_thread->held_monitor_count());
+    _thread->reset_held_monitor_count();
     _cont.write();
   }
 
+  if (_monitors != nullptr) {
+    delete _monitors;
+    _monitors = nullptr;
+  }
+
   return res;
 }
 
+// Monitors can only be handed over to a virtual thread, as that is the only kind of
+// continuation that is guaranteed to be resumed by the same java.lang.Thread.
+inline bool FreezeBase::can_transfer_monitors() const {
+  return YieldWithMonitors && !_preempt && _cont.entry()->is_virtual_thread();
+}
+
+// Called after the frames have been copied into the chunk, but while they are still
+// intact on the thread stack, which is where the BasicLocks of stack-locked objects are.
+void FreezeBase::transfer_monitors() {
+  assert(_monitors != nullptr, "");
+  for (int i = 0; i < _monitors->length(); i++) {
+    ObjectSynchronizer::transfer_to_vthread(_thread, _monitors->at(i)());
+  }
+  log_develop_trace(continuations)("transferred %d monitors held_monitor_count: %d",
+                                   _monitors->length(), _thread->held_monitor_count());
+}
+
 frame FreezeBase::freeze_start_frame() {
   frame f = _thread->last_frame();
   if (LIKELY(!_preempt)) {
@@ -752,14 +898,15 @@ NOINLINE freeze_result FreezeBase::freeze(frame& f, frame& caller, int callee_ar
       // special native frame
       return freeze_pinned_native;
     }
-    if (UNLIKELY(ContinuationHelper::CompiledFrame::is_owning_locks(_cont.thread(), SmallRegisterMap::instance, f))) {
+    if (UNLIKELY(ContinuationHelper::CompiledFrame::is_owning_locks(_cont.thread(), SmallRegisterMap::instance, f, _monitors))
+        && _monitors == nullptr) {
       return freeze_pinned_monitor;
     }
 
     return recurse_freeze_compiled_frame(f, caller, callee_argsize, callee_interpreted);
   } else if (f.is_interpreted_frame()) {
     assert((_preempt && top) || !f.interpreter_frame_method()->is_native(), "");
-    if (ContinuationHelper::InterpretedFrame::is_owning_locks(f)) {
+    if (ContinuationHelper::InterpretedFrame::is_owning_locks(f, _monitors) && _monitors == nullptr) {
       return freeze_pinned_monitor;
     }
     if (_preempt && top && f.interpreter_frame_method()->is_native()) {
@@ -870,7 +1017,8 @@ freeze_result FreezeBase::finalize_freeze(const frame& callee, frame& caller, in
     "unextended_sp: %d size: %d is_empty: %d", unextended_sp, _size, chunk->is_empty());
 
   DEBUG_ONLY(bool empty_chunk = true);
-  if (unextended_sp < _size || chunk->is_gc_mode() || (!_barriers && chunk->requires_barriers())) {
+  if (unextended_sp < _size || chunk->is_gc_mode() || (!_barriers && chunk->requires_barriers())
+      || (!_barriers && is_oversized_for(chunk, _size))) {
     // ALLOCATION
 
     if (lt.develop_is_enabled()) {
@@ -1199,8 +1347,15 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size) {
   JavaThread* current = _preempt ? JavaThread::current() : _thread;
   assert(current == JavaThread::current(), "should be current");
 
+  oop fast_oop = nullptr;
+  if (UseStackChunkCache && !_preempt) {
+    fast_oop = StackChunkCache::take(current, stack_size);
+  }
+
   StackChunkAllocator allocator(klass, size_in_words, stack_size, current);
-  oop fast_oop = allocator.try_allocate_in_existing_tlab();
+  if (fast_oop == nullptr) {
+    fast_oop = allocator.try_allocate_in_existing_tlab();
+  }
   oop chunk_oop = fast_oop;
   if (chunk_oop == nullptr) {
     ContinuationWrapper::SafepointOp so(current, _cont);
@@ -1214,7 +1369,8 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size) {
 
   stackChunkOop chunk = stackChunkOopDesc::cast(chunk_oop);
   // assert that chunk is properly initialized
-  assert(chunk->stack_size() == (int)stack_size, "");
+  assert(chunk->stack_size() == (int)stack_size || UseStackChunkCache, "");
+  assert(chunk->stack_size() >= (int)stack_size, "");
   assert(chunk->size() >= stack_size, "chunk->size(): %zu size: %zu", chunk->size(), stack_size);
   assert(chunk->sp() == chunk->stack_size(), "");
   assert((intptr_t)chunk->start_address() % 8 == 0, "");
@@ -1241,7 +1397,13 @@ stackChunkOop Freeze<ConfigT>::allocate_chunk(size_t stack_size) {
     }
   }
 
+  // The tail is replaced by the new chunk; if it is empty it is dropped
+  stackChunkOop old_tail = _cont.tail();
   _cont.set_tail(chunk);
+
+  if (UseStackChunkCache && !_preempt && old_tail != nullptr && old_tail->is_empty()) {
+    StackChunkCache::put(current, old_tail);
+  }
   return chunk;
 }
 
@@ -1281,12 +1443,12 @@ static void jvmti_yield_cleanup(JavaThread* thread, ContinuationWrapper& cont) {
 
 static freeze_result is_pinned(const frame& f, RegisterMap* map) {
   if (f.is_interpreted_frame()) {
-    if (ContinuationHelper::InterpretedFrame::is_owning_locks(f)) {
-      return freeze_pinned_monitor;
-    }
     if (f.interpreter_frame_method()->is_native()) {
       return freeze_pinned_native; // interpreter native entry
     }
+    if (ContinuationHelper::InterpretedFrame::is_owning_locks(f)) {
+      return freeze_pinned_monitor;
+    }
   } else if (f.is_compiled_frame()) {
     if (ContinuationHelper::CompiledFrame::is_owning_locks(map->thread(), map, f)) {
       return freeze_pinned_monitor;
@@ -1331,7 +1493,9 @@ static inline bool can_freeze_fast(JavaThread* thread) {
 
   // We also clear thread->cont_fastpath on deoptimization (notify_deopt) and when we thaw interpreted frames
   bool fast = thread->cont_fastpath() && UseContinuationFastPath;
-  assert(!fast || monitors_on_stack(thread) == (thread->held_monitor_count() > 0), "");
+  // With YieldWithMonitors, the monitors counted may be held by frames that have not been thawed yet
+  assert(!fast || monitors_on_stack(thread) == (thread->held_monitor_count() > 0)
+         || (YieldWithMonitors && thread->held_monitor_count() > 0), "");
   fast = fast && thread->held_monitor_count() == 0;
   return fast;
 }
@@ -1356,6 +1520,23 @@ static int freeze_epilog(JavaThread* thread, ContinuationWrapper& cont, freeze_r
   return freeze_epilog(thread, cont);
 }
 
+// Records where a virtual thread unmounts. Unmounted virtual threads are not known
+// to the VM, so their blocking points are sampled after a successful freeze, while
+// the frames that were copied are still on the carrier's stack.
+static void post_yield_sample(JavaThread* current, intptr_t* const sp) {
+  EventVirtualThreadYieldSample event;
+  if (event.should_commit()) {
+    event.set_carrierThread(JFR_JVM_THREAD_ID(current));
+    event.set_stackSize((u8)(current->last_continuation()->entry_sp() - sp) << LogBytesPerWord);
+    event.commit();
+  }
+}
+
+static void record_freeze_stats(JavaThread* current, intptr_t* const sp, ContinuationStats::Path path, jlong start_ticks) {
+  const int words = (int)(current->last_continuation()->entry_sp() - sp);
+  ContinuationStats::for_thread(current)->record(ContinuationStats::freeze_op, path, words, os::elapsed_counter() - start_ticks);
+}
+
 template<typename ConfigT>
 static inline int freeze_internal(JavaThread* current, intptr_t* const sp) {
   assert(!current->has_pending_exception(), "");
@@ -1366,6 +1547,7 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp) {
 #endif
 
   CONT_JFR_ONLY(EventContinuationFreeze event;)
+  const jlong start_ticks = ContinuationStatistics ? os::elapsed_counter() : 0;
 
   ContinuationEntry* entry = current->last_continuation();
 
@@ -1389,10 +1571,18 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp) {
   Freeze<ConfigT> fr(current, cont, false);
 
   bool fast = can_freeze_fast(current);
+  // The sample is recorded in the VM, before returning to the frames that were copied;
+  // take the slow path for it
+  const bool sample = EventVirtualThreadYieldSample::is_enabled() && entry->is_virtual_thread()
+                      && current->should_sample_cont_yield();
+  fast = fast && !sample;
   if (fast && fr.is_chunk_available_for_fast_freeze(sp)) {
     freeze_result res = fr.template try_freeze_fast<true>(sp);
     assert(res == freeze_ok, "");
     CONT_JFR_ONLY(fr.jfr_info().post_jfr_event(&event, oopCont, current);)
+    if (ContinuationStatistics) {
+      record_freeze_stats(current, sp, ContinuationStats::fast_path, start_ticks);
+    }
     freeze_epilog(current, cont);
     StackWatermarkSet::after_unwind(current);
     return 0;
@@ -1407,7 +1597,14 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp) {
 
     freeze_result res = fast ? fr.template try_freeze_fast<false>(sp)
                              : fr.freeze_slow();
+    // Pinned and failed yields do not unmount
+    if (sample && res <= freeze_ok_bottom) {
+      post_yield_sample(current, sp);
+    }
     CONT_JFR_ONLY(fr.jfr_info().post_jfr_event(&event, oopCont, current);)
+    if (ContinuationStatistics && res <= freeze_ok_bottom) {
+      record_freeze_stats(current, sp, fr.took_slow_path() ? ContinuationStats::slow_path : ContinuationStats::fast_path, start_ticks);
+    }
     freeze_epilog(current, cont, res);
     cont.done(); // allow safepoint in the transition back to Java
     StackWatermarkSet::after_unwind(current);
@@ -1424,6 +1621,9 @@ static freeze_result is_pinned0(JavaThread* thread, oop cont_scope, bool safepoi
     return freeze_pinned_cs;
   }
 
+  // see FreezeBase::can_transfer_monitors
+  const bool monitors_allowed = YieldWithMonitors && !safepoint && entry->is_virtual_thread();
+
   RegisterMap map(thread, true, false, false);
   map.set_include_argument_oops(false);
   frame f = thread->last_frame();
@@ -1445,7 +1645,7 @@ static freeze_result is_pinned0(JavaThread* thread, oop cont_scope, bool safepoi
 
   while (true) {
     freeze_result res = is_pinned(f, &map);
-    if (res != freeze_ok) {
+    if (res != freeze_ok && !(res == freeze_pinned_monitor && monitors_allowed)) {
       return res;
     }
 
@@ -1495,10 +1695,14 @@ static inline int prepare_thaw_internal(JavaThread* thread, bool return_barrier)
   // The tail can be empty because it might still be available for another freeze.
   // However, here we want to thaw, so we get rid of it (it will be GCed).
   if (UNLIKELY(chunk->is_empty())) {
+    stackChunkOop empty = chunk;
     chunk = chunk->parent();
     assert(chunk != nullptr, "");
     assert(!chunk->is_empty(), "");
     jdk_internal_vm_Continuation::set_tail(continuation, chunk);
+    if (UseStackChunkCache) {
+      StackChunkCache::put(thread, empty);
+    }
   }
 
   // Verification
@@ -1528,6 +1732,9 @@ protected:
 
   intptr_t* _fastpath;
   bool _barriers;
+  bool _slow_path; // for ContinuationStatistics
+  int _required_frames; // frames thaw_slow must thaw; the others are left in the chunk if interpreted
+  int _thawed_frames;
   intptr_t* _top_unextended_sp;
   int _align_size;
   DEBUG_ONLY(intptr_t* _top_stack_address);
@@ -1539,7 +1746,7 @@ protected:
 protected:
   ThawBase(JavaThread* thread, ContinuationWrapper& cont) :
       _thread(thread), _cont(cont),
-      _fastpath(nullptr) {
+      _fastpath(nullptr), _slow_path(false) {
     DEBUG_ONLY(_top_unextended_sp = nullptr;)
     assert (cont.tail() != nullptr, "no last chunk");
     DEBUG_ONLY(_top_stack_address = _cont.entrySP() - thaw_size(cont.tail());)
@@ -1585,6 +1792,7 @@ private:
 
  public:
   CONT_JFR_ONLY(FreezeThawJfrInfo& jfr_info() { return _jfr_info; })
+  bool took_slow_path() const { return _slow_path; }
 };
 
 template <typename ConfigT>
@@ -1614,8 +1822,9 @@ inline intptr_t* Thaw<ConfigT>::thaw(thaw_kind kind) {
   assert(!chunk->is_empty(), "guaranteed by prepare_thaw");
 
   _barriers = chunk->requires_barriers();
-  return (LIKELY(can_thaw_fast(chunk))) ? thaw_fast(chunk)
-                                        : thaw_slow(chunk, kind != thaw_top);
+  _slow_path = !can_thaw_fast(chunk);
+  return (LIKELY(!_slow_path)) ? thaw_fast(chunk)
+                               : thaw_slow(chunk, kind != thaw_top);
 }
 
 template <typename ConfigT>
@@ -1633,8 +1842,9 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
     chunk->print_on(true, &ls);
   }
 
-  // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
-  static const int threshold = 500; // words
+  // Below this heuristic, we thaw the whole chunk, above it we thaw just the top frames,
+  // and the rest is thawed on demand by the return barrier.
+  const int threshold = ContinuationFullThawThreshold; // words
 
   int chunk_start_sp = chunk->sp();
   const int full_chunk_size = chunk->stack_size() - chunk_start_sp; // this initial size could be reduced if it's a partial thaw
@@ -1656,19 +1866,32 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
     chunk->set_max_size(0);
 
     thaw_size = full_chunk_size;
-  } else { // thaw a single frame
+  } else { // thaw the top frames
     partial = true;
 
     StackChunkFrameStream<ChunkFrames::CompiledOnly> f(chunk);
     assert(chunk_sp == f.sp(), "");
     assert(chunk_sp == f.unextended_sp(), "");
 
-    const int frame_size = f.cb()->frame_size();
-    argsize = f.stack_argsize();
-
-    f.next(SmallRegisterMap::instance, true /* stop */);
+    // The frames are contiguous in the chunk, so we can copy as many of them at once as we like.
+    // We stop after ContinuationLazyThawFrames frames, or before exceeding the threshold.
+    const int max_frames = TEST_THAW_ONE_CHUNK_FRAME ? 1 : ContinuationLazyThawFrames;
+    int frame_size = 0; // the size of all thawed frames, excluding the bottom-most one's stack arguments
+    int num_frames = 0;
+    while (true) {
+      frame_size += f.cb()->frame_size();
+      argsize = f.stack_argsize();
+      num_frames++;
+
+      const bool stop = num_frames >= max_frames;
+      f.next(SmallRegisterMap::instance, stop);
+      if (stop || f.is_done() || frame_size + f.cb()->frame_size() >= threshold) {
+        break;
+      }
+    }
     empty = f.is_done();
     assert(!empty || argsize == chunk->argsize(), "");
+    log_develop_trace(continuations)("thaw_fast partial num_frames: %d", num_frames);
 
     if (empty) {
       chunk->set_sp(chunk->stack_size());
@@ -1783,7 +2006,10 @@ NOINLINE intptr_t* ThawBase::thaw_slow(stackChunkOop chunk, bool return_barrier)
 
   DEBUG_ONLY(_frames = 0;)
   _align_size = 0;
-  int num_frames = (return_barrier ? 1 : 2);
+  // On a top thaw, the top frame is about to return from yield, so we thaw its caller, too.
+  int num_frames = ContinuationLazyThawFrames + (return_barrier ? 0 : 1);
+  _required_frames = return_barrier ? 1 : 2;
+  _thawed_frames = 0;
   bool last_interpreted = chunk->has_mixed_frames() && Interpreter::contains(chunk->pc());
 
   _stream = StackChunkFrameStream<ChunkFrames::Mixed>(chunk);
@@ -1835,10 +2061,19 @@ bool ThawBase::recurse_thaw_java_frame(frame& caller, int num_frames) {
   DEBUG_ONLY(_frames++;)
 
   int argsize = _stream.stack_argsize();
+  _thawed_frames++;
 
   _stream.next(SmallRegisterMap::instance);
   assert(_stream.to_frame().is_empty() == _stream.is_done(), "");
 
+  // An interpreted frame on the stack keeps freeze off the fast path until it returns
+  // (see JavaThread::_cont_fastpath), so we leave interpreted frames we're not about to
+  // return to in the chunk, to be thawed by the return barrier.
+  if (num_frames > 1 && !_stream.is_done() && _stream.is_interpreted() && _thawed_frames >= _required_frames) {
+    log_develop_trace(continuations)("leaving interpreted frame in the chunk");
+    num_frames = 1;
+  }
+
   // we never leave a compiled caller of an interpreted frame as the top frame in the chunk
   // as it makes detecting that situation and adjusting unextended_sp tricky
   if (num_frames == 1 && !_stream.is_done() && FKind::interpreted && _stream.is_compiled()) {
@@ -2160,6 +2395,7 @@ static inline intptr_t* thaw_internal(JavaThread* thread, const thaw_kind kind)
   assert(thread == JavaThread::current(), "Must be current thread");
 
   CONT_JFR_ONLY(EventContinuationThaw event;)
+  const jlong start_ticks = ContinuationStatistics ? os::elapsed_counter() : 0;
 
   log_develop_trace(continuations)("~~~~ thaw kind: %d sp: " INTPTR_FORMAT, kind, p2i(thread->last_continuation()->entry_sp()));
 
@@ -2182,11 +2418,23 @@ static inline intptr_t* thaw_internal(JavaThread* thread, const thaw_kind kind)
   clear_anchor(thread);
 #endif
 
+  // Monitors held by the continuation's frames when it was frozen are counted again
+  // when it is mounted (see FreezeBase::transfer_monitors)
+  int locked_monitors = 0;
+  if (kind == thaw_top) {
+    locked_monitors = cont.tail()->locked_monitors();
+    cont.tail()->set_locked_monitors(0);
+  }
+
   Thaw<ConfigT> thw(thread, cont);
   intptr_t* const sp = thw.thaw(kind);
   assert(is_aligned(sp, frame::frame_alignment), "");
 
-  thread->reset_held_monitor_count();
+  if (kind == thaw_top) {
+    thread->set_held_monitor_count(locked_monitors);
+  } else {
+    assert(YieldWithMonitors || thread->held_monitor_count() == 0, "");
+  }
 
   verify_continuation(cont.continuation());
 
@@ -2211,6 +2459,13 @@ static inline intptr_t* thaw_internal(JavaThread* thread, const thaw_kind kind)
 
   CONT_JFR_ONLY(thw.jfr_info().post_jfr_event(&event, cont.continuation(), thread);)
 
+  if (ContinuationStatistics) {
+    const int words = (int)(cont.entrySP() - sp);
+    ContinuationStats::for_thread(thread)->record(ContinuationStats::thaw_op,
+                                                  thw.took_slow_path() ? ContinuationStats::slow_path : ContinuationStats::fast_path,
+                                                  words, os::elapsed_counter() - start_ticks);
+  }
+
   verify_continuation(cont.continuation());
   log_develop_debug(continuations)("=== End of thaw #" INTPTR_FORMAT, cont.hash());
 
@@ -2419,4 +2674,5 @@ private:
 
 void Continuation::init() {
   ConfigResolve::resolve();
+  StackChunkCache::init();
 }
@@ -29,10 +29,12 @@
 #include "compiler/oopMap.hpp"
 #include "memory/allStatic.hpp"
 #include "runtime/frame.hpp"
+#include "runtime/handles.hpp"
 #include "runtime/stackValue.hpp"
 
 // Helper, all-static
 class ContinuationEntry;
+template <typename E> class GrowableArray;
 
 class ContinuationHelper {
 public:
@@ -100,7 +102,7 @@ public:
   static int size(const frame& f, InterpreterOopMap* mask);
   static int size(const frame& f);
   static inline int expression_stack_size(const frame &f, InterpreterOopMap* mask);
-  static bool is_owning_locks(const frame& f);
+  static bool is_owning_locks(const frame& f, GrowableArray<Handle>* locks = nullptr);
 
   static bool is_instance(const frame& f);
 
@@ -130,7 +132,7 @@ public:
   static bool is_instance(const frame& f);
 
   template <typename RegisterMapT>
-  static bool is_owning_locks(JavaThread* thread, RegisterMapT* map, const frame& f);
+  static bool is_owning_locks(JavaThread* thread, RegisterMapT* map, const frame& f, GrowableArray<Handle>* locks = nullptr);
 };
 
 class ContinuationHelper::StubFrame : public ContinuationHelper::NonInterpretedFrame {
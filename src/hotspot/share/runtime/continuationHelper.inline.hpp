@@ -31,7 +31,9 @@
 #include "compiler/oopMap.hpp"
 #include "compiler/oopMap.inline.hpp"
 #include "runtime/frame.inline.hpp"
+#include "runtime/handles.inline.hpp"
 #include "runtime/stackValue.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 
 #include CPU_HEADER_INLINE(continuationHelper)
@@ -106,22 +108,28 @@ inline int ContinuationHelper::InterpretedFrame::expression_stack_size(const fra
   return size;
 }
 
-inline bool ContinuationHelper::InterpretedFrame::is_owning_locks(const frame& f) {
+// If locks is not null, all locked objects are appended to it, otherwise we stop at the first one
+inline bool ContinuationHelper::InterpretedFrame::is_owning_locks(const frame& f, GrowableArray<Handle>* locks) {
   assert(f.interpreter_frame_monitor_end() <= f.interpreter_frame_monitor_begin(), "must be");
   if (f.interpreter_frame_monitor_end() == f.interpreter_frame_monitor_begin()) {
     return false;
   }
 
+  bool owning = false;
   for (BasicObjectLock* current = f.previous_monitor_in_interpreter_frame(f.interpreter_frame_monitor_begin());
         current >= f.interpreter_frame_monitor_end();
         current = f.previous_monitor_in_interpreter_frame(current)) {
 
       oop obj = current->obj();
       if (obj != nullptr) {
-        return true;
+        if (locks == nullptr) {
+          return true;
+        }
+        locks->append(Handle(Thread::current(), obj));
+        owning = true;
       }
   }
-  return false;
+  return owning;
 }
 
 inline intptr_t* ContinuationHelper::InterpretedFrame::frame_top(const frame& f) { // inclusive; this will be copied with the frame
@@ -168,7 +176,7 @@ inline int ContinuationHelper::CompiledFrame::num_oops(const frame& f) {
 }
 
 template<typename RegisterMapT>
-bool ContinuationHelper::CompiledFrame::is_owning_locks(JavaThread* thread, RegisterMapT* map, const frame& f) {
+bool ContinuationHelper::CompiledFrame::is_owning_locks(JavaThread* thread, RegisterMapT* map, const frame& f, GrowableArray<Handle>* locks) {
   assert(!f.is_interpreted_frame(), "");
   assert(CompiledFrame::is_instance(f), "");
 
@@ -181,6 +189,7 @@ bool ContinuationHelper::CompiledFrame::is_owning_locks(JavaThread* thread, Regi
 
   frame::update_map_with_saved_link(map, Frame::callee_link_address(f)); // the monitor object could be stored in the link register
   ResourceMark rm;
+  bool owning = false;
   for (ScopeDesc* scope = cm->scope_desc_at(f.pc()); scope != nullptr; scope = scope->sender()) {
     GrowableArray<MonitorValue*>* mons = scope->monitors();
     if (mons == nullptr || mons->is_empty()) {
@@ -197,11 +206,15 @@ bool ContinuationHelper::CompiledFrame::is_owning_locks(JavaThread* thread, Regi
       oop owner = owner_sv->get_obj()();
       if (owner != nullptr) {
         //assert(cm->has_monitors(), "");
-        return true;
+        if (locks == nullptr) {
+          return true;
+        }
+        locks->append(Handle(thread, owner));
+        owning = true;
       }
     }
   }
-  return false;
+  return owning;
 }
 
 inline bool ContinuationHelper::StubFrame::is_instance(const frame& f) {
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/continuationStats.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.inline.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+ContinuationStats ContinuationStats::_exited;
+
+ContinuationStats::ContinuationStats() {
+  memset(_counts, 0, sizeof(_counts));
+  memset(_total_ticks, 0, sizeof(_total_ticks));
+}
+
+int ContinuationStats::size_bucket(int words) {
+  if (words < 64) {
+    return 0;
+  }
+  // each bucket covers four times the size of the previous one
+  return MIN2((log2i(words) - 6) / 2 + 1, num_size_buckets - 1);
+}
+
+int ContinuationStats::time_bucket(jlong ticks) {
+  if (ticks <= 0) {
+    return 0;
+  }
+  return MIN2(log2i(ticks), num_time_buckets - 1);
+}
+
+uint64_t ContinuationStats::count(Op op, Path path) const {
+  uint64_t n = 0;
+  for (int s = 0; s < num_size_buckets; s++) {
+    for (int t = 0; t < num_time_buckets; t++) {
+      n += _counts[op][path][s][t];
+    }
+  }
+  return n;
+}
+
+jlong ContinuationStats::percentile_ticks(Op op, Path path, double fraction) const {
+  uint64_t per_time[num_time_buckets] = {};
+  uint64_t n = 0;
+  for (int t = 0; t < num_time_buckets; t++) {
+    for (int s = 0; s < num_size_buckets; s++) {
+      per_time[t] += _counts[op][path][s][t];
+    }
+    n += per_time[t];
+  }
+  if (n == 0) {
+    return 0;
+  }
+  const uint64_t target = MAX2((uint64_t)1, (uint64_t)(n * fraction));
+  uint64_t seen = 0;
+  for (int t = 0; t < num_time_buckets; t++) {
+    seen += per_time[t];
+    if (seen >= target) {
+      return (jlong)1 << (t + 1);
+    }
+  }
+  return (jlong)1 << num_time_buckets;
+}
+
+const char* ContinuationStats::op_name(Op op) {
+  return op == freeze_op ? "freeze" : "thaw";
+}
+
+const char* ContinuationStats::path_name(Path path) {
+  return path == fast_path ? "fast" : "slow";
+}
+
+const char* ContinuationStats::size_bucket_name(int bucket) {
+  static const char* names[num_size_buckets] = { "<64", "<256", "<1K", "<4K", "<16K", ">=16K" };
+  assert(bucket >= 0 && bucket < num_size_buckets, "");
+  return names[bucket];
+}
+
+void ContinuationStats::add_to(ContinuationStats* other, bool atomic) const {
+  for (int o = 0; o < num_ops; o++) {
+    for (int p = 0; p < num_paths; p++) {
+      for (int s = 0; s < num_size_buckets; s++) {
+        for (int t = 0; t < num_time_buckets; t++) {
+          const uint64_t c = _counts[o][p][s][t];
+          if (c == 0) continue;
+          if (atomic) {
+            Atomic::add(&other->_counts[o][p][s][t], c, memory_order_relaxed);
+          } else {
+            other->_counts[o][p][s][t] += c;
+          }
+        }
+      }
+      if (atomic) {
+        Atomic::add(&other->_total_ticks[o][p], _total_ticks[o][p], memory_order_relaxed);
+      } else {
+        other->_total_ticks[o][p] += _total_ticks[o][p];
+      }
+    }
+  }
+}
+
+ContinuationStats* ContinuationStats::for_thread(JavaThread* thread) {
+  ContinuationStats* stats = thread->cont_stats();
+  if (stats == nullptr) {
+    stats = new ContinuationStats();
+    thread->set_cont_stats(stats);
+  }
+  return stats;
+}
+
+void ContinuationStats::release(ContinuationStats* stats) {
+  if (stats != nullptr) {
+    stats->add_to(&_exited, true);
+    delete stats;
+  }
+}
+
+// The counters of live threads are read without synchronization, so the result
+// is only approximately consistent, which is good enough for statistics.
+void ContinuationStats::collect(ContinuationStats* result) {
+  _exited.add_to(result, false);
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    ContinuationStats* stats = jt->cont_stats();
+    if (stats != nullptr) {
+      stats->add_to(result, false);
+    }
+  }
+}
+
+void ContinuationStats::print_on(outputStream* st) {
+  if (!ContinuationStatistics) {
+    st->print_cr("Continuation statistics are disabled; enable them with -XX:+ContinuationStatistics");
+    return;
+  }
+
+  ContinuationStats* total = new ContinuationStats();
+  collect(total);
+
+  const double ns_per_tick = (double)NANOSECS_PER_SEC / os::elapsed_frequency();
+  for (int o = 0; o < num_ops; o++) {
+    for (int p = 0; p < num_paths; p++) {
+      const Op op = (Op)o;
+      const Path path = (Path)p;
+      const uint64_t n = total->count(op, path);
+      st->print("%s %s: count: " UINT64_FORMAT, op_name(op), path_name(path), n);
+      if (n == 0) {
+        st->cr();
+        continue;
+      }
+      st->print_cr(" avg: %.0fns p50: <%.0fns p90: <%.0fns p99: <%.0fns max: <%.0fns",
+                   total->total_ticks(op, path) * ns_per_tick / n,
+                   total->percentile_ticks(op, path, 0.50) * ns_per_tick,
+                   total->percentile_ticks(op, path, 0.90) * ns_per_tick,
+                   total->percentile_ticks(op, path, 0.99) * ns_per_tick,
+                   total->percentile_ticks(op, path, 1.00) * ns_per_tick);
+      for (int s = 0; s < num_size_buckets; s++) {
+        uint64_t per_size = 0;
+        for (int t = 0; t < num_time_buckets; t++) {
+          per_size += total->_counts[o][p][s][t];
+        }
+        if (per_size == 0) continue;
+        st->print("  %6s words: " UINT64_FORMAT_W(10) " |", size_bucket_name(s), per_size);
+        for (int t = 0; t < num_time_buckets; t++) {
+          const uint64_t c = total->_counts[o][p][s][t];
+          if (c != 0) {
+            st->print(" <%.0fns: " UINT64_FORMAT, (double)((jlong)1 << (t + 1)) * ns_per_tick, c);
+          }
+        }
+        st->cr();
+      }
+    }
+  }
+  delete total;
+}
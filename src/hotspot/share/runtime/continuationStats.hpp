@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_CONTINUATIONSTATS_HPP
+#define SHARE_RUNTIME_CONTINUATIONSTATS_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class JavaThread;
+class outputStream;
+
+// Per-carrier histograms of freeze and thaw latencies, enabled with ContinuationStatistics.
+// Each carrier records into its own instance without synchronization; readers sum the
+// instances of all live threads and the totals of the threads that have exited.
+// Latencies are kept in power-of-two buckets of os::elapsed_counter() ticks, and are
+// split by operation, by fast/slow path and by the size of the frames copied.
+class ContinuationStats : public CHeapObj<mtThread> {
+public:
+  enum Op   { freeze_op, thaw_op, num_ops };
+  enum Path { fast_path, slow_path, num_paths };
+
+  static const int num_size_buckets = 6;   // < 64, < 256, < 1K, < 4K, < 16K and more words
+  static const int num_time_buckets = 32;  // [2^i, 2^(i+1)) ticks; the last one is open
+
+private:
+  uint64_t _counts[num_ops][num_paths][num_size_buckets][num_time_buckets];
+  uint64_t _total_ticks[num_ops][num_paths];
+
+  static ContinuationStats _exited; // threads that have exited
+
+  static int size_bucket(int words);
+  static int time_bucket(jlong ticks);
+
+  void add_to(ContinuationStats* other, bool atomic) const;
+
+public:
+  ContinuationStats();
+
+  void record(Op op, Path path, int words, jlong ticks) {
+    const int tb = time_bucket(ticks);
+    _counts[op][path][size_bucket(words)][tb]++;
+    _total_ticks[op][path] += (uint64_t)ticks;
+  }
+
+  uint64_t count(Op op, Path path) const;
+  uint64_t total_ticks(Op op, Path path) const { return _total_ticks[op][path]; }
+  // Upper bound, in ticks, of the bucket holding the given fraction of samples
+  jlong percentile_ticks(Op op, Path path, double fraction) const;
+
+  static const char* op_name(Op op);
+  static const char* path_name(Path path);
+  static const char* size_bucket_name(int bucket);
+
+  // The stats of the current thread, allocated on first use
+  static ContinuationStats* for_thread(JavaThread* thread);
+  // Called when a thread exits; folds its stats into the totals
+  static void release(ContinuationStats* stats);
+  // Sums the stats of all threads
+  static void collect(ContinuationStats* result);
+  // Prints the stats of all threads (jcmd Thread.continuation_stats)
+  static void print_on(outputStream* st);
+};
+
+#endif // SHARE_RUNTIME_CONTINUATIONSTATS_HPP
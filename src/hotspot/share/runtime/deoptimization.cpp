@@ -38,6 +38,7 @@
 #include "interpreter/bytecode.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/oopMapCache.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/oopFactory.hpp"
 #include "memory/resourceArea.hpp"
@@ -1835,6 +1836,37 @@ static void post_deoptimization_event(CompiledMethod* nm,
 
 #endif // INCLUDE_JFR
 
+// Uncommon traps are counted in one second windows. When a window has more than
+// DeoptimizationStormThreshold traps, the first trap over it is reported once.
+static volatile jlong _deopt_window_start = 0;
+static volatile int   _deopt_window_count = 0;
+
+static void check_deoptimization_storm(const Method* method, int trap_bci) {
+  jlong now = os::javaTimeNanos();
+  jlong start = Atomic::load(&_deopt_window_start);
+  if (now - start >= NANOSECS_PER_SEC && Atomic::cmpxchg(&_deopt_window_start, start, now) == start) {
+    Atomic::store(&_deopt_window_count, 0);
+  }
+  int count = Atomic::add(&_deopt_window_count, 1);
+  if (count != DeoptimizationStormThreshold + 1) {
+    return;
+  }
+  if (log_is_enabled(Warning, deoptimization)) {
+    ResourceMark rm;
+    log_warning(deoptimization)("Deoptimization storm: %d uncommon traps within one second, last in %s @ %d",
+                                count, method->name_and_sig_as_C_string(), trap_bci);
+  }
+#if INCLUDE_JFR
+  EventDeoptimizationStorm event;
+  if (event.should_commit()) {
+    event.set_trapCount(count);
+    event.set_method(method);
+    event.set_bci(trap_bci);
+    event.commit();
+  }
+#endif
+}
+
 JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint trap_request)) {
   HandleMark hm(current);
 
@@ -1930,6 +1962,10 @@ JRT_ENTRY(void, Deoptimization::uncommon_trap_inner(JavaThread* current, jint tr
 
     JFR_ONLY(post_deoptimization_event(nm, trap_method(), trap_bci, trap_bc, reason, action);)
 
+    if (DeoptimizationStormThreshold > 0) {
+      check_deoptimization_storm(trap_method(), trap_bci);
+    }
+
     // Log a message
     Events::log_deopt_message(current, "Uncommon trap: reason=%s action=%s pc=" INTPTR_FORMAT " method=%s @ %d %s",
                               trap_reason_name(reason), trap_action_name(action), p2i(fr.pc()),
@@ -546,6 +546,13 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uint, NativeMemoryTrackingStackSampleInterval, 1, DIAGNOSTIC,     \
+          "With NativeMemoryTracking=detail, capture the call stack of "    \
+          "one in this many malloc calls of a thread. The malloc sites "    \
+          "in the detail report are scaled up accordingly, the summary "    \
+          "stays exact")                                                    \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -865,6 +872,11 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, TraceOopMapRewrites, false,                                 \
           "Trace rewriting of methods during oop map generation")           \
                                                                             \
+  product(intx, InlineCacheBufferSize, 10*K, DIAGNOSTIC,                    \
+          "Size in bytes of the buffer holding inline cache transition "    \
+          "stubs. A full buffer forces an ICBufferFull safepoint")          \
+          range(1*K, 1*M)                                                   \
+                                                                            \
   develop(bool, TraceICBuffer, false,                                       \
           "Trace usage of IC buffer")                                       \
                                                                             \
@@ -920,6 +932,12 @@ const intx ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(bool, UseLoadAwareCompilation, false, DIAGNOSTIC,                 \
+             "Scale compile thresholds by the system load average relative "\
+             "to the number of processors of the host, and limit the "      \
+             "number of dynamically added compiler threads to the idle "    \
+             "processors")                                                  \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -949,6 +967,12 @@ const intx ObjectAlignmentInBytes = 8;
   product(bool, EnableThreadSMRStatistics, trueInDebug, DIAGNOSTIC,         \
              "Enable Thread SMR Statistics")                                \
                                                                             \
+  product(uint, ThreadsListFreeBatchSize, 8, DIAGNOSTIC,                    \
+          "Number of retired ThreadsLists to collect before scanning "      \
+          "hazard pointers to free them. Larger values amortize the "       \
+          "scan over more thread starts and exits")                         \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, UseNotificationThread, true,                                \
           "Use Notification Thread")                                        \
                                                                             \
@@ -1395,6 +1419,11 @@ const intx ObjectAlignmentInBytes = 8;
           "Limit on traps (of one kind) at a particular BCI")               \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, DeoptimizationStormThreshold, 0, DIAGNOSTIC,                \
+          "Report a deoptimization storm when more uncommon traps than "    \
+          "this are taken within one second. 0 disables the check")         \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, SpecTrapLimitExtraEntries,  3, EXPERIMENTAL,                \
           "Extra method data trap entries for speculation")                 \
                                                                             \
@@ -1434,6 +1463,11 @@ const intx ObjectAlignmentInBytes = 8;
   product(ccstr, MetaspaceReclaimPolicy, "balanced",                        \
           "options: balanced, aggressive, none")                            \
                                                                             \
+  product(bool, MetaspaceUseLargePages, false, DIAGNOSTIC,                  \
+          "Pass the large page size as alignment hint when committing "     \
+          "metaspace, so that it can be backed by transparent huge "        \
+          "pages. Has no effect unless UseLargePages is enabled")           \
+                                                                            \
   product(bool, PrintMetaspaceStatisticsAtExit, false, DIAGNOSTIC,          \
           "Print metaspace statistics upon VM exit.")                       \
                                                                             \
@@ -1766,6 +1800,13 @@ const intx ObjectAlignmentInBytes = 8;
           "up to a multiple of the native os page size.")                   \
           range(128, 32*64*K)                                               \
                                                                             \
+  product(uint, PerThreadPerfDataSlots, 0, DIAGNOSTIC,                      \
+          "Number of sun.threads.slot.<n> PerfData slots that export "      \
+          "the allocated bytes and CPU time of individual threads, "        \
+          "updated at TLAB refill. Large values may require a larger "      \
+          "PerfDataMemorySize. 0 disables the per-thread counters")         \
+          range(0, 1024)                                                    \
+                                                                            \
   product(intx, PerfMaxStringConstLength, 1024,                             \
           "Maximum PerfStringConstant string length before truncation")     \
           range(32, 32*K)                                                   \
@@ -1958,6 +1999,16 @@ const intx ObjectAlignmentInBytes = 8;
            "do not map the archive")                                        \
            range(0, 2)                                                      \
                                                                             \
+  product(bool, UseParallelArchiveRelocation, false, DIAGNOSTIC,            \
+          "Use the GC worker threads, if the collector has any, to "        \
+          "patch pointers when the archive is mapped at an alternative "    \
+          "address")                                                        \
+                                                                            \
+  product(bool, ArchiveResolvedSuperTypes, true, DIAGNOSTIC,                \
+          "Keep constant pool class entries of boot classes resolved in "   \
+          "the CDS archive when they refer to the class itself or one of "  \
+          "its super types")                                                \
+                                                                            \
   product(size_t, ArrayAllocatorMallocLimit, (size_t)-1, EXPERIMENTAL,      \
           "Allocation less than this value will be allocated "              \
           "using malloc. Larger allocations will use mmap.")                \
@@ -2016,6 +2067,43 @@ const intx ObjectAlignmentInBytes = 8;
   develop(bool, UseContinuationFastPath, true,                              \
           "Use fast-path frame walking in continuations")                   \
                                                                             \
+  product(int, ContinuationFullThawThreshold, 500, EXPERIMENTAL,            \
+          "Thaw all frames of a stack chunk at once if they take up fewer " \
+          "words than this. Otherwise only the top frames are thawed, and " \
+          "the rest on demand when they are returned to")                   \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(int, ContinuationLazyThawFrames, 1, EXPERIMENTAL,                 \
+          "Maximum number of frames to thaw at a time when not thawing "    \
+          "all frames of a stack chunk at once")                            \
+          range(1, 100)                                                     \
+                                                                            \
+  product(int, StackChunkMaxOversize, 4, EXPERIMENTAL,                      \
+          "Do not freeze into an empty stack chunk that is more than this " \
+          "many times larger than the frames being frozen, but allocate a " \
+          "smaller chunk, so that unmounted continuations do not retain "   \
+          "unused stack space. 0 means always reuse an empty chunk")        \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(bool, UseStackChunkCache, false, EXPERIMENTAL,                    \
+          "Keep an empty stack chunk per carrier thread and reuse it for "  \
+          "the next freeze instead of allocating a new one")                \
+                                                                            \
+  product(bool, ContinuationStatistics, false, DIAGNOSTIC,                  \
+          "Record histograms of freeze and thaw latencies per carrier "     \
+          "thread. See jcmd Thread.continuation_stats")                     \
+                                                                            \
+  product(uint, ContinuationYieldSampleInterval, 1000, EXPERIMENTAL,        \
+          "Record one in this many yields of virtual threads on a carrier " \
+          "thread as a VirtualThreadYieldSample JFR event, when the event " \
+          "is enabled")                                                     \
+          range(1, max_juint)                                               \
+                                                                            \
+  product(bool, YieldWithMonitors, false, EXPERIMENTAL,                     \
+          "Allow a virtual thread to yield while its frames hold object "   \
+          "monitors. The monitors stay owned by the virtual thread while "  \
+          "it is unmounted instead of pinning it to its carrier thread")    \
+                                                                            \
   product(intx, ScopeLocalCacheSize, 16,                                    \
           "Size of the cache for scoped values")                            \
            range(0, max_intx)                                               \
@@ -2043,6 +2131,13 @@ const intx ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, NULL,                       \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(size_t, NativeAllocationSampleInterval, 512*K,           \
+          EXPERIMENTAL,                                                     \
+          "Number of bytes allocated through os::malloc and os::realloc "   \
+          "by a thread between two NativeAllocationSample JFR events, "     \
+          "when the event is enabled")                                      \
+          range(1, max_uintx))                                              \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
@@ -39,6 +39,7 @@
 #include "runtime/thread.hpp"
 #include "runtime/threadSMR.hpp"
 #include "runtime/vmThread.hpp"
+#include "utilities/bitMap.inline.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/filterQueue.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -261,6 +262,10 @@ class VM_HandshakeAllThreads: public VM_Operation {
     // Keeps count on how many of own emitted handshakes
     // this thread execute.
     int emitted_handshakes_executed = 0;
+    // Threads that are known to be done with _op are not revisited, so
+    // that a few slow threads do not make every round walk all threads.
+    ResourceMark rm;
+    ResourceBitMap done(number_of_threads_issued);
     do {
       // Check if handshake operation has timed out
       check_handshake_timeout(start_time_ns, _op);
@@ -269,14 +274,20 @@ class VM_HandshakeAllThreads: public VM_Operation {
       // Observing a blocked state may of course be transient but the processing is guarded
       // by mutexes and we optimistically begin by working on the blocked threads
       jtiwh.rewind();
-      for (JavaThread* thr = jtiwh.next(); thr != NULL; thr = jtiwh.next()) {
-        // A new thread on the ThreadsList will not have an operation,
-        // hence it is skipped in handshake_try_process.
+      int index = 0;
+      for (JavaThread* thr = jtiwh.next(); thr != NULL; thr = jtiwh.next(), index++) {
+        if (done.at(index)) {
+          continue;
+        }
         HandshakeState::ProcessResult pr = thr->handshake_state()->try_process(_op);
         hsy.add_result(pr);
         if (pr == HandshakeState::_succeeded) {
           emitted_handshakes_executed++;
         }
+        // With no operation left the thread has executed _op itself.
+        if (pr == HandshakeState::_succeeded || pr == HandshakeState::_no_operation) {
+          done.set_bit(index);
+        }
       }
       hsy.process();
     } while (!_op->is_completed());
@@ -41,6 +41,9 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/preserveException.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeAllocationSample.inline.hpp"
+#endif
 
 // Wrapper for all entry points to the virtual machine.
 
@@ -130,6 +133,7 @@ class ThreadInVMfromJava : public ThreadStateTransition {
     if (_thread->stack_overflow_state()->stack_yellow_reserved_zone_disabled()) {
       _thread->stack_overflow_state()->enable_stack_yellow_reserved_zone();
     }
+    JFR_ONLY(JfrNativeAllocationSample::commit_pending(_thread);)
     // We prevent asynchronous exceptions from being installed on return to Java in situations
     // where we can't tolerate them. See bugs: 4324348, 4854693, 4998314, 5040492, 5050705.
     transition_from_vm(_thread, _thread_in_Java, _check_asyncs);
@@ -170,7 +174,10 @@ class ThreadInVMfromNative : public ThreadStateTransition {
   }
   ~ThreadInVMfromNative() {
     // We cannot assert !_thread->owns_locks() since we have valid cases where
-    // we call known native code using this wrapper holding locks.
+    // we call known native code using this wrapper holding locks. A native
+    // allocation sample taken in this scope is committed here, or dropped if
+    // locks may still be held.
+    JFR_ONLY(JfrNativeAllocationSample::commit_pending(_thread, DEBUG_ONLY(!_thread->owns_locks()) NOT_DEBUG(true));)
     transition_from_vm(_thread, _thread_in_native);
   }
 };
@@ -180,6 +187,7 @@ class ThreadToNativeFromVM : public ThreadStateTransition {
  public:
   ThreadToNativeFromVM(JavaThread *thread) : ThreadStateTransition(thread) {
     assert(!thread->owns_locks(), "must release all locks when leaving VM");
+    JFR_ONLY(JfrNativeAllocationSample::commit_pending(thread);)
     transition_from_vm(thread, _thread_in_native);
   }
   ~ThreadToNativeFromVM() {
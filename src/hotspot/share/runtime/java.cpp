@@ -31,9 +31,11 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -480,10 +482,20 @@ void before_exit(JavaThread* thread) {
     }
   }
 
+  LogTarget(Info, oopstorage, stats) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    OopStorageSet::print_allocation_contention_on(&ls);
+  }
+
   if (PrintBytecodeHistogram) {
     BytecodeHistogram::print();
   }
 
+  if (DumpHotMethodsAtExit != NULL) {
+    CompilationPolicy::dump_hot_methods(DumpHotMethodsAtExit);
+  }
+
 #ifdef LINUX
   if (DumpPerfMapAtExit) {
     CodeCache::write_perf_map();
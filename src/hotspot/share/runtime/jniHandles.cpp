@@ -35,6 +35,7 @@
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/threadSMR.hpp"
 #include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 
@@ -81,6 +82,22 @@ static void report_handle_allocation_failure(AllocFailType alloc_failmode,
   }
 }
 
+// Java threads take global handle entries from a per-thread cache that is
+// refilled in bulk, so that they rarely contend on the storage's allocation lock.
+oop* JNIHandles::allocate_global_handle() {
+  Thread* thread = Thread::current();
+  if (thread->is_Java_thread()) {
+    JavaThread* jt = JavaThread::cast(thread);
+    OopStorageAllocationCache* cache = jt->jni_global_handle_cache();
+    if (cache == NULL) {
+      cache = new OopStorageAllocationCache(global_handles());
+      jt->set_jni_global_handle_cache(cache);
+    }
+    return cache->allocate();
+  }
+  return global_handles()->allocate();
+}
+
 jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   assert(!Universe::heap()->is_gc_active(), "can't extend the root set during GC");
   assert(!current_thread_in_native(), "must not be in native");
@@ -88,7 +105,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_global_handle();
     // Return NULL on allocation failure.
     if (ptr != NULL) {
       assert(*ptr == NULL, "invariant");
@@ -265,8 +282,18 @@ size_t JNIHandles::weak_global_handle_memory_usage() {
 void JNIHandles::print_on(outputStream* st) {
   assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
 
+  // Entries in the per-thread caches are allocated in the storage, but are
+  // not global refs until they are handed out.
+  size_t cached = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* jt = jtiwh.next(); ) {
+    OopStorageAllocationCache* cache = jt->jni_global_handle_cache();
+    if (cache != NULL) {
+      cached += cache->count();
+    }
+  }
+
   st->print_cr("JNI global refs: " SIZE_FORMAT ", weak refs: " SIZE_FORMAT,
-               global_handles()->allocation_count(),
+               global_handles()->allocation_count() - cached,
                weak_global_handles()->allocation_count());
   st->cr();
   st->flush();
@@ -45,6 +45,9 @@ class JNIHandles : AllStatic {
   static OopStorage* global_handles();
   static OopStorage* weak_global_handles();
 
+  // Allocates an entry for a new global handle, NULL on failure.
+  static oop* allocate_global_handle();
+
   inline static bool is_jweak(jobject handle);
   inline static oop* jobject_ptr(jobject handle); // NOT jweak!
   inline static oop* jweak_ptr(jobject handle);
@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
@@ -315,6 +316,33 @@ void ObjectMonitor::ClearSuccOnSuspend::operator()(JavaThread* current) {
   }
 }
 
+// -----------------------------------------------------------------------------
+// Virtual thread owner support
+//
+// With YieldWithMonitors a virtual thread may be unmounted while it holds
+// monitors. ObjectSynchronizer::transfer_to_vthread() then replaces the
+// carrier JavaThread* in the _owner field with a value derived from the
+// virtual thread's id, so that the monitor stays owned while the virtual
+// thread is not running. When the virtual thread next operates on the
+// monitor, possibly on a different carrier, the owner is converted back
+// to the current JavaThread*.
+
+bool ObjectMonitor::is_owner_of_mounted_vthread(void* owner, JavaThread* current) {
+  assert(is_vthread_owner(owner), "must be");
+  if (!current->is_vthread_mounted()) {
+    return false;
+  }
+  return owner == vthread_owner(java_lang_Thread::thread_id(current->vthread()));
+}
+
+bool ObjectMonitor::try_set_owner_from_vthread(void* cur, JavaThread* current) {
+  if (!is_vthread_owner(cur) || !is_owner_of_mounted_vthread(cur, current)) {
+    return false;
+  }
+  set_owner_from(cur, current);
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 // Enter support
 
@@ -341,6 +369,12 @@ bool ObjectMonitor::enter(JavaThread* current) {
     return true;
   }
 
+  if (try_set_owner_from_vthread(cur, current)) {
+    // Frozen and thawed while holding the monitor; this is a recursive enter.
+    _recursions++;
+    return true;
+  }
+
   // We've encountered genuine contention.
   assert(current->_Stalled == 0, "invariant");
   current->_Stalled = intptr_t(this);
@@ -1139,6 +1173,8 @@ void ObjectMonitor::exit(JavaThread* current, bool not_suspended) {
       assert(_recursions == 0, "invariant");
       set_owner_from_BasicLock(cur, current);  // Convert from BasicLock* to Thread*.
       _recursions = 0;
+    } else if (try_set_owner_from_vthread(cur, current)) {
+      // Owned by the virtual thread mounted on current; _recursions is preserved.
     } else {
       // Apparent unbalanced locking ...
       // Naively we'd like to throw IllegalMonitorStateException.
@@ -1359,6 +1395,8 @@ intx ObjectMonitor::complete_exit(JavaThread* current) {
       assert(_recursions == 0, "internal state error");
       set_owner_from_BasicLock(cur, current);  // Convert from BasicLock* to Thread*.
       _recursions = 0;
+    } else {
+      try_set_owner_from_vthread(cur, current);
     }
   }
 
@@ -1412,6 +1450,9 @@ bool ObjectMonitor::check_owner(TRAPS) {
     _recursions = 0;
     return true;
   }
+  if (try_set_owner_from_vthread(cur, current)) {
+    return true;
+  }
   THROW_MSG_(vmSymbols::java_lang_IllegalMonitorStateException(),
              "current thread is not owner", false);
 }
@@ -1845,6 +1886,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
         if (x < Knob_Poverty) x = Knob_Poverty;
         _SpinDuration = x + Knob_BonusB;
       }
+      OM_PERFDATA_OP(SpinAcquires, inc());
       return 1;
     }
     SpinPause();
@@ -1868,6 +1910,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
   if (ctr <= 0) return 0;
 
   if (NotRunnable(current, (JavaThread*) owner_raw())) {
+    OM_PERFDATA_OP(SpinOwnerNotRunnable, inc());
     return 0;
   }
 
@@ -1938,6 +1981,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        OM_PERFDATA_OP(SpinAcquires, inc());
         return 1;
       }
 
@@ -1961,6 +2005,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     // Spinning while the owner is OFFPROC is idiocy.
     // Consider: ctr -= RunnablePenalty ;
     if (NotRunnable(current, ox)) {
+      OM_PERFDATA_OP(SpinOwnerNotRunnable, inc());
       goto Abort;
     }
     if (_succ == NULL) {
@@ -1990,7 +2035,10 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(current) > 0) return 1;
+    if (TryLock(current) > 0) {
+      OM_PERFDATA_OP(SpinAcquires, inc());
+      return 1;
+    }
   }
   return 0;
 }
@@ -2031,6 +2079,9 @@ int ObjectMonitor::NotRunnable(JavaThread* current, JavaThread* ox) {
   // Check ox->TypeTag == 2BAD.
   if (ox == NULL) return 0;
 
+  // An unmounted virtual thread owner is not running on any carrier.
+  if (is_vthread_owner(ox)) return 1;
+
   // Avoid transitive spinning ...
   // Say T1 spins or blocks trying to acquire L.  T1._Stalled is set to L.
   // Immediately after T1 acquires L it's possible that T2, also
@@ -2135,6 +2186,8 @@ PerfCounter * ObjectMonitor::_sync_ContendedLockAttempts       = NULL;
 PerfCounter * ObjectMonitor::_sync_FutileWakeups               = NULL;
 PerfCounter * ObjectMonitor::_sync_Parks                       = NULL;
 PerfCounter * ObjectMonitor::_sync_Notifications               = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinAcquires               = NULL;
+PerfCounter * ObjectMonitor::_sync_SpinOwnerNotRunnable       = NULL;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = NULL;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = NULL;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = NULL;
@@ -2172,6 +2225,8 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_SpinAcquires);
+    NEWPERFCOUNTER(_sync_SpinOwnerNotRunnable);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
@@ -197,6 +197,8 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   static PerfCounter * _sync_FutileWakeups;
   static PerfCounter * _sync_Parks;
   static PerfCounter * _sync_Notifications;
+  static PerfCounter * _sync_SpinAcquires;
+  static PerfCounter * _sync_SpinOwnerNotRunnable;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
   static PerfLongVariable * _sync_MonExtant;
@@ -259,6 +261,14 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   void      set_owner_from(void* old_value, void* new_value);
   // Simply set _owner field to current; current value must match basic_lock_p.
   void      set_owner_from_BasicLock(void* basic_lock_p, JavaThread* current);
+  // While a virtual thread that holds this monitor is unmounted, the _owner
+  // field holds a tagged thread id instead of a JavaThread* (see YieldWithMonitors).
+  static inline void* vthread_owner(int64_t tid);
+  static inline bool is_vthread_owner(void* owner);
+  static bool is_owner_of_mounted_vthread(void* owner, JavaThread* current);
+  // Simply set _owner field to current if cur is the owner value of the
+  // virtual thread currently mounted on current. Returns true on success.
+  bool      try_set_owner_from_vthread(void* cur, JavaThread* current);
   // Try to set _owner field to new_value if the current value matches
   // old_value, using Atomic::cmpxchg(). Otherwise, does not change the
   // _owner field. Returns the prior value of the _owner field.
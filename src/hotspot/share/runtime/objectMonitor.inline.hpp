@@ -37,6 +37,9 @@ inline intptr_t ObjectMonitor::is_entered(JavaThread* current) const {
   if (current == owner || current->is_lock_owned((address)owner)) {
     return 1;
   }
+  if (is_vthread_owner(owner) && is_owner_of_mounted_vthread(owner, current)) {
+    return 1;
+  }
   return 0;
 }
 
@@ -132,6 +135,17 @@ inline void ObjectMonitor::set_owner_from_BasicLock(void* basic_lock_p, JavaThre
                                      p2i(this), p2i(basic_lock_p), p2i(current));
 }
 
+// The thread id is shifted and tagged with the low bit so that it can
+// never be mistaken for a JavaThread* or a BasicLock*, both of which
+// are word aligned.
+inline void* ObjectMonitor::vthread_owner(int64_t tid) {
+  return reinterpret_cast<void*>((tid << 1) | 1);
+}
+
+inline bool ObjectMonitor::is_vthread_owner(void* owner) {
+  return owner != DEFLATER_MARKER && (p2i(owner) & 1) != 0;
+}
+
 // Try to set _owner field to new_value if the current value matches
 // old_value. Otherwise, does not change the _owner field. Returns
 // the prior value of the _owner field.
@@ -71,6 +71,9 @@
 #include "utilities/defaultStream.hpp"
 #include "utilities/events.hpp"
 #include "utilities/powerOfTwo.hpp"
+#if INCLUDE_JFR
+#include "jfr/support/jfrNativeAllocationSample.inline.hpp"
+#endif
 
 # include <signal.h>
 # include <errno.h>
@@ -626,7 +629,7 @@ static void break_if_ptr_caught(void* ptr) {
 #endif // ASSERT
 
 void* os::malloc(size_t size, MEMFLAGS flags) {
-  return os::malloc(size, flags, CALLER_PC);
+  return os::malloc(size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -659,6 +662,7 @@ void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
   }
 
   void* const inner_ptr = MemTracker::record_malloc((address)outer_ptr, size, memflags, stack);
+  JFR_ONLY(JfrNativeAllocationSample::sample(size, memflags, stack);)
 
   if (DumpSharedSpaces) {
     // Need to deterministically fill all the alignment gaps in C++ structures.
@@ -671,7 +675,7 @@ void* os::malloc(size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS flags) {
-  return os::realloc(memblock, size, flags, CALLER_PC);
+  return os::realloc(memblock, size, flags, MALLOC_CALLER_PC);
 }
 
 void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCallStack& stack) {
@@ -709,6 +713,7 @@ void* os::realloc(void *memblock, size_t size, MEMFLAGS memflags, const NativeCa
   }
 
   void* const new_inner_ptr = MemTracker::record_malloc(new_outer_ptr, size, memflags, stack);
+  JFR_ONLY(JfrNativeAllocationSample::sample(size, memflags, stack);)
 
   DEBUG_ONLY(break_if_ptr_caught(new_inner_ptr);)
 
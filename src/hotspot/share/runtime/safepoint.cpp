@@ -41,6 +41,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -94,12 +95,16 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
                                              uint64_t safepoint_id,
                                              int initial_number_of_threads,
                                              int threads_waiting_to_block,
-                                             uint64_t iterations) {
+                                             uint64_t iterations,
+                                             JavaThread* slowest_thread,
+                                             jlong slowest_time_ns) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
     event.set_initialThreadCount(initial_number_of_threads);
     event.set_runningThreadCount(threads_waiting_to_block);
     event.set_iterations(iterations);
+    event.set_slowestThread(slowest_thread != NULL ? JFR_JVM_THREAD_ID(slowest_thread) : 0);
+    event.set_slowestThreadTime(slowest_time_ns);
     event.commit();
   }
 }
@@ -214,7 +219,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** slowest_thread, jlong* slowest_time_ns)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -244,6 +250,8 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *slowest_thread = NULL;
+  *slowest_time_ns = 0;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -266,6 +274,9 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        // The last thread to stop is the one that held up the safepoint.
+        *slowest_thread = cur_tss->thread();
+        *slowest_time_ns = os::javaTimeNanos() - SafepointTracing::start_of_safepoint();
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -381,14 +392,24 @@ void SafepointSynchronize::begin() {
 
   EventSafepointStateSynchronization sync_event;
   int initial_running = 0;
+  JavaThread* slowest_thread = NULL;
+  jlong slowest_time_ns = 0;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running,
+                                       &slowest_thread, &slowest_time_ns);
   assert(_waiting_to_block == 0, "No thread should be running");
 
+  // Threads_lock is held, so the slowest thread can not exit before it is reported.
+  if (slowest_thread != NULL && log_is_enabled(Info, safepoint, stats)) {
+    ResourceMark rm;
+    log_info(safepoint, stats)("Slowest thread to reach safepoint: \"%s\" " INTPTR_FORMAT ", " JLONG_FORMAT " ns, %d iterations",
+                               slowest_thread->name(), p2i(slowest_thread), slowest_time_ns, iterations);
+  }
+
 #ifndef PRODUCT
   // Mark all threads
   if (VerifyCrossModifyFence) {
@@ -431,7 +452,8 @@ void SafepointSynchronize::begin() {
   post_safepoint_synchronize_event(sync_event,
                                    _safepoint_id,
                                    initial_running,
-                                   _waiting_to_block, iterations);
+                                   _waiting_to_block, iterations,
+                                   slowest_thread, slowest_time_ns);
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
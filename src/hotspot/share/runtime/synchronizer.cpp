@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
 #include "classfile/vmSymbols.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
@@ -991,6 +992,22 @@ bool ObjectSynchronizer::current_thread_holds_lock(JavaThread* current,
   return false;
 }
 
+// A stack-locked obj is inflated first: its BasicLock lives in a frame that
+// is about to be copied into a stack chunk, and will not stay at the address
+// the mark word points to. The monitor is converted back to the carrier the
+// next time the virtual thread operates on it (see ObjectMonitor::exit()).
+void ObjectSynchronizer::transfer_to_vthread(JavaThread* current, oop obj) {
+  assert(current == JavaThread::current(), "Can only be called on current thread");
+  assert(current->is_vthread_mounted(), "must be");
+
+  ObjectMonitor* monitor = inflate(current, obj, inflate_cause_cont_freeze);
+  void* owner = monitor->owner_raw();
+  if (owner == current || current->is_lock_owned((address)owner)) {
+    monitor->set_owner_from(owner, ObjectMonitor::vthread_owner(java_lang_Thread::thread_id(current->vthread())));
+  }
+  assert(monitor->is_entered(current), "must still be owned by the mounted virtual thread");
+}
+
 // FIXME: jvmti should call this
 JavaThread* ObjectSynchronizer::get_lock_owner(ThreadsList * t_list, Handle h_obj) {
   oop obj = h_obj();
@@ -1415,15 +1432,18 @@ void ObjectSynchronizer::chk_for_block_req(JavaThread* current, const char* op_n
 //
 size_t ObjectSynchronizer::deflate_monitor_list(Thread* current, LogStream* ls,
                                                 elapsedTimer* timer_p,
-                                                ObjectMonitorsHashtable* table) {
+                                                ObjectMonitorsHashtable* table,
+                                                size_t* scanned_count_p) {
   MonitorList::Iterator iter = _in_use_list.iterator();
   size_t deflated_count = 0;
+  size_t scanned_count = 0;
 
   while (iter.has_next()) {
     if (deflated_count >= (size_t)MonitorDeflationMax) {
       break;
     }
     ObjectMonitor* mid = iter.next();
+    scanned_count++;
     if (mid->deflate_monitor()) {
       deflated_count++;
     } else if (table != nullptr) {
@@ -1447,6 +1467,7 @@ size_t ObjectSynchronizer::deflate_monitor_list(Thread* current, LogStream* ls,
     }
   }
 
+  *scanned_count_p = scanned_count;
   return deflated_count;
 }
 
@@ -1488,7 +1509,8 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
   }
 
   // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(current, ls, &timer, table);
+  size_t scanned_count = 0;
+  size_t deflated_count = deflate_monitor_list(current, ls, &timer, table, &scanned_count);
   if (deflated_count > 0 || is_final_audit()) {
     // There are ObjectMonitors that have been deflated or this is the
     // final audit and all the remaining ObjectMonitors have been
@@ -1541,8 +1563,9 @@ size_t ObjectSynchronizer::deflate_idle_monitors(ObjectMonitorsHashtable* table)
   if (ls != NULL) {
     timer.stop();
     if (deflated_count != 0 || log_is_enabled(Debug, monitorinflation)) {
-      ls->print_cr("deflated " SIZE_FORMAT " monitors in %3.7f secs",
-                   deflated_count, timer.seconds());
+      double secs = timer.seconds();
+      ls->print_cr("deflated " SIZE_FORMAT " of " SIZE_FORMAT " scanned monitors in %3.7f secs (%.0f monitors/sec)",
+                   deflated_count, scanned_count, secs, secs > 0.0 ? deflated_count / secs : 0.0);
     }
     ls->print_cr("end deflating: in_use_list stats: ceiling=" SIZE_FORMAT ", count=" SIZE_FORMAT ", max=" SIZE_FORMAT,
                  in_use_list_ceiling(), _in_use_list.count(), _in_use_list.max());
@@ -1613,6 +1636,7 @@ const char* ObjectSynchronizer::inflate_cause_name(const InflateCause cause) {
     case inflate_cause_hash_code:      return "Monitor Hash Code";
     case inflate_cause_jni_enter:      return "JNI Monitor Enter";
     case inflate_cause_jni_exit:       return "JNI Monitor Exit";
+    case inflate_cause_cont_freeze:    return "Continuation Freeze";
     default:
       ShouldNotReachHere();
   }
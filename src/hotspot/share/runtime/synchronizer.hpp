@@ -133,7 +133,8 @@ class ObjectSynchronizer : AllStatic {
     inflate_cause_hash_code = 4,
     inflate_cause_jni_enter = 5,
     inflate_cause_jni_exit = 6,
-    inflate_cause_nof = 7 // Number of causes
+    inflate_cause_cont_freeze = 7,
+    inflate_cause_nof = 8 // Number of causes
   } InflateCause;
 
   typedef enum {
@@ -187,6 +188,10 @@ class ObjectSynchronizer : AllStatic {
   // java.lang.Thread support
   static bool current_thread_holds_lock(JavaThread* current, Handle h_obj);
 
+  // Continuation support: hand ownership of obj's monitor from current to the
+  // virtual thread mounted on it, before that virtual thread is unmounted.
+  static void transfer_to_vthread(JavaThread* current, oop obj);
+
   static JavaThread* get_lock_owner(ThreadsList * t_list, Handle h_obj);
 
   // JNI detach support
@@ -214,7 +219,7 @@ class ObjectSynchronizer : AllStatic {
                                 const char* cnt_name, size_t cnt, LogStream* ls,
                                 elapsedTimer* timer_p);
   static size_t deflate_monitor_list(Thread* current, LogStream* ls, elapsedTimer* timer_p,
-                                     ObjectMonitorsHashtable* table);
+                                     ObjectMonitorsHashtable* table, size_t* scanned_count_p);
   static size_t in_use_list_ceiling();
   static void dec_in_use_list_ceiling();
   static void inc_in_use_list_ceiling();
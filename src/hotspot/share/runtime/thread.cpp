@@ -80,6 +80,7 @@
 #include "runtime/continuation.hpp"
 #include "runtime/continuationEntry.inline.hpp"
 #include "runtime/continuationHelper.inline.hpp"
+#include "runtime/continuationStats.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlagLimit.hpp"
 #include "runtime/deoptimization.hpp"
@@ -790,6 +791,7 @@ void JavaThread::set_threadOopHandles(oop p) {
   _vthread     = OopHandle(_thread_oop_storage, p);
   _jvmti_vthread = OopHandle(_thread_oop_storage, NULL);
   _scopeLocalCache = OopHandle(_thread_oop_storage, NULL);
+  _cont_chunk_cache = OopHandle(_thread_oop_storage, NULL);
 }
 
 oop JavaThread::threadObj() const {
@@ -823,6 +825,15 @@ void JavaThread::set_scopeLocalCache(oop p) {
   _scopeLocalCache.replace(p);
 }
 
+oop JavaThread::cont_chunk_cache() const {
+  return _cont_chunk_cache.resolve();
+}
+
+void JavaThread::set_cont_chunk_cache(oop p) {
+  assert(_thread_oop_storage != NULL, "not yet initialized");
+  _cont_chunk_cache.replace(p);
+}
+
 void JavaThread::allocate_threadObj(Handle thread_group, const char* thread_name,
                                     bool daemon, TRAPS) {
   assert(thread_group.not_null(), "thread group should be specified");
@@ -1073,7 +1084,9 @@ JavaThread::JavaThread() :
 
   _jni_active_critical(0),
   _pending_jni_exception_check_fn(nullptr),
+  _jni_global_handle_cache(nullptr),
   _depth_first_number(0),
+  _perf_data_slot(-1),
 
   // JVMTI PopFrame support
   _popframe_condition(popframe_inactive),
@@ -1083,6 +1096,8 @@ JavaThread::JavaThread() :
   _cont_fastpath(0),
   _cont_fastpath_thread_state(1),
   _held_monitor_count(0),
+  _cont_stats(nullptr),
+  _cont_yields_until_sample(0),
 
   _handshake(this),
 
@@ -1226,6 +1241,14 @@ JavaThread::~JavaThread() {
   ServiceThread::add_oop_handle_release(_threadObj);
   ServiceThread::add_oop_handle_release(_vthread);
   ServiceThread::add_oop_handle_release(_jvmti_vthread);
+  ServiceThread::add_oop_handle_release(_cont_chunk_cache);
+
+  ContinuationStats::release(_cont_stats);
+  _cont_stats = NULL;
+
+  // Release the unused cached JNI global handle entries
+  delete _jni_global_handle_cache;
+  _jni_global_handle_cache = NULL;
 
   // Return the sleep event to the free list
   ParkEvent::Release(_SleepEvent);
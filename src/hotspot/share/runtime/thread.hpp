@@ -64,6 +64,7 @@ class JvmtiRawMonitor;
 class JvmtiSampledObjectAllocEventCollector;
 class JvmtiThreadState;
 class JvmtiVMObjectAllocEventCollector;
+class OopStorageAllocationCache;
 class OSThread;
 class ThreadStatistics;
 class ConcurrentLocksDump;
@@ -86,6 +87,7 @@ class ResourceArea;
 class OopStorage;
 
 class ContinuationEntry;
+class ContinuationStats;
 
 DEBUG_ONLY(class ResourceMark;)
 
@@ -706,6 +708,7 @@ class JavaThread: public Thread {
   OopHandle      _vthread; // the value returned by Thread.currentThread(): the virtual thread, if mounted, otherwise _threadObj
   OopHandle      _jvmti_vthread;
   OopHandle      _scopeLocalCache;
+  OopHandle      _cont_chunk_cache;              // an empty stack chunk kept for reuse by the next freeze on this carrier
 
 #ifdef ASSERT
  private:
@@ -1032,9 +1035,15 @@ class JavaThread: public Thread {
   // Checked JNI: function name requires exception check
   char* _pending_jni_exception_check_fn;
 
+  // Entries for new JNI global handles, created on first use
+  OopStorageAllocationCache* _jni_global_handle_cache;
+
   // For deadlock detection.
   int _depth_first_number;
 
+  // Index of the PerfData slot published by ThreadService, or -1.
+  int _perf_data_slot;
+
   // JVMTI PopFrame support
   // This is set to popframe_pending to signal that top Java frame should be popped immediately
   int _popframe_condition;
@@ -1050,6 +1059,8 @@ class JavaThread: public Thread {
                             // continuation that we know about
   int _cont_fastpath_thread_state; // whether global thread state allows continuation fastpath (JVMTI)
   int _held_monitor_count;  // used by continuations for fast lock detection
+  ContinuationStats* _cont_stats; // freeze/thaw latencies, when ContinuationStatistics is on
+  uint _cont_yields_until_sample;  // see ContinuationYieldSampleInterval
 private:
 
   friend class VMThread;
@@ -1121,6 +1132,8 @@ private:
   void set_vthread(oop p);
   oop scopeLocalCache() const;
   void set_scopeLocalCache(oop p);
+  oop cont_chunk_cache() const;
+  void set_cont_chunk_cache(oop p);
   oop jvmti_vthread() const;
   void set_jvmti_vthread(oop p);
 
@@ -1197,6 +1210,19 @@ private:
 
   int held_monitor_count()        { return _held_monitor_count; }
   void reset_held_monitor_count() { _held_monitor_count = 0; }
+  void set_held_monitor_count(int count) { assert(count >= 0, "must be"); _held_monitor_count = count; }
+
+  ContinuationStats* cont_stats() const                { return _cont_stats; }
+  void set_cont_stats(ContinuationStats* stats)        { _cont_stats = stats; }
+  // Returns true every ContinuationYieldSampleInterval calls
+  bool should_sample_cont_yield() {
+    if (_cont_yields_until_sample > 0) {
+      _cont_yields_until_sample--;
+      return false;
+    }
+    _cont_yields_until_sample = ContinuationYieldSampleInterval - 1;
+    return true;
+  }
   void inc_held_monitor_count();
   void dec_held_monitor_count();
 
@@ -1451,10 +1477,16 @@ private:
   const char* get_pending_jni_exception_check() const { return _pending_jni_exception_check_fn; }
   void set_pending_jni_exception_check(const char* fn_name) { _pending_jni_exception_check_fn = (char*) fn_name; }
 
+  OopStorageAllocationCache* jni_global_handle_cache() const { return _jni_global_handle_cache; }
+  void set_jni_global_handle_cache(OopStorageAllocationCache* cache) { _jni_global_handle_cache = cache; }
+
   // For deadlock detection
   int depth_first_number() { return _depth_first_number; }
   void set_depth_first_number(int dfn) { _depth_first_number = dfn; }
 
+  int perf_data_slot() const           { return _perf_data_slot; }
+  void set_perf_data_slot(int slot)    { _perf_data_slot = slot; }
+
  private:
   void set_monitor_chunks(MonitorChunk* monitor_chunks) { _monitor_chunks = monitor_chunks; }
 
@@ -127,6 +127,10 @@ volatile uint         ThreadsSMRSupport::_tlh_times = 0;
 
 ThreadsList*          ThreadsSMRSupport::_to_delete_list = NULL;
 
+// Number of ThreadsLists on _to_delete_list; unlike _to_delete_list_cnt
+// this is maintained whether or not statistics are enabled.
+uint                  ThreadsSMRSupport::_to_delete_list_pending = 0;
+
 // # of parallel ThreadsLists on the to-delete list.
 // Impl note: Hard to imagine > 64K ThreadsLists needing to be deleted so
 // this could be 16-bit, but there is no nice 16-bit _FORMAT support.
@@ -891,6 +895,14 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
     }
   }
 
+  // Scanning the hazard ptrs costs O(number of threads), and so would
+  // make every thread start and exit O(n) once more; batch the scans
+  // so that each one can free several retired ThreadsLists.
+  if (++_to_delete_list_pending < ThreadsListFreeBatchSize) {
+    log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is deferred.", os::current_thread_id(), p2i(threads));
+    return;
+  }
+
   // Gather a hash table of the current hazard ptrs:
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
   ScanHazardPtrGatherThreadsListClosure scan_cl(scan_table);
@@ -918,6 +930,7 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
       log_debug(thread, smr)("tid=" UINTX_FORMAT ": ThreadsSMRSupport::free_list: threads=" INTPTR_FORMAT " is freed.", os::current_thread_id(), p2i(current));
       if (current == threads) threads_is_freed = true;
       delete current;
+      _to_delete_list_pending--;
       if (EnableThreadSMRStatistics) {
         _java_thread_list_free_cnt++;
         _to_delete_list_cnt--;
@@ -121,6 +121,7 @@ class ThreadsSMRSupport : AllStatic {
   static ThreadsList*          _to_delete_list;
   static uint                  _to_delete_list_cnt;
   static uint                  _to_delete_list_max;
+  static uint                  _to_delete_list_pending;
 
   static ThreadsList *acquire_stable_list_fast_path(Thread *self);
   static ThreadsList *acquire_stable_list_nested_path(Thread *self);
@@ -288,6 +288,25 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class TLABStatsDCmd : public DCmd {
+public:
+  TLABStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "GC.tlab_stats"; }
+  static const char* description() {
+    return "Print the TLAB statistics of each Java thread since the last GC.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+      "monitor", NULL};
+      return p;
+  }
+
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class FinalizerInfoDCmd : public DCmd {
 public:
   FinalizerInfoDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -950,4 +969,24 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ContinuationStatsDCmd : public DCmd {
+public:
+  ContinuationStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() {
+    return "Thread.continuation_stats";
+  }
+  static const char* description() {
+    return "Print histograms of continuation freeze and thaw latencies. "
+           "Requires -XX:+UnlockDiagnosticVMOptions -XX:+ContinuationStatistics.";
+  }
+  static const char* impact() {
+    return "Low: Depends on the number of threads.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission", "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #endif // SHARE_SERVICES_DIAGNOSTICCOMMAND_HPP
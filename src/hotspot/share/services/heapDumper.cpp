@@ -696,6 +696,8 @@ class ParDumpWriter : public AbstractDumpWriter {
   CompressionBackend* _backend_ptr;
   char const * _err;
   ParWriterBufferQueue* _buffer_queue;
+  // Buffers already sent to the backend, kept for reuse by allocate_internal_buffer().
+  ParWriterBufferQueue* _free_buffers;
   size_t _internal_buffer_used;
   char* _buffer_base;
   bool _split_data;
@@ -723,6 +725,7 @@ class ParDumpWriter : public AbstractDumpWriter {
     AbstractDumpWriter(),
     _backend_ptr(dw->backend_ptr()),
     _buffer_queue((new (std::nothrow) ParWriterBufferQueue())),
+    _free_buffers((new (std::nothrow) ParWriterBufferQueue())),
     _buffer_base(NULL),
     _split_data(false) {
     // prepare internal buffer
@@ -739,6 +742,15 @@ class ParDumpWriter : public AbstractDumpWriter {
      }
      delete _buffer_queue;
      _buffer_queue = NULL;
+     if (_free_buffers != NULL) {
+       while (!_free_buffers->is_empty()) {
+         ParWriterBufferQueueElem* entry = _free_buffers->dequeue();
+         os::free(entry->_buffer);
+         os::free(entry);
+       }
+       delete _free_buffers;
+       _free_buffers = NULL;
+     }
   }
 
   // total number of bytes written to the disk
@@ -784,7 +796,13 @@ class ParDumpWriter : public AbstractDumpWriter {
   void allocate_internal_buffer() {
     assert(_buffer_queue != NULL, "Internal buffer queue is not ready when allocate internal buffer");
     assert(_buffer == NULL && _buffer_base == NULL, "current buffer must be NULL before allocate");
-    _buffer_base = _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
+    if (_free_buffers != NULL && !_free_buffers->is_empty()) {
+      ParWriterBufferQueueElem* entry = _free_buffers->dequeue();
+      _buffer_base = _buffer = entry->_buffer;
+      os::free(entry);
+    } else {
+      _buffer_base = _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
+    }
     if (_buffer == NULL) {
       set_error("Could not allocate buffer for writer");
       return;
@@ -832,8 +850,15 @@ class ParDumpWriter : public AbstractDumpWriter {
     allocate_internal_buffer();
   }
 
+  // The data of a reclaimed entry has been copied to the backend. Keep up to
+  // BackendFlushThreshold + 1 buffers, the most a flush can reclaim, so the
+  // next ones are not malloc'ed and faulted in again for every 1M of output.
   void reclaim_entry(ParWriterBufferQueueElem* entry) {
     assert(entry != NULL && entry->_buffer != NULL, "Invalid entry to reclaim");
+    if (_free_buffers != NULL && _free_buffers->length() <= BackendFlushThreshold) {
+      _free_buffers->enqueue(entry);
+      return;
+    }
     os::free(entry->_buffer);
     entry->_buffer = NULL;
     os::free(entry);
@@ -864,12 +889,11 @@ class ParDumpWriter : public AbstractDumpWriter {
     // Flush internal buffer.
     if (_internal_buffer_used > 0) {
       flush_buffer(_buffer_base, _internal_buffer_used);
-      os::free(_buffer_base);
+      // Reuse the internal buffer from its start.
       _pos = 0;
       _internal_buffer_used = 0;
-      _buffer_base = _buffer = NULL;
-      // Allocate internal buffer for future use.
-      allocate_internal_buffer();
+      _buffer = _buffer_base;
+      _size = io_buffer_max_size;
     }
   }
 };
@@ -44,10 +44,11 @@ class MallocSite : public AllocationSite {
   void allocate(size_t size)      { _c.allocate(size);   }
   void deallocate(size_t size)    { _c.deallocate(size); }
 
-  // Memory allocated from this code path
-  size_t size()  const { return _c.size(); }
+  // Memory allocated from this code path, scaled up by the weight of its
+  // stack if only some of its allocations were sampled
+  size_t size()  const { return _c.size() * call_stack()->weight(); }
   // The number of calls were made
-  size_t count() const { return _c.count(); }
+  size_t count() const { return _c.count() * call_stack()->weight(); }
 };
 
 // Malloc site hashtable entry
@@ -126,6 +127,10 @@ class MallocSiteTable : AllStatic {
   static uint16_t pos_idx_from_marker(uint32_t marker) { return marker & 0xFFFF; }
 
  public:
+  // Marker of a detail mode allocation whose stack was not sampled, see
+  // NativeMemoryTrackingStackSampleInterval. It is never a valid bucket index.
+  static const uint32_t unsampled_marker = 0xFFFFFFFF;
+
 
   static bool initialize();
 
@@ -80,10 +80,18 @@ size_t MallocMemorySnapshot::total() const {
   for (int index = 0; index < mt_number_of_types; index ++) {
     amount += _malloc[index].malloc_size();
   }
-  amount += _tracking_header.size() + total_arena();
+  amount += malloc_overhead() + total_arena();
   return amount;
 }
 
+// Thread stacks may be accounted as malloc'd memory by the thread stack
+// tracker, but they are not allocated through os::malloc() and so carry
+// no malloc header.
+size_t MallocMemorySnapshot::malloc_overhead() const {
+  const size_t thread_stacks = _malloc[NMTUtil::flag_to_index(mtThreadStack)].malloc_count();
+  return (total_count() - thread_stacks) * sizeof(MallocHeader);
+}
+
 // Total malloc'd memory used by arenas
 size_t MallocMemorySnapshot::total_arena() const {
   size_t amount = 0;
@@ -241,10 +249,14 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flag
   assert(malloc_base != NULL, "precondition");
 
   MallocMemorySummary::record_malloc(size, flags);
-  MallocMemorySummary::record_new_malloc_header(sizeof(MallocHeader));
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    if (stack.weight() == 0) {
+      // Not sampled; only the summary accounts for this allocation.
+      mst_marker = MallocSiteTable::unsampled_marker;
+    } else {
+      MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    }
   }
 
   // Uses placement global new operator to initialize malloc header
@@ -276,8 +288,8 @@ void* MallocTracker::record_free(void* memblock) {
   header->assert_block_integrity();
 
   MallocMemorySummary::record_free(header->size(), header->flags());
-  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
-  if (MemTracker::tracking_level() == NMT_detail) {
+  if (MemTracker::tracking_level() == NMT_detail &&
+      header->mst_marker() != MallocSiteTable::unsampled_marker) {
     MallocSiteTable::deallocation_at(header->size(), header->mst_marker());
   }
 
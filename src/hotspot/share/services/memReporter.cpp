@@ -25,6 +25,7 @@
 #include "memory/allocation.hpp"
 #include "memory/metaspace.hpp"
 #include "memory/metaspaceUtils.hpp"
+#include "runtime/globals.hpp"
 #include "services/mallocTracker.hpp"
 #include "services/memReporter.hpp"
 #include "services/threadStackTracker.hpp"
@@ -157,8 +158,8 @@ void MemSummaryReporter::report_summary_of_type(MEMFLAGS flag,
     }
   } else if (flag == mtNMT) {
     // Count malloc headers in "NMT" category
-    reserved_amount  += _malloc_snapshot->malloc_overhead()->size();
-    committed_amount += _malloc_snapshot->malloc_overhead()->size();
+    reserved_amount  += _malloc_snapshot->malloc_overhead();
+    committed_amount += _malloc_snapshot->malloc_overhead();
   }
 
   if (amount_in_current_scale(reserved_amount) > 0) {
@@ -210,9 +211,9 @@ void MemSummaryReporter::report_summary_of_type(MEMFLAGS flag,
     }
 
     if (flag == mtNMT &&
-      amount_in_current_scale(_malloc_snapshot->malloc_overhead()->size()) > 0) {
+      amount_in_current_scale(_malloc_snapshot->malloc_overhead()) > 0) {
       out->print_cr("%27s (tracking overhead=" SIZE_FORMAT "%s)", " ",
-        amount_in_current_scale(_malloc_snapshot->malloc_overhead()->size()), scale);
+        amount_in_current_scale(_malloc_snapshot->malloc_overhead()), scale);
     } else if (flag == mtClass) {
       // Metadata information
       report_metadata(Metaspace::NonClassType);
@@ -268,6 +269,12 @@ int MemDetailReporter::report_malloc_sites() {
 
   outputStream* out = output();
 
+  if (NativeMemoryTrackingStackSampleInterval > 1) {
+    out->print_cr("(Malloc call stacks sampled 1 in %u calls per thread, amounts of sampled sites scaled up.)",
+                  NativeMemoryTrackingStackSampleInterval);
+    out->cr();
+  }
+
   const MallocSite* malloc_site;
   int num_omitted = 0;
   while ((malloc_site = malloc_itr.next()) != NULL) {
@@ -286,7 +293,7 @@ int MemDetailReporter::report_malloc_sites() {
     MEMFLAGS flag = malloc_site->flag();
     assert(NMTUtil::flag_is_valid(flag) && flag != mtNone,
       "Must have a valid memory type");
-    print_malloc(malloc_site->size(), malloc_site->count(),flag);
+    print_malloc(malloc_site->size(), malloc_site->count(), flag);
     out->print_cr("\n");
   }
   return num_omitted;
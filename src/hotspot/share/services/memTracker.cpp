@@ -48,6 +48,7 @@
 
 volatile NMT_TrackingLevel MemTracker::_tracking_level = NMT_unknown;
 NMT_TrackingLevel MemTracker::_cmdline_tracking_level = NMT_unknown;
+THREAD_LOCAL uint MemTracker::_malloc_stack_samples_skipped = 0;
 
 MemBaseline MemTracker::_baseline;
 
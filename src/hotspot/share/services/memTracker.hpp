@@ -25,6 +25,7 @@
 #ifndef SHARE_SERVICES_MEMTRACKER_HPP
 #define SHARE_SERVICES_MEMTRACKER_HPP
 
+#include "runtime/globals.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/threadCritical.hpp"
 #include "services/mallocTracker.hpp"
@@ -38,6 +39,13 @@
                     NativeCallStack(0) : NativeCallStack::empty_stack())
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : NativeCallStack::empty_stack())
+// CALLER_PC for malloc, which in detail mode only captures the stack of
+// one in NativeMemoryTrackingStackSampleInterval calls of a thread and
+// weighs it accordingly.
+#define MALLOC_CALLER_PC ((MemTracker::tracking_level() == NMT_detail &&          \
+                           MemTracker::sample_malloc_stack()) ?                  \
+                          MemTracker::sampled_malloc_stack(NativeCallStack(1)) : \
+                          MemTracker::unsampled_malloc_stack())
 
 class MemBaseline;
 
@@ -88,6 +96,27 @@ class MemTracker : AllStatic {
     return _tracking_level > NMT_off;
   }
 
+  // Returns true every NativeMemoryTrackingStackSampleInterval calls of a thread
+  static inline bool sample_malloc_stack() {
+    if (_malloc_stack_samples_skipped > 0) {
+      _malloc_stack_samples_skipped--;
+      return false;
+    }
+    _malloc_stack_samples_skipped = NativeMemoryTrackingStackSampleInterval - 1;
+    return true;
+  }
+
+  static inline NativeCallStack sampled_malloc_stack(NativeCallStack stack) {
+    stack.set_weight(NativeMemoryTrackingStackSampleInterval);
+    return stack;
+  }
+
+  static inline NativeCallStack unsampled_malloc_stack() {
+    NativeCallStack stack;
+    stack.set_weight(0);
+    return stack;
+  }
+
   // Per-malloc overhead incurred by NMT, depending on the current NMT level
   static size_t overhead_per_malloc() {
     return enabled() ? MallocTracker::overhead_per_malloc : 0;
@@ -242,6 +271,8 @@ class MemTracker : AllStatic {
   static bool                         _is_nmt_env_valid;
   // command line tracking level
   static NMT_TrackingLevel            _cmdline_tracking_level;
+  // Mallocs of the current thread left before the next stack sample
+  static THREAD_LOCAL uint            _malloc_stack_samples_skipped;
   // Stored baseline
   static MemBaseline      _baseline;
   // Query lock
@@ -69,6 +69,11 @@ PerfVariable* ThreadService::_daemon_threads_count = NULL;
 volatile int ThreadService::_atomic_threads_count = 0;
 volatile int ThreadService::_atomic_daemon_threads_count = 0;
 
+PerfVariable** ThreadService::_slot_tid = NULL;
+PerfVariable** ThreadService::_slot_allocated_bytes = NULL;
+PerfVariable** ThreadService::_slot_cpu_time = NULL;
+JavaThread**   ThreadService::_slot_owner = NULL;
+
 ThreadDumpResult* ThreadService::_threaddump_list = NULL;
 
 static const int INITIAL_ARRAY_SIZE = 10;
@@ -105,6 +110,30 @@ void ThreadService::init() {
 
   _thread_allocated_memory_enabled = true; // Always on, so enable it
 
+  // Per-thread counters are only useful to external readers of the
+  // hsperfdata file, so they are not created without UsePerfData.
+  if (UsePerfData && PerThreadPerfDataSlots > 0) {
+    const uint slots = PerThreadPerfDataSlots;
+    _slot_tid = NEW_C_HEAP_ARRAY(PerfVariable*, slots, mtServiceability);
+    _slot_allocated_bytes = NEW_C_HEAP_ARRAY(PerfVariable*, slots, mtServiceability);
+    _slot_cpu_time = NEW_C_HEAP_ARRAY(PerfVariable*, slots, mtServiceability);
+    _slot_owner = NEW_C_HEAP_ARRAY(JavaThread*, slots, mtServiceability);
+    for (uint i = 0; i < slots; i++) {
+      ResourceMark rm;
+      const char* ns = PerfDataManager::name_space("slot", (int)i);
+      _slot_tid[i] =
+                PerfDataManager::create_variable(SUN_THREADS, PerfDataManager::counter_name(ns, "tid"),
+                                                 PerfData::U_None, CHECK);
+      _slot_allocated_bytes[i] =
+                PerfDataManager::create_variable(SUN_THREADS, PerfDataManager::counter_name(ns, "allocatedBytes"),
+                                                 PerfData::U_Bytes, CHECK);
+      _slot_cpu_time[i] =
+                PerfDataManager::create_variable(SUN_THREADS, PerfDataManager::counter_name(ns, "cpuTimeNanos"),
+                                                 PerfData::U_None, CHECK);
+      _slot_owner[i] = NULL;
+    }
+  }
+
   // Initialize OopStorage for thread stack sampling walking
   _thread_service_storage = OopStorageSet::create_strong("ThreadService OopStorage",
                                                          mtServiceability);
@@ -132,6 +161,19 @@ void ThreadService::add_thread(JavaThread* thread, bool daemon) {
 
   _total_threads_count->inc();
   _live_threads_count->inc();
+
+  if (_slot_owner != NULL && thread->threadObj() != NULL) {
+    for (uint i = 0; i < PerThreadPerfDataSlots; i++) {
+      if (_slot_owner[i] == NULL) {
+        _slot_owner[i] = thread;
+        _slot_allocated_bytes[i]->set_value(0);
+        _slot_cpu_time[i]->set_value(0);
+        _slot_tid[i]->set_value(java_lang_Thread::thread_id(thread->threadObj()));
+        thread->set_perf_data_slot((int)i);
+        break;
+      }
+    }
+  }
   Atomic::inc(&_atomic_threads_count);
   int count = _atomic_threads_count;
 
@@ -145,6 +187,18 @@ void ThreadService::add_thread(JavaThread* thread, bool daemon) {
   }
 }
 
+void ThreadService::update_thread_perf_data(JavaThread* jt) {
+  assert(jt == Thread::current(), "only the owning thread updates its slot");
+  int slot = jt->perf_data_slot();
+  if (slot < 0) {
+    return;
+  }
+  _slot_allocated_bytes[slot]->set_value(jt->cooked_allocated_bytes());
+  if (_thread_cpu_time_enabled) {
+    _slot_cpu_time[slot]->set_value(os::current_thread_cpu_time());
+  }
+}
+
 void ThreadService::decrement_thread_counts(JavaThread* jt, bool daemon) {
   Atomic::dec(&_atomic_threads_count);
 
@@ -167,6 +221,14 @@ void ThreadService::remove_thread(JavaThread* thread, bool daemon) {
     decrement_thread_counts(thread, daemon);
   }
 
+  int slot = thread->perf_data_slot();
+  if (slot >= 0) {
+    assert(_slot_owner[slot] == thread, "slot owned by another thread");
+    thread->set_perf_data_slot(-1);
+    _slot_tid[slot]->set_value(0);
+    _slot_owner[slot] = NULL;
+  }
+
   int daemon_count = _atomic_daemon_threads_count;
   int count = _atomic_threads_count;
 
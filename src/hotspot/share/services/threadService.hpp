@@ -67,6 +67,12 @@ private:
   static volatile int  _atomic_threads_count;
   static volatile int  _atomic_daemon_threads_count;
 
+  // Per-thread PerfData slots, see PerThreadPerfDataSlots
+  static PerfVariable** _slot_tid;
+  static PerfVariable** _slot_allocated_bytes;
+  static PerfVariable** _slot_cpu_time;
+  static JavaThread**   _slot_owner;
+
   static bool          _thread_monitoring_contention_enabled;
   static bool          _thread_cpu_time_enabled;
   static bool          _thread_allocated_memory_enabled;
@@ -84,6 +90,10 @@ public:
   static void remove_thread(JavaThread* thread, bool daemon);
   static void current_thread_exiting(JavaThread* jt, bool daemon);
 
+  // Publish the current thread's allocated bytes and CPU time in its
+  // per-thread PerfData slot, if it has one.
+  static void update_thread_perf_data(JavaThread* jt);
+
   static bool set_thread_monitoring_contention(bool flag);
   static bool is_thread_monitoring_contention() { return _thread_monitoring_contention_enabled; }
 
@@ -627,11 +627,47 @@ void BitMap::clear_large() {
   clear_large_range_of_words(0, size_in_words());
 }
 
+// Carry-save adder: adds the bits of a, b and c position-wise, giving the
+// sum bits in l and the carry bits in h.
+static inline void csa(BitMap::bm_word_t& h, BitMap::bm_word_t& l,
+                       BitMap::bm_word_t a, BitMap::bm_word_t b, BitMap::bm_word_t c) {
+  BitMap::bm_word_t u = a ^ b;
+  h = (a & b) | (u & c);
+  l = u ^ c;
+}
+
+// Uses the Harley-Seal method (Hacker's Delight, 2nd Edition, Figure 5-8)
+// for runs of eight words: a tree of carry-save adders folds them into
+// ones/twos/fours/eights accumulators, and only the eights word is
+// population counted per iteration. This takes one population_count() per
+// eight words instead of one per word when counting large dense ranges.
 BitMap::idx_t BitMap::count_one_bits_in_range_of_words(idx_t beg_full_word, idx_t end_full_word) const {
+  const bm_word_t* const words = map();
+  idx_t i = beg_full_word;
   idx_t sum = 0;
-  for (idx_t i = beg_full_word; i < end_full_word; i++) {
-    bm_word_t w = map()[i];
-    sum += population_count(w);
+
+  if (end_full_word - beg_full_word >= 8) {
+    bm_word_t ones = 0, twos = 0, fours = 0;
+    bm_word_t twos_a, twos_b, fours_a, fours_b, eights;
+    idx_t eights_count = 0;
+    for (; i + 8 <= end_full_word; i += 8) {
+      csa(twos_a, ones, ones, words[i], words[i + 1]);
+      csa(twos_b, ones, ones, words[i + 2], words[i + 3]);
+      csa(fours_a, twos, twos, twos_a, twos_b);
+      csa(twos_a, ones, ones, words[i + 4], words[i + 5]);
+      csa(twos_b, ones, ones, words[i + 6], words[i + 7]);
+      csa(fours_b, twos, twos, twos_a, twos_b);
+      csa(eights, fours, fours, fours_a, fours_b);
+      eights_count += population_count(eights);
+    }
+    sum = 8 * eights_count +
+          4 * population_count(fours) +
+          2 * population_count(twos) +
+          population_count(ones);
+  }
+
+  for (; i < end_full_word; i++) {
+    sum += population_count(words[i]);
   }
   return sum;
 }
@@ -35,6 +35,14 @@ void* GrowableArrayResourceAllocator::allocate(int max, int elementSize) {
   return (void*)resource_allocate_bytes(byte_size);
 }
 
+void* GrowableArrayResourceAllocator::reallocate(void* mem, int old_max, int max, int element_size) {
+  assert(old_max >= 0 && max >= old_max, "integer overflow");
+  size_t old_byte_size = element_size * (size_t) old_max;
+  size_t byte_size = element_size * (size_t) max;
+
+  return (void*)resource_reallocate_bytes((char*)mem, old_byte_size, byte_size);
+}
+
 void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* arena) {
   assert(max >= 0, "integer overflow");
   size_t byte_size = element_size * (size_t) max;
@@ -42,6 +50,14 @@ void* GrowableArrayArenaAllocator::allocate(int max, int element_size, Arena* ar
   return arena->Amalloc(byte_size);
 }
 
+void* GrowableArrayArenaAllocator::reallocate(void* mem, int old_max, int max, int element_size, Arena* arena) {
+  assert(old_max >= 0 && max >= old_max, "integer overflow");
+  size_t old_byte_size = element_size * (size_t) old_max;
+  size_t byte_size = element_size * (size_t) max;
+
+  return arena->Arealloc(mem, old_byte_size, byte_size);
+}
+
 void* GrowableArrayCHeapAllocator::allocate(int max, int element_size, MEMFLAGS memflags) {
   assert(max >= 0, "integer overflow");
   size_t byte_size = element_size * (size_t) max;
@@ -51,6 +67,14 @@ void* GrowableArrayCHeapAllocator::allocate(int max, int element_size, MEMFLAGS
   return (void*)AllocateHeap(byte_size, memflags);
 }
 
+void* GrowableArrayCHeapAllocator::reallocate(void* mem, int max, int element_size, MEMFLAGS memflags) {
+  assert(max >= 0, "integer overflow");
+  size_t byte_size = element_size * (size_t) max;
+
+  assert(memflags != mtNone, "memory type not specified for C heap object");
+  return (void*)ReallocateHeap((char*)mem, byte_size, memflags);
+}
+
 void GrowableArrayCHeapAllocator::deallocate(void* elements) {
   FreeHeap(elements);
 }
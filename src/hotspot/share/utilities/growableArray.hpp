@@ -31,6 +31,7 @@
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/powerOfTwo.hpp"
+#include <type_traits>
 
 // A growable array.
 
@@ -355,6 +356,8 @@ const GrowableArrayView<E> GrowableArrayView<E>::EMPTY(nullptr, 0, 0);
 //
 // Derived: The sub-class responsible for allocation / deallocation
 //  - E* Derived::allocate()       - member function responsible for allocation
+//  - E* Derived::reallocate(int)  - member function resizing the current data array
+//                                   from the given old max to _max, in place if possible
 //  - void Derived::deallocate(E*) - member function responsible for deallocation
 template <typename E, typename Derived>
 class GrowableArrayWithAllocator : public GrowableArrayView<E> {
@@ -493,6 +496,15 @@ void GrowableArrayWithAllocator<E, Derived>::grow(int j) {
   // grow the array by increasing _max to the first power of two larger than the size we need
   this->_max = next_power_of_2((uint32_t)j);
   // j < _max
+  if (std::is_trivially_copyable<E>::value && std::is_trivially_destructible<E>::value) {
+    // Elements can be moved as raw bytes, so let the allocator resize the
+    // block: arenas extend it in place when it is their latest allocation,
+    // and the C heap uses realloc.
+    E* newData = static_cast<Derived*>(this)->reallocate(old_max);
+    for (int i = old_max; i < this->_max; i++) ::new ((void*)&newData[i]) E();
+    this->_data = newData;
+    return;
+  }
   E* newData = static_cast<Derived*>(this)->allocate();
   int i = 0;
   for (     ; i < this->_len; i++) ::new ((void*)&newData[i]) E(this->_data[i]);
@@ -520,18 +532,21 @@ void GrowableArrayWithAllocator<E, Derived>::clear_and_deallocate() {
 class GrowableArrayResourceAllocator {
 public:
   static void* allocate(int max, int element_size);
+  static void* reallocate(void* mem, int old_max, int max, int element_size);
 };
 
 // Arena allocator
 class GrowableArrayArenaAllocator {
 public:
   static void* allocate(int max, int element_size, Arena* arena);
+  static void* reallocate(void* mem, int old_max, int max, int element_size, Arena* arena);
 };
 
 // CHeap allocator
 class GrowableArrayCHeapAllocator {
 public:
   static void* allocate(int max, int element_size, MEMFLAGS memflags);
+  static void* reallocate(void* mem, int max, int element_size, MEMFLAGS memflags);
   static void deallocate(void* mem);
 };
 
@@ -672,6 +687,20 @@ class GrowableArray : public GrowableArrayWithAllocator<E, GrowableArray<E> > {
     return allocate(this->_max, _metadata.arena());
   }
 
+  E* reallocate(int old_max) {
+    if (on_stack()) {
+      debug_only(_metadata.on_stack_alloc_check());
+      return (E*)GrowableArrayResourceAllocator::reallocate(this->_data, old_max, this->_max, sizeof(E));
+    }
+
+    if (on_C_heap()) {
+      return (E*)GrowableArrayCHeapAllocator::reallocate(this->_data, this->_max, sizeof(E), _metadata.memflags());
+    }
+
+    assert(on_arena(), "Sanity");
+    return (E*)GrowableArrayArenaAllocator::reallocate(this->_data, old_max, this->_max, sizeof(E), _metadata.arena());
+  }
+
   void deallocate(E* mem) {
     if (on_C_heap()) {
       GrowableArrayCHeapAllocator::deallocate(mem);
@@ -731,6 +760,10 @@ class GrowableArrayCHeap : public GrowableArrayWithAllocator<E, GrowableArrayCHe
     return allocate(this->_max, F);
   }
 
+  E* reallocate(int old_max) {
+    return (E*)GrowableArrayCHeapAllocator::reallocate(this->_data, this->_max, sizeof(E), F);
+  }
+
   void deallocate(E* mem) {
     GrowableArrayCHeapAllocator::deallocate(mem);
   }
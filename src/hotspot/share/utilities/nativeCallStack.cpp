@@ -30,7 +30,7 @@
 
 const NativeCallStack NativeCallStack::_empty_stack; // Uses default ctor
 
-NativeCallStack::NativeCallStack(int toSkip) {
+NativeCallStack::NativeCallStack(int toSkip) : _weight(1) {
 
   // We need to skip the NativeCallStack::NativeCallStack frame if a tail call is NOT used
   // to call os::get_native_stack. A tail call is used if _NMT_NOINLINE_ is not defined
@@ -48,7 +48,7 @@ NativeCallStack::NativeCallStack(int toSkip) {
   os::get_native_stack(_stack, NMT_TrackingStackDepth, toSkip);
 }
 
-NativeCallStack::NativeCallStack(address* pc, int frameCount) {
+NativeCallStack::NativeCallStack(address* pc, int frameCount) : _weight(1) {
   int frameToCopy = (frameCount < NMT_TrackingStackDepth) ?
     frameCount : NMT_TrackingStackDepth;
   int index;
@@ -56,11 +56,13 @@ class MemTracker;
 class NativeCallStack : public StackObj {
 private:
   address       _stack[NMT_TrackingStackDepth];
+  // Number of allocations this stack stands for, see MALLOC_CALLER_PC
+  uint          _weight;
   static const NativeCallStack _empty_stack;
 public:
   // Default ctor creates an empty stack.
   // (it may make sense to remove this altogether but its used in a few places).
-  NativeCallStack() {
+  NativeCallStack() : _weight(1) {
     memset(_stack, 0, sizeof(_stack));
   }
 
@@ -77,6 +79,12 @@ public:
   // number of stack frames captured
   int frames() const;
 
+  // A stack captured for one in every weight allocations stands for all of
+  // them; a weight of 0 means the allocation was not sampled. Not part of
+  // the identity of the stack.
+  inline uint weight() const          { return _weight; }
+  inline void set_weight(uint weight) { _weight = weight; }
+
   inline int compare(const NativeCallStack& other) const {
     return memcmp(_stack, other._stack, sizeof(_stack));
   }
@@ -194,6 +194,10 @@ public:
   E  next() { return *next_addr(); }
   E* next_addr();
 
+  // Return the address of the first of the items remaining in the current
+  // segment, store their number in size and move on to the next segment.
+  E* next_segment(size_t* size);
+
   void sync(); // Sync the iterator's state to the stack's current state.
 
 private:
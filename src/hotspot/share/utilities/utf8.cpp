@@ -332,21 +332,18 @@ jint UTF8::get_supplementary_character(const unsigned char* str) {
 bool UTF8::is_legal_utf8(const unsigned char* buffer, int length,
                          bool version_leq_47) {
   int i = 0;
-  int count = length >> 2;
-  for (int k=0; k<count; k++) {
-    unsigned char b0 = buffer[i];
-    unsigned char b1 = buffer[i+1];
-    unsigned char b2 = buffer[i+2];
-    unsigned char b3 = buffer[i+3];
-    // For an unsigned char v,
-    // (v | v - 1) is < 128 (highest bit 0) for 0 < v < 128;
-    // (v | v - 1) is >= 128 (highest bit 1) for v == 0 or v >= 128.
-    unsigned char res = b0 | b0 - 1 |
-                        b1 | b1 - 1 |
-                        b2 | b2 - 1 |
-                        b3 | b3 - 1;
-    if (res >= 128) break;
-    i += 4;
+  // Skip the leading pure ASCII part eight bytes at a time. For a word v,
+  // ((v - 0x01..01) & ~v) has the high bit of a byte set if that byte (or a
+  // lower one) is zero, and v itself has it set for any byte >= 128, so
+  // the word is plain non-zero ASCII iff neither has any high bit set.
+  const uint64_t ones = CONST64(0x0101010101010101);
+  const uint64_t highs = CONST64(0x8080808080808080);
+  int count = length >> 3;
+  for (int k = 0; k < count; k++) {
+    uint64_t v;
+    memcpy(&v, buffer + i, sizeof(v));
+    if ((((v - ones) & ~v) | v) & highs) break;
+    i += 8;
   }
   for(; i < length; i++) {
     unsigned short c;
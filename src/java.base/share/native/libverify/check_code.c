@@ -3557,19 +3557,21 @@ CCalloc(context_type *context, int size, jboolean zero)
 
     if (context->CCfree_size <  size) {
         struct CCpool *current = context->CCcurrent;
-        struct CCpool *new;
-        if (size > CCSegSize) { /* we need to allocate a special block */
-            new = (struct CCpool *)malloc(sizeof(struct CCpool) +
-                                          (size - CCSegSize));
-            if (new == 0) {
-                CCout_of_memory(context);
-            }
-            new->next = current->next;
-            new->segSize = size;
-            current->next = new;
-        } else {
-            new = current->next;
-            if (new == NULL) {
+        struct CCpool *new = current->next;
+        /* Segments left over from earlier methods, including special
+         * blocks, are reused when they are large enough.
+         */
+        if (new == NULL || new->segSize < size) {
+            if (size > CCSegSize) { /* we need to allocate a special block */
+                new = (struct CCpool *)malloc(sizeof(struct CCpool) +
+                                              (size - CCSegSize));
+                if (new == 0) {
+                    CCout_of_memory(context);
+                }
+                new->next = current->next;
+                new->segSize = size;
+                current->next = new;
+            } else {
                 new = (struct CCpool *) malloc(sizeof(struct CCpool));
                 if (new == 0) {
                     CCout_of_memory(context);
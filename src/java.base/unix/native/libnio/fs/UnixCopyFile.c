@@ -31,6 +31,8 @@
 #include <errno.h>
 
 #if defined(__linux__)
+#include <dlfcn.h>
+#include <sys/ioctl.h>
 #include <sys/sendfile.h>
 #elif defined(_ALLBSD_SOURCE)
 #include <copyfile.h>
@@ -51,6 +53,70 @@ static void throwUnixException(JNIEnv* env, int errnum) {
     }
 }
 
+#if defined(__linux__)
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+
+// copy_file_range(2) is looked up at run time as it is only declared by glibc 2.27+
+typedef ssize_t copy_file_range_func(int, loff_t*, int, loff_t*, size_t, unsigned int);
+
+static copy_file_range_func* my_copy_file_range_func = NULL;
+static volatile jint copy_file_range_looked_up = 0;
+
+static copy_file_range_func* copy_file_range_function() {
+    if (copy_file_range_looked_up == 0) {
+        my_copy_file_range_func =
+            (copy_file_range_func*) dlsym(RTLD_DEFAULT, "copy_file_range");
+        copy_file_range_looked_up = 1;
+    }
+    return my_copy_file_range_func;
+}
+
+/**
+ * Transfer all bytes from src to dst with copy_file_range, which lets the
+ * file system copy without going through the page cache, or share extents
+ * where supported. Returns 1 if done (or an exception is pending), 0 if the
+ * caller should fall back to another method.
+ */
+static int transfer_copy_file_range(JNIEnv* env, jint dst, jint src, volatile jint* cancel)
+{
+    copy_file_range_func* cfr = copy_file_range_function();
+    if (cfr == NULL) {
+        return 0;
+    }
+    const size_t count = cancel != NULL ?
+        1048576 :   // 1 MB to give cancellation a chance
+        0x7ffff000; // maximum number of bytes that can be transferred per call
+    ssize_t bytes_sent;
+    jlong total = 0;
+    do {
+        RESTARTABLE(cfr(src, NULL, dst, NULL, count, 0), bytes_sent);
+        if (bytes_sent == -1) {
+            if (total == 0 && (errno == EXDEV || errno == EINVAL || errno == ENOSYS ||
+                               errno == EOPNOTSUPP || errno == EPERM || errno == EBADF)) {
+                // Not supported for these files, e.g. across file systems before Linux 5.3
+                return 0;
+            }
+            throwUnixException(env, errno);
+            return 1;
+        }
+        if (bytes_sent == 0 && total == 0) {
+            // Nothing copied at all. Files in procfs or sysfs report a size of
+            // zero, and copy_file_range returns 0 for them on Linux 5.3+ instead
+            // of failing, so let the caller copy them by reading instead.
+            return 0;
+        }
+        total += bytes_sent;
+        if (cancel != NULL && *cancel != 0) {
+            throwUnixException(env, ECANCELED);
+            return 1;
+        }
+    } while (bytes_sent > 0);
+    return 1;
+}
+#endif
+
 #if defined(_ALLBSD_SOURCE)
 int fcopyfile_callback(int what, int stage, copyfile_state_t state,
     const char* src, const char* dst, void* cancel)
@@ -112,6 +178,18 @@ Java_sun_nio_fs_UnixCopyFile_transfer
     volatile jint* cancel = (jint*)jlong_to_ptr(cancelAddress);
 
 #if defined(__linux__)
+    // Share the extents of src with dst (reflink) on file systems that support
+    // it, such as btrfs and xfs. This clones the whole file, so it is only
+    // correct while both files are still at offset 0, as they are for a copy.
+    if (lseek(src, 0, SEEK_CUR) == 0 && lseek(dst, 0, SEEK_CUR) == 0 &&
+        ioctl(dst, FICLONE, src) == 0) {
+        return;
+    }
+
+    if (transfer_copy_file_range(env, dst, src, cancel)) {
+        return;
+    }
+
     // Transfer within the kernel
     const size_t count = cancel != NULL ?
         1048576 :   // 1 MB to give cancellation a chance
@@ -251,10 +251,8 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_glyph_info_t *glyphInfo;
      hb_glyph_position_t *glyphPos;
      hb_direction_t direction = HB_DIRECTION_LTR;
-     hb_feature_t *features = NULL;
+     hb_feature_t features[2];
      int featureCount = 0;
-     char* kern = (flags & TYPO_KERN) ? "kern" : "-kern";
-     char* liga = (flags & TYPO_LIGA) ? "liga" : "-liga";
      jboolean ret;
      unsigned int buflen;
 
@@ -292,11 +290,16 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
 
      hb_buffer_add_utf16(buffer, chars, len, offset, limit-offset);
 
-     features = calloc(2, sizeof(hb_feature_t));
-     if (features) {
-         hb_feature_from_string(kern, -1, &features[featureCount++]);
-         hb_feature_from_string(liga, -1, &features[featureCount++]);
-     }
+     /* Same as parsing "kern"/"-kern" and "liga"/"-liga" with
+      * hb_feature_from_string, without doing that for every run. */
+     features[featureCount].tag = HB_TAG('k','e','r','n');
+     features[featureCount].value = (flags & TYPO_KERN) ? 1 : 0;
+     features[featureCount].start = HB_FEATURE_GLOBAL_START;
+     features[featureCount++].end = HB_FEATURE_GLOBAL_END;
+     features[featureCount].tag = HB_TAG('l','i','g','a');
+     features[featureCount].value = (flags & TYPO_LIGA) ? 1 : 0;
+     features[featureCount].start = HB_FEATURE_GLOBAL_START;
+     features[featureCount++].end = HB_FEATURE_GLOBAL_END;
 
      hb_shape_full(hbfont, buffer, features, featureCount, 0);
      glyphCount = hb_buffer_get_length(buffer);
@@ -310,7 +313,6 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_buffer_destroy (buffer);
      hb_font_destroy(hbfont);
      free((void*)jdkFontInfo);
-     if (features != NULL) free(features);
      (*env)->ReleaseCharArrayElements(env, text, chars, JNI_ABORT);
      return ret;
 }
@@ -101,6 +101,7 @@ struct core_data {
    // part of the class sharing workaround
    map_info*          class_share_maps;// class share maps in a linked list
    map_info**         map_array; // sorted (by vaddr) array of map_info pointers
+   map_info*          last_map;  // map_info returned by the last map_array lookup
 };
 
 struct ps_prochandle {
@@ -84,6 +84,7 @@ static bool sort_map_array(struct ps_prochandle* ph) {
   }
 
   ph->core->map_array = array;
+  ph->core->last_map = NULL;
   // sort the map_info array by base virtual address.
   qsort(ph->core->map_array, ph->core->num_maps, sizeof (map_info*),
         core_cmp_mapping);
@@ -107,7 +108,10 @@ static bool sort_map_array(struct ps_prochandle* ph) {
 
 static bool core_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
    ssize_t resid = size;
-   int page_size=sysconf(_SC_PAGE_SIZE);
+   static int page_size = 0;
+   if (page_size == 0) {
+      page_size = sysconf(_SC_PAGE_SIZE);
+   }
    while (resid != 0) {
       map_info *mp = core_lookup(ph, addr);
       uintptr_t mapoff;
@@ -616,6 +616,24 @@ eventFilterRestricted_passesUnloadFilter(JNIEnv *env,
     return JNI_TRUE;
 }
 
+/* Return true if any of the handler's filters matches against the
+ * class name, so the caller only has to compute it when needed.
+ */
+jboolean
+eventFilterRestricted_needsClassname(HandlerNode *node)
+{
+    Filter *filter = FILTERS_ARRAY(node);
+    int i;
+
+    for (i = 0; i < FILTER_COUNT(node); ++i, ++filter) {
+        if (filter->modifier == JDWP_REQUEST_MODIFIER(ClassMatch) ||
+            filter->modifier == JDWP_REQUEST_MODIFIER(ClassExclude)) {
+            return JNI_TRUE;
+        }
+    }
+    return JNI_FALSE;
+}
+
 /**
  * This function returns true only if it is certain that
  * all events for the given node in the given stack frame will
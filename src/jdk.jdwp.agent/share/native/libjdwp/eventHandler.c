@@ -546,6 +546,7 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
     {
         HandlerNode *node;
         char        *classname;
+        jboolean     classnameKnown;
 
         /* We must keep track of all classes prepared to know what's unloaded */
         if (evinfo->ei == EI_CLASS_PREPARE) {
@@ -553,7 +554,11 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
         }
 
         node = getHandlerChain(ei)->first;
-        classname = getClassname(evinfo->clazz);
+        /* The class name is only fetched once a ClassMatch or
+         * ClassExclude filter needs it.
+         */
+        classname = NULL;
+        classnameKnown = JNI_FALSE;
 
         /* Filter the event over each handler node. */
         while (node != NULL) {
@@ -561,6 +566,10 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
             HandlerNode *next = NEXT(node);
             jboolean shouldDelete;
 
+            if (!classnameKnown && eventFilterRestricted_needsClassname(node)) {
+                classname = getClassname(evinfo->clazz);
+                classnameKnown = JNI_TRUE;
+            }
             if (eventFilterRestricted_passesFilter(env, classname,
                                                    evinfo, node,
                                                    &shouldDelete)) {
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1LinearRegression.hpp"
+#include "unittest.hpp"
+
+static const double epsilon = 1e-6;
+
+TEST_VM(G1LinearRegression, empty) {
+  G1LinearRegression model(0.7);
+
+  ASSERT_EQ(0u, model.num_samples());
+  ASSERT_NEAR(0.0, model.slope(), epsilon);
+  ASSERT_NEAR(0.0, model.intercept(), epsilon);
+  ASSERT_NEAR(0.0, model.predict(100.0), epsilon);
+  ASSERT_NEAR(0.0, model.residual_stddev(), epsilon);
+}
+
+// A single x value can not be fitted; the model must be proportional.
+TEST_VM(G1LinearRegression, proportional_fallback) {
+  G1LinearRegression model(0.7);
+
+  for (int i = 0; i < 5; i++) {
+    model.add(10.0, 5.0);
+  }
+  ASSERT_NEAR(0.5, model.slope(), epsilon);
+  ASSERT_NEAR(0.0, model.intercept(), epsilon);
+  ASSERT_NEAR(10.0, model.predict(20.0), epsilon);
+  ASSERT_NEAR(0.0, model.residual_stddev(), epsilon);
+}
+
+TEST_VM(G1LinearRegression, exact_fit) {
+  G1LinearRegression model(0.7);
+
+  for (int i = 1; i <= 10; i++) {
+    double x = i * 1000.0;
+    model.add(x, 2.0 + 0.001 * x);
+  }
+  ASSERT_NEAR(0.001, model.slope(), epsilon);
+  ASSERT_NEAR(2.0, model.intercept(), epsilon);
+  ASSERT_NEAR(12.0, model.predict(10000.0), epsilon);
+}
+
+// Time decreasing with work must not result in a negative slope.
+TEST_VM(G1LinearRegression, negative_slope) {
+  G1LinearRegression model(0.7);
+
+  model.add(1.0, 4.0);
+  model.add(2.0, 3.0);
+  model.add(3.0, 2.0);
+  ASSERT_GE(model.slope(), 0.0);
+  ASSERT_NEAR(0.0, model.intercept(), epsilon);
+  ASSERT_GE(model.predict(0.0), 0.0);
+}
+
+// Newer samples dominate older ones.
+TEST_VM(G1LinearRegression, decay) {
+  G1LinearRegression model(0.5);
+
+  for (int i = 1; i <= 10; i++) {
+    model.add(i, 1.0 * i);
+  }
+  for (int i = 1; i <= 30; i++) {
+    model.add(i % 10 + 1, 3.0 * (i % 10 + 1));
+  }
+  ASSERT_NEAR(3.0, model.slope(), 0.01);
+  ASSERT_GT(model.residual_stddev(), 0.0);
+}
@@ -516,6 +516,30 @@ TEST_VM_F(OopStorageTest, bulk_allocation) {
   }
 }
 
+TEST_VM_F(OopStorageTest, allocation_cache) {
+  static const size_t num_entries = 3 * OopStorageAllocationCache::cache_size / 2;
+  oop* entries[num_entries] = {};
+
+  OopStorageAllocationCache* cache = new OopStorageAllocationCache(&_storage);
+  size_t lock_count = _storage.allocation_lock_count();
+  for (size_t i = 0; i < num_entries; ++i) {
+    entries[i] = cache->allocate();
+    ASSERT_TRUE(entries[i] != NULL);
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, _storage.allocation_status(entries[i]));
+    EXPECT_TRUE(*entries[i] == NULL);
+  }
+  // Two refills of the empty cache.
+  EXPECT_EQ(lock_count + 2, _storage.allocation_lock_count());
+  EXPECT_EQ(2 * OopStorageAllocationCache::cache_size, _storage.allocation_count());
+
+  // Deleting the cache releases the cached but unused entries.
+  delete cache;
+  EXPECT_EQ(num_entries, _storage.allocation_count());
+
+  _storage.release(entries, num_entries);
+  EXPECT_EQ(0u, _storage.allocation_count());
+}
+
 #ifndef DISABLE_GARBAGE_ALLOCATION_STATUS_TESTS
 TEST_VM_F(OopStorageTest, invalid_pointer) {
   {
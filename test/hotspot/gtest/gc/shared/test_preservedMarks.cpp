@@ -86,3 +86,36 @@ TEST_VM(PreservedMarks, iterate_and_restore) {
   ASSERT_MARK_WORD_EQ(o3.mark(), FakeOop::changedMark());
   ASSERT_MARK_WORD_EQ(o4.mark(), FakeOop::changedMark());
 }
+
+TEST_VM(PreservedMarksSet, restore_multiple_segments) {
+  // Use enough objects to fill several stack segments.
+  const size_t num_objects = 1000;
+  FakeOop* objects = NEW_C_HEAP_ARRAY(FakeOop, num_objects, mtGC);
+  for (size_t i = 0; i < num_objects; ++i) {
+    ::new (objects + i) FakeOop();
+  }
+
+  PreservedMarksSet pms(true /* in_c_heap */);
+  pms.init(2);
+  for (size_t i = 0; i < num_objects; ++i) {
+    objects[i].set_mark(FakeOop::changedMark());
+    // Put almost all marks into the first stack.
+    pms.get(i % 100 == 0 ? 1 : 0)->push_if_necessary(objects[i].get_oop(), objects[i].mark());
+    objects[i].set_mark(FakeOop::originalMark());
+  }
+  ASSERT_EQ(num_objects, pms.get(0)->size() + pms.get(1)->size());
+
+  // The chunk count is the cost estimate of the parallel restore.
+  GrowableArrayCHeap<PreservedMarks::Chunk, mtGC> chunks;
+  pms.get(0)->add_chunks(&chunks);
+  pms.get(1)->add_chunks(&chunks);
+  ASSERT_EQ((size_t)chunks.length(), pms.num_chunks());
+  ASSERT_LT((size_t)2, pms.num_chunks());
+
+  pms.restore(NULL);
+  for (size_t i = 0; i < num_objects; ++i) {
+    ASSERT_MARK_WORD_EQ(objects[i].mark(), FakeOop::changedMark());
+  }
+  pms.reclaim();
+  FREE_C_HEAP_ARRAY(FakeOop, objects);
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "gc/shared/taskTerminator.hpp"
+#include "gc/shared/workerThread.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+
+#include "unittest.hpp"
+
+// Work stealing with and without batched steals.  All work starts as the root
+// of a binary tree on the queue of the first worker, and every task pushes
+// its two children until the leaves are reached, so the other workers depend
+// on stealing to get work.  Tasks are the indices of the nodes of the tree,
+// which verifies that every pushed task is popped or stolen exactly once.
+
+const uint _max_workers = 8;
+const size_t _tree_depth = 16;
+const size_t _num_nodes = ((size_t)2 << _tree_depth) - 1;
+const size_t _first_leaf = ((size_t)1 << _tree_depth) - 1;
+
+typedef OverflowTaskQueue<size_t, mtGC> TestTaskQueue;
+typedef GenericTaskQueueSet<TestTaskQueue, mtGC> TestTaskQueueSet;
+
+class TaskQueueSteal : public ::testing::Test {
+public:
+  class Task;
+
+  static WorkerThreads* workers();
+  static uint num_workers();
+
+  void run_test(uint nthreads, uint batch);
+
+private:
+  static WorkerThreads* _workers;
+};
+
+WorkerThreads* TaskQueueSteal::_workers = NULL;
+
+uint TaskQueueSteal::num_workers() {
+  return MIN2(_max_workers, (uint)os::processor_count());
+}
+
+WorkerThreads* TaskQueueSteal::workers() {
+  if (_workers == NULL) {
+    WorkerThreads* wg = new WorkerThreads("TaskQueueSteal workers", num_workers());
+    wg->initialize_workers();
+    wg->set_active_workers(num_workers());
+    _workers = wg;
+  }
+  return _workers;
+}
+
+class TaskQueueSteal::Task : public WorkerTask {
+  TestTaskQueueSet* _queues;
+  TaskTerminator _terminator;
+  uint _batch;
+  // The number of times each node of the tree has been processed.
+  volatile uint* _processed;
+
+  void process(TestTaskQueue* queue, size_t node) {
+    Atomic::inc(&_processed[node]);
+    if (node < _first_leaf) {
+      queue->push(2 * node + 1);
+      queue->push(2 * node + 2);
+    }
+  }
+
+public:
+  Task(TestTaskQueueSet* queues, uint nthreads, uint batch) :
+    WorkerTask("TaskQueueSteal::Task"),
+    _queues(queues),
+    _terminator(nthreads, queues),
+    _batch(batch),
+    _processed(NEW_C_HEAP_ARRAY(uint, _num_nodes, mtInternal))
+  {
+    for (size_t i = 0; i < _num_nodes; ++i) {
+      _processed[i] = 0;
+    }
+  }
+
+  ~Task() {
+    FREE_C_HEAP_ARRAY(uint, _processed);
+  }
+
+  virtual void work(uint worker_id) {
+    TestTaskQueue* queue = _queues->queue(worker_id);
+    size_t node;
+    while (true) {
+      while (queue->pop_overflow(node) || queue->pop_local(node)) {
+        process(queue, node);
+      }
+      if (_queues->steal(worker_id, node, _batch)) {
+        process(queue, node);
+        continue;
+      }
+      if (_terminator.offer_termination()) {
+        break;
+      }
+    }
+  }
+
+  uint processed(size_t node) const { return Atomic::load(&_processed[node]); }
+};
+
+void TaskQueueSteal::run_test(uint nthreads, uint batch) {
+  if (nthreads > num_workers()) {
+    return;
+  }
+
+  TestTaskQueueSet queues(nthreads);
+  for (uint i = 0; i < nthreads; ++i) {
+    TestTaskQueue* queue = new TestTaskQueue();
+    queues.register_queue(i, queue);
+  }
+  queues.queue(0)->push(0);
+
+  Task task(&queues, nthreads, batch);
+  workers()->run_task(&task, nthreads);
+
+  for (size_t i = 0; i < _num_nodes; ++i) {
+    ASSERT_EQ(1u, task.processed(i)) << "node " << i << ", " << nthreads << " threads, batch " << batch;
+  }
+  for (uint i = 0; i < nthreads; ++i) {
+    EXPECT_TRUE(queues.queue(i)->is_empty());
+    delete queues.queue(i);
+  }
+}
+
+TEST_VM_F(TaskQueueSteal, every_task_processed_once) {
+  const uint batches[] = { 1, 4, 16, 64 };
+  for (uint nthreads = 2; nthreads <= _max_workers; nthreads *= 2) {
+    for (size_t i = 0; i < ARRAY_SIZE(batches); ++i) {
+      run_test(nthreads, batches[i]);
+    }
+  }
+}
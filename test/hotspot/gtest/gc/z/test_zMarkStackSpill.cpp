@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zMarkStackSpill.hpp"
+#include "unittest.hpp"
+
+static ZMarkStackEntry object_entry(size_t i) {
+  // Mostly increasing addresses, with occasional large jumps
+  const uintptr_t addr = (i % 17 == 0) ? (uintptr_t)1 << (i % 50) : i * 24;
+  return ZMarkStackEntry(addr, i % 2 == 0, i % 3 == 0, i % 5 == 0, i % 7 == 0);
+}
+
+static ZMarkStackEntry partial_array_entry(size_t i) {
+  return ZMarkStackEntry(i * 4096, i + 1, i % 2 == 0);
+}
+
+static ZMarkStackEntry entry(size_t chunk, size_t i) {
+  return (chunk % 2 == 0) ? object_entry(chunk * ZMarkStackSlots + i)
+                          : partial_array_entry(chunk * ZMarkStackSlots + i);
+}
+
+TEST_VM(ZMarkStackSpill, spill_unspill) {
+  ZMarkStackSpill spill;
+  ZMarkStackEntry entries[ZMarkStackSlots];
+
+  EXPECT_TRUE(spill.is_empty());
+  EXPECT_EQ(spill.unspill(entries, ZMarkStackSlots), 0u);
+
+  // Spill enough chunks to need more than one segment
+  const size_t nchunks = 2 * ZMarkStackSpillSegmentSize / ZMarkStackSize;
+  for (size_t chunk = 0; chunk < nchunks; chunk++) {
+    const size_t nentries = ZMarkStackSlots - (chunk % ZMarkStackSlots);
+    for (size_t i = 0; i < nentries; i++) {
+      entries[i] = entry(chunk, i);
+    }
+    spill.spill(entries, nentries);
+    EXPECT_FALSE(spill.is_empty());
+  }
+
+  // Chunks are unspilled in reverse order
+  for (size_t chunk = nchunks; chunk > 0; chunk--) {
+    const size_t nentries = spill.unspill(entries, ZMarkStackSlots);
+    ASSERT_EQ(nentries, ZMarkStackSlots - ((chunk - 1) % ZMarkStackSlots));
+
+    for (size_t i = 0; i < nentries; i++) {
+      const ZMarkStackEntry expected = entry(chunk - 1, i);
+      ASSERT_EQ(entries[i].partial_array(), expected.partial_array());
+      ASSERT_EQ(entries[i].finalizable(), expected.finalizable());
+      if (expected.partial_array()) {
+        ASSERT_EQ(entries[i].partial_array_offset(), expected.partial_array_offset());
+        ASSERT_EQ(entries[i].partial_array_length(), expected.partial_array_length());
+      } else {
+        ASSERT_EQ(entries[i].object_address(), expected.object_address());
+        ASSERT_EQ(entries[i].mark(), expected.mark());
+        ASSERT_EQ(entries[i].inc_live(), expected.inc_live());
+        ASSERT_EQ(entries[i].follow(), expected.follow());
+      }
+    }
+  }
+
+  EXPECT_TRUE(spill.is_empty());
+  EXPECT_EQ(spill.unspill(entries, ZMarkStackSlots), 0u);
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/recorder/jfrEventSetting.inline.hpp"
+#include "jfr/support/jfrNativeAllocationSample.inline.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/nativeCallStack.hpp"
+#include "unittest.hpp"
+
+// Pending samples are only committed while the event is enabled.
+class NativeAllocationSampleEnabler : public StackObj {
+  const bool _was_enabled;
+ public:
+  NativeAllocationSampleEnabler() : _was_enabled(JfrEventSetting::is_enabled(JfrNativeAllocationSampleEvent)) {
+    JfrEventSetting::set_enabled(JfrNativeAllocationSampleEvent, true);
+  }
+  ~NativeAllocationSampleEnabler() {
+    JfrEventSetting::set_enabled(JfrNativeAllocationSampleEvent, _was_enabled);
+  }
+};
+
+// A sample taken while the thread holds a VM lock ranked below the JFR locks
+// must stay pending until the thread leaves the VM.
+TEST_VM(JfrNativeAllocationSample, commit_deferred_until_leaving_vm) {
+  NativeAllocationSampleEnabler enabler;
+  JavaThread* const jt = JavaThread::current();
+  ThreadInVMfromNative invm(jt);
+  ASSERT_FALSE(JfrNativeAllocationSample::has_pending());
+  {
+    MutexLocker ml(Service_lock, Mutex::_no_safepoint_check_flag);
+    JfrNativeAllocationSample::record(NativeAllocationSampleInterval, mtTest, NativeCallStack::empty_stack());
+    ASSERT_TRUE(JfrNativeAllocationSample::has_pending());
+    // Further allocations accumulate into the next sample.
+    JfrNativeAllocationSample::record(NativeAllocationSampleInterval, mtTest, NativeCallStack::empty_stack());
+    ASSERT_TRUE(JfrNativeAllocationSample::has_pending());
+  }
+  {
+    ThreadToNativeFromVM ttn(jt);
+    ASSERT_FALSE(JfrNativeAllocationSample::has_pending());
+  }
+  // The carried over bytes are sampled by the next allocation.
+  JfrNativeAllocationSample::record(1, mtTest, NativeCallStack::empty_stack());
+  ASSERT_TRUE(JfrNativeAllocationSample::has_pending());
+  JfrNativeAllocationSample::commit_pending(jt);
+  ASSERT_FALSE(JfrNativeAllocationSample::has_pending());
+}
+
+// A sample taken in a JNI or JVMTI entry is committed when the entry returns
+// to native code.
+TEST_VM(JfrNativeAllocationSample, committed_when_returning_to_native) {
+  NativeAllocationSampleEnabler enabler;
+  JavaThread* const jt = JavaThread::current();
+  ThreadInVMfromNative invm(jt);
+  ThreadToNativeFromVM ttn(jt);
+  {
+    ThreadInVMfromNative entry(jt);
+    JfrNativeAllocationSample::record(NativeAllocationSampleInterval, mtTest, NativeCallStack::empty_stack());
+    ASSERT_TRUE(JfrNativeAllocationSample::has_pending());
+  }
+  ASSERT_FALSE(JfrNativeAllocationSample::has_pending());
+}
+
+TEST_VM(JfrNativeAllocationSample, own_allocations_not_sampled) {
+  JavaThread* const jt = JavaThread::current();
+  ThreadInVMfromNative invm(jt);
+  JfrNativeAllocationSample::record(NativeAllocationSampleInterval, mtTracing, NativeCallStack::empty_stack());
+  ASSERT_FALSE(JfrNativeAllocationSample::has_pending());
+}
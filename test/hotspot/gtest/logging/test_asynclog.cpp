@@ -173,6 +173,30 @@ TEST_VM(AsyncLogBufferTest, deque) {
   EXPECT_EQ((size_t)0, deque.size());
 }
 
+TEST_VM(AsyncLogBufferTest, link_nodes) {
+  LinkedListDeque<int, mtLogging> deque;
+  const int N = 10;
+
+  for (int i = 0; i < N; ++i) {
+    deque.link_back(deque.new_node(i));
+  }
+  EXPECT_EQ((size_t)N, deque.size());
+  EXPECT_EQ(0, *(deque.front()));
+  EXPECT_EQ(N - 1, *(deque.back()));
+
+  for (int i = 0; i < N; ++i) {
+    LinkedListNode<int>* node = deque.unlink_front();
+    ASSERT_NE((LinkedListNode<int>*)NULL, node);
+    EXPECT_EQ(i, *(node->data()));
+    EXPECT_EQ(NULL, node->next());
+    deque.delete_node(node);
+  }
+  EXPECT_EQ((size_t)0, deque.size());
+  EXPECT_EQ(NULL, deque.front());
+  EXPECT_EQ(NULL, deque.back());
+  EXPECT_EQ(NULL, deque.unlink_front());
+}
+
 TEST_VM_F(AsyncLogTest, asynclog) {
   set_log_config(TestLogFileName, "logging=debug");
 
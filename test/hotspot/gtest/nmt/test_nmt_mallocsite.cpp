@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "services/mallocSiteTable.hpp"
+#include "utilities/nativeCallStack.hpp"
+#include "unittest.hpp"
+
+TEST(NMT, malloc_site_scaled_by_stack_weight) {
+  address pc[] = { (address)0x1000, (address)0x2000 };
+  NativeCallStack stack(pc, 2);
+  MallocSite plain(stack, mtTest);
+  stack.set_weight(10);
+  MallocSite sampled(stack, mtTest);
+
+  // The weight does not change which site a stack belongs to.
+  EXPECT_TRUE(plain.equals(sampled));
+
+  plain.allocate(100);
+  sampled.allocate(100);
+  EXPECT_EQ(plain.size(), (size_t)100);
+  EXPECT_EQ(plain.count(), (size_t)1);
+  EXPECT_EQ(sampled.size(), (size_t)1000);
+  EXPECT_EQ(sampled.count(), (size_t)10);
+
+  sampled.deallocate(100);
+  EXPECT_EQ(sampled.size(), (size_t)0);
+  EXPECT_EQ(sampled.count(), (size_t)0);
+}
+
+TEST(NMT, empty_stack_is_not_unsampled) {
+  EXPECT_EQ(NativeCallStack::empty_stack().weight(), (uint)1);
+  EXPECT_EQ(NativeCallStack().weight(), (uint)1);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2022, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "runtime/continuationStats.hpp"
+#include "unittest.hpp"
+
+TEST(ContinuationStats, record) {
+  ContinuationStats* stats = new ContinuationStats();
+  EXPECT_EQ(0u, stats->count(ContinuationStats::freeze_op, ContinuationStats::fast_path));
+  EXPECT_EQ(0, stats->percentile_ticks(ContinuationStats::freeze_op, ContinuationStats::fast_path, 0.5));
+
+  for (int i = 0; i < 99; i++) {
+    stats->record(ContinuationStats::freeze_op, ContinuationStats::fast_path, 10, 100);
+  }
+  stats->record(ContinuationStats::freeze_op, ContinuationStats::fast_path, 100000, 5000);
+  stats->record(ContinuationStats::thaw_op, ContinuationStats::slow_path, 10, 1);
+
+  EXPECT_EQ(100u, stats->count(ContinuationStats::freeze_op, ContinuationStats::fast_path));
+  EXPECT_EQ(0u, stats->count(ContinuationStats::freeze_op, ContinuationStats::slow_path));
+  EXPECT_EQ(1u, stats->count(ContinuationStats::thaw_op, ContinuationStats::slow_path));
+  EXPECT_EQ(99u * 100 + 5000, stats->total_ticks(ContinuationStats::freeze_op, ContinuationStats::fast_path));
+
+  // 100 ticks fall into [64, 128), 5000 into [4096, 8192)
+  EXPECT_EQ(128, stats->percentile_ticks(ContinuationStats::freeze_op, ContinuationStats::fast_path, 0.5));
+  EXPECT_EQ(128, stats->percentile_ticks(ContinuationStats::freeze_op, ContinuationStats::fast_path, 0.99));
+  EXPECT_EQ(8192, stats->percentile_ticks(ContinuationStats::freeze_op, ContinuationStats::fast_path, 1.0));
+  EXPECT_EQ(2, stats->percentile_ticks(ContinuationStats::thaw_op, ContinuationStats::slow_path, 1.0));
+
+  delete stats;
+}
@@ -22,7 +22,7 @@
  */
 
 #include "precompiled.hpp"
-#include "runtime/objectMonitor.hpp"
+#include "runtime/objectMonitor.inline.hpp"
 #include "runtime/vm_version.hpp"
 #include "unittest.hpp"
 
@@ -44,3 +44,21 @@ TEST_VM(ObjectMonitor, sanity) {
         << "than a cache line which permits false sharing.";
   }
 }
+
+TEST(ObjectMonitor, vthread_owner) {
+  // Tagged virtual thread owners must never look like a JavaThread*,
+  // a BasicLock* or the deflater marker.
+  int64_t tids[] = { 1, 2, 42, 0x7fffffff, (int64_t)1 << 40 };
+  for (int64_t tid : tids) {
+    void* owner = ObjectMonitor::vthread_owner(tid);
+    EXPECT_TRUE(ObjectMonitor::is_vthread_owner(owner)) << "tid: " << tid;
+    EXPECT_FALSE(is_aligned(owner, sizeof(void*))) << "tid: " << tid;
+    EXPECT_NE(DEFLATER_MARKER, owner) << "tid: " << tid;
+  }
+  EXPECT_NE(ObjectMonitor::vthread_owner(1), ObjectMonitor::vthread_owner(2));
+
+  EXPECT_FALSE(ObjectMonitor::is_vthread_owner(nullptr));
+  EXPECT_FALSE(ObjectMonitor::is_vthread_owner(DEFLATER_MARKER));
+  int word;
+  EXPECT_FALSE(ObjectMonitor::is_vthread_owner(&word));
+}
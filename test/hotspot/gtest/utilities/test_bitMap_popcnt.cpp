@@ -146,6 +146,32 @@ TEST_VM(BitMap, popcnt_19)  { test_bitmap_popcnt(17); }
 TEST_VM(BitMap, popcnt_63)  { test_bitmap_popcnt(63); }
 TEST_VM(BitMap, popcnt_300) { test_bitmap_popcnt(300); }
 
+// Covers the multi-word counting path with runs of full words that are
+// longer and shorter than its eight word blocks.
+TEST_VM(BitMap, popcnt_random_words) {
+  const int bitsize = 33 * BitsPerWord + 17;
+  CHeapBitMap bm(bitsize);
+  SimpleFakeBitmap fbm(bitsize);
+
+  for (int i = 0; i < bitsize; i++) {
+    if ((os::random() % 3) == 0) {
+      bm.set_bit(i);
+      fbm.set_range(i, i + 1);
+    }
+  }
+
+  ASSERT_POPCNT_ALL_CMP(bm, fbm);
+  for (int beg = 0; beg < bitsize; beg += 37) {
+    for (int end = beg; end <= bitsize; end += 29) {
+      ASSERT_POPCNT_RANGE_CMP(bm, beg, end, fbm);
+    }
+  }
+
+  bm.set_range(0, bitsize);
+  fbm.set_range(0, bitsize);
+  ASSERT_POPCNT_ALL_CMP(bm, fbm);
+}
+
 TEST_VM(BitMap, popcnt_large) {
 
   CHeapBitMap bm(64 * K);
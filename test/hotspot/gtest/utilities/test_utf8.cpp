@@ -78,6 +78,27 @@ TEST_VM(utf8, jchar_length) {
 
 }
 
+TEST_VM(utf8, is_legal_utf8) {
+  unsigned char buf[40];
+  ::memset(buf, 'a', sizeof(buf));
+  ASSERT_TRUE(UTF8::is_legal_utf8(buf, (int)sizeof(buf), false));
+
+  // Embedded zeros and illegal bytes must be found at every position,
+  // both inside the word-at-a-time prefix and in the tail.
+  for (int i = 0; i < (int)sizeof(buf); i++) {
+    buf[i] = 0;
+    EXPECT_FALSE(UTF8::is_legal_utf8(buf, (int)sizeof(buf), false)) << "zero at " << i;
+    buf[i] = 0x80;
+    EXPECT_FALSE(UTF8::is_legal_utf8(buf, (int)sizeof(buf), false)) << "0x80 at " << i;
+    buf[i] = 'a';
+  }
+
+  // A legal two-byte sequence after an ASCII prefix.
+  buf[17] = 0xC3;
+  buf[18] = 0xA9;
+  ASSERT_TRUE(UTF8::is_legal_utf8(buf, (int)sizeof(buf), false));
+}
+
 TEST_VM(utf8, jbyte_length) {
   char res[60];
   jbyte str[20];
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that merging adjacent array stores keeps the stored bytes.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions -XX:+MergeStores
+ *                   compiler.c2.TestMergeStores
+ */
+
+package compiler.c2;
+
+import java.util.Arrays;
+
+public class TestMergeStores {
+
+    static void storeIntLE(byte[] a, int i, int v) {
+        a[i + 0] = (byte)(v);
+        a[i + 1] = (byte)(v >> 8);
+        a[i + 2] = (byte)(v >> 16);
+        a[i + 3] = (byte)(v >>> 24);
+    }
+
+    static void storeIntBE(byte[] a, int i, int v) {
+        a[i + 0] = (byte)(v >> 24);
+        a[i + 1] = (byte)(v >> 16);
+        a[i + 2] = (byte)(v >> 8);
+        a[i + 3] = (byte)(v);
+    }
+
+    static void storeLongLE(byte[] a, int i, long v) {
+        for (int j = 0; j < 8; j++) {
+            a[i + j] = (byte)(v >> (8 * j));
+        }
+    }
+
+    static void storeConstants(byte[] a, int i) {
+        a[i + 0] = 1;
+        a[i + 1] = 2;
+        a[i + 2] = 3;
+        a[i + 3] = 4;
+        a[i + 4] = (byte)0xff;
+    }
+
+    static void storeChars(char[] a, int i, int v) {
+        a[i + 0] = (char)v;
+        a[i + 1] = (char)(v >> 16);
+    }
+
+    static void storeIntsOfLong(int[] a, int i, long v) {
+        a[i + 0] = (int)v;
+        a[i + 1] = (int)(v >> 32);
+    }
+
+    static void storeAndReload(byte[] a, int i, int v, int[] out) {
+        a[i + 0] = (byte)(v);
+        a[i + 1] = (byte)(v >> 8);
+        out[0] = a[i + 1];
+    }
+
+    static byte[] expectedLE(int v) {
+        return new byte[] { (byte)v, (byte)(v >> 8), (byte)(v >> 16), (byte)(v >> 24) };
+    }
+
+    static void check(boolean ok, String what) {
+        if (!ok) {
+            throw new RuntimeException("wrong result: " + what);
+        }
+    }
+
+    public static void main(String[] args) {
+        byte[] b = new byte[16];
+        char[] c = new char[4];
+        int[] n = new int[4];
+        int[] out = new int[1];
+        for (int iter = 0; iter < 50_000; iter++) {
+            int v = iter * 0x9E3779B9;
+            long l = ((long)v << 29) ^ iter;
+            int off = iter & 7;
+
+            Arrays.fill(b, (byte)0);
+            storeIntLE(b, off, v);
+            check(Arrays.equals(Arrays.copyOfRange(b, off, off + 4), expectedLE(v)), "storeIntLE");
+
+            storeIntBE(b, off, v);
+            check(Arrays.equals(Arrays.copyOfRange(b, off, off + 4), expectedLE(Integer.reverseBytes(v))), "storeIntBE");
+
+            storeLongLE(b, off, l);
+            for (int j = 0; j < 8; j++) {
+                check(b[off + j] == (byte)(l >> (8 * j)), "storeLongLE");
+            }
+
+            Arrays.fill(b, (byte)0);
+            storeConstants(b, off);
+            check(b[off] == 1 && b[off + 1] == 2 && b[off + 2] == 3 && b[off + 3] == 4 &&
+                  b[off + 4] == (byte)0xff, "storeConstants");
+
+            storeChars(c, iter & 1, v);
+            check(c[iter & 1] == (char)v && c[(iter & 1) + 1] == (char)(v >> 16), "storeChars");
+
+            storeIntsOfLong(n, iter & 1, l);
+            check(n[iter & 1] == (int)l && n[(iter & 1) + 1] == (int)(l >> 32), "storeIntsOfLong");
+
+            storeAndReload(b, off, v, out);
+            check(out[0] == (byte)(v >> 8), "storeAndReload");
+        }
+    }
+}
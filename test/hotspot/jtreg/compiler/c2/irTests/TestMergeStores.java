@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that C2 merges adjacent array stores into wider stores.
+ * @requires vm.compiler2.enabled
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64"
+ * @library /test/lib /
+ * @run driver compiler.c2.irTests.TestMergeStores
+ */
+
+package compiler.c2.irTests;
+
+import jdk.test.lib.Asserts;
+import compiler.lib.ir_framework.*;
+
+public class TestMergeStores {
+    static final String REVERSE_BYTES_I = "(\\d+(\\s){2}(ReverseBytesI.*)+(\\s){2}===.*)";
+    static final String REVERSE_BYTES_L = "(\\d+(\\s){2}(ReverseBytesL.*)+(\\s){2}===.*)";
+
+    // The arrays have a known length, so the stores at constant indices
+    // need no range checks and are all under the same control.
+    static final byte[] BYTES = new byte[16];
+    static final char[] CHARS = new char[4];
+    static final int[] INTS = new int[4];
+
+    static final int INT_VALUE = 0x01020304;
+    static final long LONG_VALUE = 0x0102030405060708L;
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("-XX:+UnlockExperimentalVMOptions", "-XX:+MergeStores");
+    }
+
+    static void checkBytes(long expected, int count) {
+        for (int i = 0; i < count; i++) {
+            Asserts.assertEQ(BYTES[i], (byte)(expected >> (8 * i)));
+        }
+    }
+
+    @Test
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, failOn = {IRNode.STORE_B})
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, counts = {IRNode.STORE_I, "1"})
+    public static void storeIntLE(int v) {
+        BYTES[0] = (byte)(v);
+        BYTES[1] = (byte)(v >> 8);
+        BYTES[2] = (byte)(v >> 16);
+        BYTES[3] = (byte)(v >>> 24);
+    }
+
+    @Run(test = "storeIntLE")
+    public static void runStoreIntLE() {
+        storeIntLE(INT_VALUE);
+        checkBytes(INT_VALUE, 4);
+    }
+
+    @Test
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, failOn = {IRNode.STORE_B})
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, counts = {IRNode.STORE_I, "1", REVERSE_BYTES_I, "1"})
+    public static void storeIntBE(int v) {
+        BYTES[0] = (byte)(v >> 24);
+        BYTES[1] = (byte)(v >> 16);
+        BYTES[2] = (byte)(v >> 8);
+        BYTES[3] = (byte)(v);
+    }
+
+    @Run(test = "storeIntBE")
+    public static void runStoreIntBE() {
+        storeIntBE(INT_VALUE);
+        checkBytes(Integer.reverseBytes(INT_VALUE), 4);
+    }
+
+    @Test
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, failOn = {IRNode.STORE_B})
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, counts = {IRNode.STORE_L, "1"})
+    public static void storeLongLE(long v) {
+        BYTES[0] = (byte)(v);
+        BYTES[1] = (byte)(v >> 8);
+        BYTES[2] = (byte)(v >> 16);
+        BYTES[3] = (byte)(v >> 24);
+        BYTES[4] = (byte)(v >> 32);
+        BYTES[5] = (byte)(v >> 40);
+        BYTES[6] = (byte)(v >> 48);
+        BYTES[7] = (byte)(v >>> 56);
+    }
+
+    @Run(test = "storeLongLE")
+    public static void runStoreLongLE() {
+        storeLongLE(LONG_VALUE);
+        checkBytes(LONG_VALUE, 8);
+    }
+
+    @Test
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, failOn = {IRNode.STORE_B})
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, counts = {IRNode.STORE_L, "1", REVERSE_BYTES_L, "1"})
+    public static void storeLongBE(long v) {
+        BYTES[0] = (byte)(v >> 56);
+        BYTES[1] = (byte)(v >> 48);
+        BYTES[2] = (byte)(v >> 40);
+        BYTES[3] = (byte)(v >> 32);
+        BYTES[4] = (byte)(v >> 24);
+        BYTES[5] = (byte)(v >> 16);
+        BYTES[6] = (byte)(v >> 8);
+        BYTES[7] = (byte)(v);
+    }
+
+    @Run(test = "storeLongBE")
+    public static void runStoreLongBE() {
+        storeLongBE(LONG_VALUE);
+        checkBytes(Long.reverseBytes(LONG_VALUE), 8);
+    }
+
+    @Test
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, failOn = {IRNode.STORE_B})
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, counts = {IRNode.STORE_I, "1"})
+    public static void storeConstants() {
+        BYTES[0] = 4;
+        BYTES[1] = 3;
+        BYTES[2] = 2;
+        BYTES[3] = 1;
+    }
+
+    @Run(test = "storeConstants")
+    public static void runStoreConstants() {
+        storeConstants();
+        checkBytes(INT_VALUE, 4);
+    }
+
+    @Test
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, failOn = {IRNode.STORE_C})
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, counts = {IRNode.STORE_I, "1"})
+    public static void storeChars(int v) {
+        CHARS[0] = (char)v;
+        CHARS[1] = (char)(v >> 16);
+    }
+
+    @Run(test = "storeChars")
+    public static void runStoreChars() {
+        storeChars(INT_VALUE);
+        Asserts.assertEQ(CHARS[0], (char)INT_VALUE);
+        Asserts.assertEQ(CHARS[1], (char)(INT_VALUE >> 16));
+    }
+
+    @Test
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, failOn = {IRNode.STORE_I})
+    @IR(applyIf = {"UseUnalignedAccesses", "true"}, counts = {IRNode.STORE_L, "1"})
+    public static void storeIntsOfLong(long v) {
+        INTS[0] = (int)v;
+        INTS[1] = (int)(v >> 32);
+    }
+
+    @Run(test = "storeIntsOfLong")
+    public static void runStoreIntsOfLong() {
+        storeIntsOfLong(LONG_VALUE);
+        Asserts.assertEQ(INTS[0], (int)LONG_VALUE);
+        Asserts.assertEQ(INTS[1], (int)(LONG_VALUE >> 32));
+    }
+
+    // Stores of parts that are not adjacent bits of one value are kept.
+    @Test
+    @IR(counts = {IRNode.STORE_B, "2"})
+    public static void storeUnrelated(int v) {
+        BYTES[0] = (byte)(v);
+        BYTES[1] = (byte)(v >> 16);
+    }
+
+    @Run(test = "storeUnrelated")
+    public static void runStoreUnrelated() {
+        storeUnrelated(INT_VALUE);
+        Asserts.assertEQ(BYTES[0], (byte)INT_VALUE);
+        Asserts.assertEQ(BYTES[1], (byte)(INT_VALUE >> 16));
+    }
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+import jdk.test.lib.Asserts;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.atomic.AtomicReference;
+
+/**
+ * @test YieldWithMonitors
+ * @summary Tests that a virtual thread can yield while it holds object monitors
+ * @library /test/lib
+ * @compile --enable-preview -source ${jdk.version} YieldWithMonitors.java
+ * @run main/othervm --enable-preview -XX:+UnlockExperimentalVMOptions -XX:+YieldWithMonitors YieldWithMonitors unmount
+ * @run main/othervm --enable-preview -XX:+UnlockExperimentalVMOptions -XX:+YieldWithMonitors -Xint YieldWithMonitors unmount
+ * @run main/othervm --enable-preview -XX:+UnlockExperimentalVMOptions -XX:+YieldWithMonitors -Xcomp YieldWithMonitors unmount
+ * @run main/othervm --enable-preview -XX:+UnlockExperimentalVMOptions -XX:-YieldWithMonitors YieldWithMonitors
+ */
+
+public class YieldWithMonitors {
+
+    static final AtomicReference<Throwable> exception = new AtomicReference<>();
+
+    static Thread startVirtual(Runnable task) {
+        return Thread.ofVirtual().start(() -> {
+            try {
+                task.run();
+            } catch (Throwable t) {
+                exception.compareAndSet(null, t);
+            }
+        });
+    }
+
+    static Thread startPlatform(Runnable task) {
+        return Thread.ofPlatform().start(() -> {
+            try {
+                task.run();
+            } catch (Throwable t) {
+                exception.compareAndSet(null, t);
+            }
+        });
+    }
+
+    static void joinAll(List<Thread> threads) throws Throwable {
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (exception.get() != null) {
+            throw exception.get();
+        }
+    }
+
+    // The monitor is still owned after the virtual thread yields, and can be
+    // exited, possibly on another carrier.
+    static void yieldInSynchronized() throws Throwable {
+        final Object lock = new Object();
+        List<Thread> threads = new ArrayList<>();
+        threads.add(startVirtual(() -> {
+            synchronized (lock) {
+                Thread.yield();
+                Asserts.assertTrue(Thread.holdsLock(lock), "monitor lost across yield");
+            }
+            Asserts.assertFalse(Thread.holdsLock(lock), "monitor not released");
+        }));
+        joinAll(threads);
+    }
+
+    // Recursive and nested monitors survive a yield in the innermost frame.
+    static void yieldInNestedSynchronized() throws Throwable {
+        final Object outer = new Object();
+        final Object inner = new Object();
+        List<Thread> threads = new ArrayList<>();
+        threads.add(startVirtual(() -> {
+            synchronized (outer) {
+                synchronized (inner) {
+                    synchronized (outer) {
+                        Thread.yield();
+                        Asserts.assertTrue(Thread.holdsLock(outer), "outer monitor lost across yield");
+                        Asserts.assertTrue(Thread.holdsLock(inner), "inner monitor lost across yield");
+                    }
+                    Asserts.assertTrue(Thread.holdsLock(outer), "recursive exit released outer monitor");
+                }
+            }
+            Asserts.assertFalse(Thread.holdsLock(outer), "outer monitor not released");
+            Asserts.assertFalse(Thread.holdsLock(inner), "inner monitor not released");
+        }));
+        joinAll(threads);
+    }
+
+    // Other threads stay excluded while the owner is unmounted. The
+    // contenders are platform threads: a virtual thread blocked on monitor
+    // entry keeps its carrier, so virtual contenders could take all the
+    // carriers the owner needs to continue.
+    static void mutualExclusion() throws Throwable {
+        final Object lock = new Object();
+        final int[] counter = new int[1];
+        final int ncontenders = 4;
+        final int iterations = 100;
+        Runnable increment = () -> {
+            for (int j = 0; j < iterations; j++) {
+                synchronized (lock) {
+                    int value = counter[0];
+                    Thread.yield();
+                    counter[0] = value + 1;
+                }
+            }
+        };
+        List<Thread> threads = new ArrayList<>();
+        threads.add(startVirtual(increment));
+        for (int i = 0; i < ncontenders; i++) {
+            threads.add(startPlatform(increment));
+        }
+        joinAll(threads);
+        Asserts.assertEQ(counter[0], (ncontenders + 1) * iterations, "lost updates under the monitor");
+    }
+
+    // wait and notify work on a monitor taken over by the virtual thread.
+    static void waitAfterYield() throws Throwable {
+        final Object lock = new Object();
+        final CountDownLatch waiting = new CountDownLatch(1);
+        final boolean[] notified = new boolean[1];
+        List<Thread> threads = new ArrayList<>();
+        threads.add(startVirtual(() -> {
+            synchronized (lock) {
+                Thread.yield();
+                waiting.countDown();
+                while (!notified[0]) {
+                    try {
+                        lock.wait();
+                    } catch (InterruptedException e) {
+                        throw new RuntimeException(e);
+                    }
+                }
+            }
+        }));
+        // Object.wait pins the waiter, so notify from a platform thread.
+        threads.add(startPlatform(() -> {
+            try {
+                waiting.await();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+            synchronized (lock) {
+                notified[0] = true;
+                lock.notifyAll();
+            }
+        }));
+        joinAll(threads);
+    }
+
+    // More virtual threads than carriers all yield while holding a monitor.
+    static void manyOwners() throws Throwable {
+        final int nthreads = Runtime.getRuntime().availableProcessors() * 4;
+        final CountDownLatch allStarted = new CountDownLatch(nthreads);
+        List<Thread> threads = new ArrayList<>();
+        for (int i = 0; i < nthreads; i++) {
+            final Object lock = new Object();
+            threads.add(startVirtual(() -> {
+                synchronized (lock) {
+                    allStarted.countDown();
+                    try {
+                        allStarted.await();
+                    } catch (InterruptedException e) {
+                        throw new RuntimeException(e);
+                    }
+                    Asserts.assertTrue(Thread.holdsLock(lock), "monitor lost across park");
+                }
+            }));
+        }
+        joinAll(threads);
+    }
+
+    public static void main(String[] args) throws Throwable {
+        yieldInSynchronized();
+        yieldInNestedSynchronized();
+        mutualExclusion();
+        waitAfterYield();
+        if (args.length > 0 && args[0].equals("unmount")) {
+            // Without YieldWithMonitors the owners pin their carriers, and
+            // more of them than carriers cannot all wait for each other.
+            manyOwners();
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+import java.util.concurrent.CountDownLatch;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.tlab_stats
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:+UseSerialGC -XX:+UnlockExperimentalVMOptions -XX:+TLABReserve TLABStatsTest
+ */
+public class TLABStatsTest {
+    private static final String ALLOCATOR_NAME = "TLABStatsTest-allocator";
+
+    // The statistics of the allocator thread, which does not allocate after the GC.
+    private static final Pattern ALLOCATOR_STATS = Pattern.compile(
+        "\"" + ALLOCATOR_NAME + "\" .* refills: (\\d+) .* reserve refills: (\\d+) reserve discarded: (\\d+)B");
+
+    static volatile Object sink;
+
+    public void run(CommandExecutor executor) throws Exception {
+        CountDownLatch allocated = new CountDownLatch(1);
+        CountDownLatch done = new CountDownLatch(1);
+        Thread allocator = new Thread(() -> {
+            // Refill the TLAB often enough to be given reserves.
+            for (int i = 0; i < 100_000; i++) {
+                sink = new byte[1024];
+            }
+            allocated.countDown();
+            try {
+                done.await();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+        }, ALLOCATOR_NAME);
+        allocator.start();
+        allocated.await();
+
+        try {
+            System.gc();
+
+            OutputAnalyzer output = executor.execute("GC.tlab_stats");
+            output.shouldContain(ALLOCATOR_NAME);
+
+            Matcher m = ALLOCATOR_STATS.matcher(output.getOutput());
+            Assert.assertTrue(m.find(), "No TLAB statistics for " + ALLOCATOR_NAME);
+            // All statistics are per GC, including the discarded reserves.
+            Assert.assertEquals(Long.parseLong(m.group(1)), 0L, "refills since the last GC");
+            Assert.assertEquals(Long.parseLong(m.group(2)), 0L, "reserve refills since the last GC");
+            Assert.assertEquals(Long.parseLong(m.group(3)), 0L, "reserve bytes discarded since the last GC");
+        } finally {
+            done.countDown();
+            allocator.join();
+        }
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() throws Exception {
+        run(new PidJcmdExecutor());
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.loom;
+
+import jdk.internal.vm.Continuation;
+import jdk.internal.vm.ContinuationScope;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.CompilerControl;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures the cost of one yield (freeze) and resume (thaw) round trip of a
+ * continuation as a function of the number of frames between the
+ * continuation entry and the yield.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@Measurement(iterations = 10, time = 500, timeUnit = TimeUnit.MILLISECONDS)
+@State(Scope.Thread)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Fork(value = 3, jvmArgsAppend = { "--enable-preview", "--add-exports", "java.base/jdk.internal.vm=ALL-UNNAMED" })
+public class ContinuationYield {
+
+    static final ContinuationScope SCOPE = new ContinuationScope("ContinuationYield") {};
+
+    @Param({"1", "5", "10", "20", "50", "100"})
+    public int depth;
+
+    // Number of live reference locals in each frame, to make frames
+    // carry oops that freeze/thaw and the GC have to handle.
+    @Param({"0", "4"})
+    public int oops;
+
+    Continuation cont;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        cont = new Continuation(SCOPE, () -> {
+            if (oops == 0) {
+                recurse(depth);
+            } else {
+                recurseWithOops(depth, "a", "b", "c", "d");
+            }
+        });
+        // Run to the first yield so that every measured run is a resume
+        // of a fully frozen stack of 'depth' frames.
+        cont.run();
+    }
+
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    static int recurse(int n) {
+        if (n > 1) {
+            return recurse(n - 1) + 1;
+        }
+        while (true) {
+            Continuation.yield(SCOPE);
+        }
+    }
+
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    static int recurseWithOops(int n, Object o1, Object o2, Object o3, Object o4) {
+        if (n > 1) {
+            return recurseWithOops(n - 1, o2, o3, o4, o1) + o1.hashCode() + o4.hashCode();
+        }
+        while (true) {
+            Continuation.yield(SCOPE);
+        }
+    }
+
+    @Benchmark
+    public void yieldAndResume() {
+        cont.run();
+    }
+}
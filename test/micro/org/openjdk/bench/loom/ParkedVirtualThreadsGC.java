@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.loom;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Measures System.gc() time with a large number of parked virtual threads,
+ * each of which keeps a frozen stack chunk alive for the collector to scan.
+ */
+@BenchmarkMode(Mode.SingleShotTime)
+@Warmup(iterations = 3)
+@Measurement(iterations = 10)
+@State(Scope.Benchmark)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Fork(value = 3, jvmArgsAppend = { "--enable-preview", "-Xmx4g" })
+public class ParkedVirtualThreadsGC {
+
+    @Param({"10000", "100000", "1000000"})
+    public int threads;
+
+    // Frames on each parked virtual thread's stack.
+    @Param({"1", "20"})
+    public int depth;
+
+    List<Thread> parked;
+    volatile boolean done;
+
+    @Setup(Level.Trial)
+    public void setup() throws InterruptedException {
+        CountDownLatch started = new CountDownLatch(threads);
+        parked = new ArrayList<>(threads);
+        for (int i = 0; i < threads; i++) {
+            parked.add(Thread.ofVirtual().start(() -> park(depth, started)));
+        }
+        started.await();
+    }
+
+    int park(int n, CountDownLatch started) {
+        if (n > 1) {
+            return park(n - 1, started) + 1;
+        }
+        started.countDown();
+        while (!done) {
+            LockSupport.park();
+        }
+        return 0;
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() throws InterruptedException {
+        done = true;
+        for (Thread t : parked) {
+            LockSupport.unpark(t);
+        }
+        for (Thread t : parked) {
+            t.join();
+        }
+    }
+
+    @Benchmark
+    public void fullGC() {
+        System.gc();
+    }
+}